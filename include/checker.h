@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   checker.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:51:36 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:56 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file checker.h
+ * @brief Header file for the checker program.
+ *
+ * The checker parses the same arguments as push_swap, then reads
+ * operations from standard input, text or binary, and runs them on the
+ * same stack engine.
+ * It prints OK if stack A ends up sorted with stack B empty, KO otherwise.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#ifndef CHECKER_H
+# define CHECKER_H
+
+# include "push_swap.h"
+
+/**
+ * @brief Size in bytes of each block read from standard input.
+ */
+# define CHECKER_BLOCK	65536
+
+/** @defgroup checker Checker
+ *  @brief Streaming instruction reader used by the checker program.
+ *  @{
+ */
+void	read_instructions(t_array *array);
+/** @} */
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/11 13:24:15 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 10:26:53 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/18 12:01:19 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,42 +33,524 @@
 # include <unistd.h>
 # include <stdbool.h>
 # include <limits.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <pthread.h>
+# include <stdatomic.h>
+# include <stdint.h>
 # include "libft.h"
 
 /**
- * @brief Maximum size of the stacks.
+ * @brief Size in bytes of the buffer holding operations before output.
  */
-# define PS_SIZE_MAX	100000
+# define PS_BUFFER_SIZE	65536
+
+/**
+ * @brief Size in bytes of each block read from standard input.
+ */
+# define PS_READ_BLOCK	65536
+
+/**
+ * @brief Initial number of operations the operation log can hold.
+ */
+# define PS_OPLOG_INIT	4096
+
+/**
+ * @brief How far back the peephole pass looks for a matching operation.
+ */
+# define PS_PEEPHOLE_WINDOW	32
+
+/**
+ * @brief Signature opening a binary operation stream.
+ *
+ * It starts with `P`, which no text instruction does, so readers tell the
+ * two formats apart from the first byte.
+ */
+# define PS_BINARY_MAGIC	"PSB1"
+
+/**
+ * @brief Longest run of one operation held by a binary byte.
+ */
+# define PS_BINARY_RUN	16
+
+/**
+ * @brief Largest input the automatic dispatcher hands to the turk engine.
+ *
+ * Above this size radix sort is used: the turk engine emits fewer
+ * operations, but its chunked pushes grow faster than n log n.
+ */
+# define PS_TURK_MAX	5000
+
+/**
+ * @brief Largest input solved by exhaustive search for a minimal sequence.
+ */
+# define PS_OPTIMAL_MAX	8
+
+/**
+ * @brief Largest input answered from the precomputed tables.
+ *
+ * The tables live in `srcs/sort/optimal_tables.c`, generated by
+ * `make tables`; larger inputs up to PS_OPTIMAL_MAX are searched.
+ */
+# define PS_TABLE_MAX	7
+
+/**
+ * @brief Number of engines raced against each other by `--engine portfolio`.
+ */
+# define PS_PORTFOLIO_SIZE	3
+
+/**
+ * @brief Largest number of radix decisions read ahead by one scan.
+ */
+# define PS_SCAN_CHUNK	4096
+
+/**
+ * @brief Whether the x86-64 vector scans of radix passes are built.
+ */
+# if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#  define PS_SCAN_X86	1
+# else
+#  define PS_SCAN_X86	0
+# endif
+
+/**
+ * @brief Number of values and of pairs sampled when profiling stack A.
+ */
+# define PS_PROFILE_SAMPLE	1024
+
+/**
+ * @brief Largest number of instances solved per round of `--batch`.
+ */
+# define PS_BATCH_CHUNK	4096
+
+/**
+ * @brief Input bytes gathered before a round of `--batch` starts.
+ *
+ * A round starts early with fewer than PS_BATCH_CHUNK instances once this
+ * many bytes are waiting, so long instances do not pile up in memory.
+ */
+# define PS_BATCH_BYTES	1048576
+
+/**
+ * @brief Largest number of threads used by `--batch`.
+ */
+# define PS_BATCH_THREADS	64
+
+/**
+ * @brief Characters of the longest size_t in decimal, with its terminator.
+ */
+# define PS_SIZE_DIGITS	21
+
+/**
+ * @enum e_engine
+ * @brief Sorting strategies that can be selected above PS_OPTIMAL_MAX values.
+ *
+ * `--engine` names the engines up to ENGINE_PORTFOLIO, in order. The
+ * ternary engine comes after them: it loses to radix on every size, so
+ * it is only reachable through `ps_solve_engine`.
+ */
+typedef enum e_engine
+{
+	ENGINE_AUTO,
+	ENGINE_RADIX,
+	ENGINE_TURK,
+	ENGINE_LIS,
+	ENGINE_ROTATION,
+	ENGINE_RADIX_SIM,
+	ENGINE_PORTFOLIO,
+	ENGINE_TERNARY
+}	t_engine;
+
+/**
+ * @enum e_status
+ * @brief Outcome of `ps_solve`.
+ */
+typedef enum e_status
+{
+	PS_OK,
+	PS_ERROR_INPUT,
+	PS_ERROR_DUPLICATE,
+	PS_ERROR_ALLOC
+}	t_status;
+
+/**
+ * @struct s_move
+ * @brief Rotations needed to bring a B element and its A target on top.
+ *
+ * Positive counts rotate (`ra`/`rb`), negative counts reverse rotate
+ * (`rra`/`rrb`). Rotations in the same direction are paired as `rr`/`rrr`.
+ */
+typedef struct s_move
+{
+	int	a;							/**< Signed rotations of stack A */
+	int	b;							/**< Signed rotations of stack B */
+	int	cost;						/**< Total number of operations */
+}	t_move;
+
+/**
+ * @struct s_state
+ * @brief Compact search state: both stacks of a small input in one array.
+ *
+ * `v[0 .. a_size)` is stack A from top to bottom, `v[a_size .. size)` is
+ * stack B from top to bottom. Values are normalized indices, so a state
+ * is a permutation of `0 .. size - 1` plus the split between the stacks.
+ */
+typedef struct s_state
+{
+	unsigned char	v[PS_OPTIMAL_MAX];	/**< Stack A followed by stack B */
+	int				size;				/**< Total number of values */
+	int				a_size;				/**< Number of values in stack A */
+}	t_state;
+
+/**
+ * @struct s_search
+ * @brief Bidirectional breadth-first search bookkeeping.
+ *
+ * The per-state arrays are indexed by encoded state. Side 0 searches
+ * forward from the input, side 1 backward from the sorted state. For a
+ * forward state, `parent` and `via` point one step closer to the input;
+ * for a backward state, one step closer to the sorted state.
+ */
+typedef struct s_search
+{
+	int				*parent;			/**< Next state towards the root */
+	unsigned char	*via;				/**< Operation linking to `parent` */
+	unsigned char	*side;				/**< 0 unseen, 1 forward, 2 backward */
+	unsigned char	*depth;				/**< Distance to the side's root */
+	int				*queue[2];			/**< Frontier of each side */
+	int				head[2];			/**< Next state to expand per side */
+	int				tail[2];			/**< End of each frontier */
+	int				size;				/**< Number of values */
+	int				best;				/**< Shortest path length found */
+	int				meet[3];			/**< Forward state, op, back state */
+}	t_search;
+
+/**
+ * @enum e_op
+ * @brief Codes of the 11 stack operations, as stored in the operation log.
+ *
+ * OP_NONE and OP_CANCEL are not operations: they are the results of the
+ * peephole rule table for "no rewrite" and "the two operations cancel out".
+ */
+typedef enum e_op
+{
+	OP_SA,
+	OP_SB,
+	OP_SS,
+	OP_PA,
+	OP_PB,
+	OP_RA,
+	OP_RB,
+	OP_RR,
+	OP_RRA,
+	OP_RRB,
+	OP_RRR,
+	OP_COUNT,
+	OP_NONE = OP_COUNT,
+	OP_CANCEL
+}	t_op;
+
+/**
+ * @struct s_oplog
+ * @brief Growable record of the operations produced by a sort.
+ *
+ * Operations are recorded here instead of being printed right away, so the
+ * whole stream can be optimized before it is emitted.
+ */
+typedef struct s_oplog
+{
+	unsigned char	*ops;			/**< Operation codes, see t_op */
+	size_t			size;			/**< Number of recorded operations */
+	size_t			capacity;		/**< Allocated length of `ops` */
+	bool			failed;			/**< An allocation failed, ops are lost */
+}	t_oplog;
+
+/**
+ * @enum e_format
+ * @brief Encodings of an operation stream.
+ *
+ * The binary format is PS_BINARY_MAGIC followed by one byte per run:
+ * the operation code in the high nibble, the run length minus one in the
+ * low nibble.
+ */
+typedef enum e_format
+{
+	FORMAT_UNKNOWN,
+	FORMAT_TEXT,
+	FORMAT_BINARY
+}	t_format;
+
+/**
+ * @struct s_decoder
+ * @brief State of an operation stream decoded block by block.
+ *
+ * `pending` holds the bytes of an unfinished text line, or the part of
+ * the binary signature read so far.
+ */
+typedef struct s_decoder
+{
+	unsigned char	pending[4];		/**< Bytes carried to the next block */
+	int				len;			/**< Number of bytes in `pending` */
+	t_format		format;			/**< Detected from the first byte */
+}	t_decoder;
+
+/**
+ * @struct s_stack
+ * @brief Circular deque used to store one push_swap stack.
+ *
+ * Elements live in a ring buffer: `head` is the physical slot of the top
+ * element and the stack extends `size` slots from there, wrapping around
+ * at `capacity`. Pushing, popping and rotating only move `head`, so every
+ * stack operation runs in constant time.
+ *
+ * `breaks` counts the adjacent pairs (top to bottom) that are out of
+ * order. Every primitive keeps it up to date, so checking whether the
+ * stack is sorted is O(1).
+ */
+typedef struct s_stack
+{
+	int	*data;					/**< Ring buffer storage */
+	int	capacity;				/**< Number of slots in `data` */
+	int	head;					/**< Physical index of the top element */
+	int	size;					/**< Number of elements in the stack */
+	int	breaks;					/**< Adjacent pairs in descending order */
+}	t_stack;
 
 /**
  * @struct s_array
  * @brief Core structure holding stack data and utility arrays.
  *
- * This structure simulates two stacks (A and B) using arrays.
- * It also stores the input arguments and the sorted target state.
+ * This structure holds the two stacks (A and B) as ring buffers.
+ * It also stores the sorted target state.
+ *
+ * Both stacks and `sorted_values` are carved out of a single `arena`
+ * allocation sized to the number of input values.
+ *
+ * In a portfolio run, `bound` points to the shortest log produced so far
+ * by a rival engine; an engine whose log reaches it gives up and sets
+ * `aborted` (see sort_aborted).
  */
 typedef struct s_array
 {
-	char	**args_array;				/**< Original input arguments as strings */
-	int		a_size;						/**< Dynamic size of stack A */				
-	int		a[PS_SIZE_MAX];				/**< Stack A */
-	int		b_size;						/**< Dynamic size of stack B */	
-	int		b[PS_SIZE_MAX];				/**< Stack B */
-	int		sorted_values[PS_SIZE_MAX];	
+	int				*arena;				/**< Storage of the arrays below */
+	t_stack			a;					/**< Stack A */
+	t_stack			b;					/**< Stack B */
+	int				*sorted_values;		/**< Sorted input values */
+	t_oplog			log;				/**< Operations emitted so far */
+	t_engine		engine;				/**< Engine for large inputs */
+	const char		*input;				/**< Input file, "-" or NULL */
+	bool			binary;				/**< Print operations in binary */
+	bool			batch;				/**< Solve one instance per line */
+	bool			explain;			/**< Print the engine choice */
+	atomic_size_t	*bound;				/**< Best rival length, or NULL */
+	bool			aborted;			/**< Gave up against `bound` */
 }	t_array;
 
+/**
+ * @struct s_profile
+ * @brief Presortedness of stack A, and the operations each engine would emit.
+ *
+ * `cost` is indexed by engine, with SIZE_MAX for an engine that is not
+ * predicted (see profile_stack).
+ */
+typedef struct s_profile
+{
+	int			size;					/**< Number of values */
+	int			runs;					/**< Ascending runs, top to bottom */
+	int			offset;					/**< Position of the smallest value */
+	int			inversions;				/**< Per mille of pairs out of order */
+	int			lis;					/**< Estimated increasing subsequence */
+	int			swaps;					/**< Swaps left once rotated, or -1 */
+	size_t		cost[ENGINE_PORTFOLIO];	/**< Predicted operations */
+	t_engine	engine;					/**< Engine predicted cheapest */
+}	t_profile;
+
+/**
+ * @struct s_scan
+ * @brief Decisions of the next values of a radix pass, one bit each.
+ */
+typedef struct s_scan
+{
+	unsigned char	mask[PS_SCAN_CHUNK / 8];	/**< Bit i: value i has a 1 */
+	int				bit;				/**< Bit tested by the pass */
+	int				count;				/**< Number of values read */
+}	t_scan;
+
+/**
+ * @struct s_flat
+ * @brief Stacks of `radix_sort` laid out flat, in their own storage.
+ */
+typedef struct s_flat
+{
+	t_array			*array;				/**< Array logging the operations */
+	int				*a;					/**< Stack A, top first */
+	int				na;					/**< Number of values in A */
+	int				*b;					/**< Stack B, bottom first */
+	int				nb;					/**< Number of values in B */
+	int				*tmp;				/**< Scratch room of a partition */
+	unsigned char	*mask;				/**< Decisions of the current split */
+}	t_flat;
+
+/**
+ * @struct s_worker
+ * @brief One engine of a portfolio run, sorting a private copy of A.
+ */
+typedef struct s_worker
+{
+	t_array		array;					/**< Private copy of the input */
+	pthread_t	thread;					/**< Thread running the engine */
+	bool		running;				/**< `thread` must be joined */
+}	t_worker;
+
+/**
+ * @struct s_task
+ * @brief One instance of a batch round: an input line and its result.
+ *
+ * The operations are stored in the log of the worker that solved it,
+ * from `offset`, so results never need an allocation of their own.
+ */
+typedef struct s_task
+{
+	const char	*line;					/**< First byte of the line */
+	const char	*end;					/**< End of the line, before `\n` */
+	int			worker;					/**< Worker holding the operations */
+	size_t		offset;					/**< First operation in its log */
+	size_t		size;					/**< Number of operations */
+	t_status	status;					/**< Outcome of the solve */
+}	t_task;
+
+/**
+ * @struct s_range
+ * @brief Slice of the round's tasks, claimed one at a time.
+ *
+ * Its owner and any thief claim through the same atomic counter, so a
+ * task is never solved twice and idle workers steal without locking.
+ */
+typedef struct s_range
+{
+	atomic_int	next;					/**< Next task to claim */
+	int			end;					/**< End of the slice */
+}	t_range;
+
+/**
+ * @struct s_batch_worker
+ * @brief Thread of `--batch`, with storage reused from one task to the next.
+ */
+typedef struct s_batch_worker
+{
+	t_array			array;				/**< Stacks of the current task */
+	t_oplog			results;			/**< Operations of the round */
+	t_range			range;				/**< Tasks owned by this worker */
+	pthread_t		thread;				/**< Helper thread of the worker */
+	bool			running;			/**< `thread` must be joined */
+	int				id;					/**< Index in `workers` */
+	struct s_batch	*batch;				/**< Batch the worker belongs to */
+}	t_batch_worker;
+
+/**
+ * @struct s_batch
+ * @brief State of `--batch`: the pending input, the round and its workers.
+ *
+ * `data` holds the input read so far; the bytes before `used` belong to
+ * tasks already printed. `lines` counts the complete lines of `data`
+ * up to `scanned`. Workers other than the first are helper threads,
+ * started once and woken for each round.
+ */
+typedef struct s_batch
+{
+	t_batch_worker	workers[PS_BATCH_THREADS];	/**< Thread pool */
+	int				count;				/**< Number of workers */
+	t_task			tasks[PS_BATCH_CHUNK];	/**< Tasks of the round */
+	int				size;				/**< Number of tasks of the round */
+	char			*data;				/**< Input bytes */
+	size_t			len;				/**< Bytes held by `data` */
+	size_t			capacity;			/**< Allocated length of `data` */
+	size_t			used;				/**< Bytes of printed tasks */
+	size_t			scanned;			/**< Bytes searched for newlines */
+	int				lines;				/**< Complete lines in `scanned` */
+	bool			eof;				/**< Standard input is exhausted */
+	pthread_mutex_t	lock;				/**< Guards the fields below */
+	pthread_cond_t	wake;				/**< A round started, or `stop` */
+	pthread_cond_t	done;				/**< Every helper is done */
+	int				round;				/**< Rounds started so far */
+	int				busy;				/**< Helpers still on the round */
+	int				started;			/**< Helper threads running */
+	bool			stop;				/**< Helpers must exit */
+}	t_batch;
+
+/**
+ * @struct s_buffer
+ * @brief Pending output waiting to be written to standard output.
+ */
+typedef struct s_buffer
+{
+	size_t	len;						/**< Number of bytes pending */
+	char	data[PS_BUFFER_SIZE];		/**< Pending bytes */
+}	t_buffer;
+
+/** @defgroup api Library Interface
+ *  @brief In-memory solver exported by libpush_swap.a; never exits.
+ *  @{
+ */
+t_status	ps_solve(const int *values, size_t n, t_oplog *out);
+t_status	ps_solve_engine(const int *values, size_t n, t_engine engine,
+				t_oplog *out);
+t_status	solve_array(t_array *array);
+/** @} */
+
+/** @defgroup batch Batch Mode
+ *  @brief Many instances per run, solved by a pool of threads.
+ *  @{
+ */
+int		run_batch(t_engine engine);
+bool	read_round(t_batch *batch);
+void	solve_round(t_batch *batch);
+void	drain_ranges(t_batch_worker *worker);
+bool	start_pool(t_batch *batch);
+void	stop_pool(t_batch *batch);
+void	solve_task(t_batch_worker *worker, t_task *task);
+/** @} */
+
 /** @defgroup utils Utility Functions
- *  @brief Function for error handling.
+ *  @brief Functions for error handling and buffered output.
  *  @{
  */
 void	perror_and_exit(void);
+void	format_size(size_t value, char *str);
+bool	init_array(t_array *array, int size);
+bool	reserve_array(t_array *array, int size);
+void	fit_array(t_array *array, int size);
+void	free_array(t_array *array);
+void	buffer_putstr(const char *str);
+void	buffer_putchar(char c);
+void	buffer_flush(void);
 /** @} */
 
 /** @defgroup parsing Argument Parsing
  *  @brief Functions for validating and converting CLI arguments.
  *  @{
  */
+int		parse_options(t_array *array, int argc, char **argv);
 void	parse_arguments(t_array *array, int argc, char **argv);
+void	parse_input(t_array *array);
+const char	*read_number(const char *str, const char *end, int *value);
+int		max_tokens(const char *str, const char *end);
+bool	convert_tokens(t_array *array, const char *str, const char *end,
+			bool any_space);
+/** @} */
+
+/** @defgroup stack Ring Buffer Stack
+ *  @brief Constant-time primitives on the circular stack storage.
+ *  @{
+ */
+int		stack_index(const t_stack *stack, int index);
+int		stack_get(const t_stack *stack, int index);
+void	stack_set(t_stack *stack, int index, int value);
+void	stack_push(t_stack *stack, int value);
+int		stack_pop(t_stack *stack);
+void	stack_count_breaks(t_stack *stack);
+bool	stack_is_sorted(const t_stack *stack);
 /** @} */
 
 /** @defgroup operation Stack Operations
@@ -86,6 +568,23 @@ void	rr(t_array *array);
 void	rra(t_array *array);
 void	rrb(t_array *array);
 void	rrr(t_array *array);
+void	run_operation(t_array *array, t_op op);
+/** @} */
+
+/** @defgroup oplog Operation Log
+ *  @brief Recording, optimizing and printing the operation stream.
+ *  @{
+ */
+void	oplog_append(t_oplog *log, t_op op);
+void	oplog_extend(t_oplog *log, const unsigned char *ops, size_t count);
+void	oplog_optimize(t_oplog *log, int values);
+void	oplog_collapse_rotations(t_oplog *log, int values);
+void	oplog_print(const t_oplog *log);
+void	oplog_print_binary(const t_oplog *log);
+bool	oplog_decode(t_oplog *log, t_decoder *decoder, const char *block,
+			size_t bytes);
+bool	oplog_decode_end(const t_decoder *decoder);
+void	oplog_free(t_oplog *log);
 /** @} */
 
 /** @defgroup sorting Sorting Algorithms
@@ -93,9 +592,40 @@ void	rrr(t_array *array);
  *  @{
  */
 void	sort_array(t_array *array);
-void	sort_two(t_array *array);
+bool	sort_aborted(t_array *array);
+void	portfolio_sort(t_array *array);
+void	profile_stack(const t_stack *a, t_profile *profile);
+t_engine	explain_engine(t_array *array);
 void	sort_three(t_array *array);
-void	sort_four_and_five(t_array *array);
+void	rotate_min_to_top(t_array *array);
+/** @} */
+
+/** @defgroup optimal Optimal Small Sort
+ *  @brief Exhaustive search for minimal sequences on up to 8 values.
+ *  @{
+ */
+void	optimal_sort(t_array *array);
+void	table_sort(t_array *array);
+const unsigned char	*optimal_table(int size, int rank, int *len);
+void	run_search(t_search *search, int start, int goal);
+int		encode_state(const t_state *state);
+void	decode_state(t_state *state, int code);
+bool	apply_state_op(t_state *state, t_op op);
+/** @} */
+
+/** @defgroup turk Turk Sort Logic
+ *  @brief Chunked pushes to B and cheapest-cost reinsertion into A.
+ *  @{
+ */
+void	turk_sort(t_array *array);
+void	lis_sort(t_array *array);
+void	rotation_sort(t_array *array);
+int		count_rotated_swaps(const t_stack *a);
+bool	rotation_swapped_at(const t_stack *a, int pos);
+void	plan_rotation_sweep(const t_stack *a, int legs[2]);
+int		find_target_position(const t_stack *a, int value);
+t_move	cheapest_move(t_array *array);
+void	apply_move(t_array *array, t_move move);
 /** @} */
 
 /** @defgroup radix Radix Sort Logic
@@ -103,7 +633,19 @@ void	sort_four_and_five(t_array *array);
  *  @{
  */
 void	radix_sort(t_array *array);
-void	assign_indices(t_array *array);
+void	radix_sort_sim(t_array *array);
+bool	flat_init(t_flat *flat, t_array *array);
+void	flat_finish(t_flat *flat);
+void	flat_mask(t_flat *flat, int *values, int count, int bit);
+int		flat_sorted_from(const int *values, int count);
+void	ternary_sort(t_array *array);
+void	radix_scan(const t_stack *stack, int count, int bit, t_scan *scan);
+void	scan_scalar(t_scan *scan, const int *values, int count);
+# if PS_SCAN_X86
+void	scan_avx2(t_scan *scan, const int *values, int count);
+void	scan_sse2(t_scan *scan, const int *values, int count);
+# endif
+bool	assign_indices(t_array *array);
 void	give_values_back(t_array *array);
 /** @} */
 
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:42:57 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 09:58:38 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file batch.c
+ * @brief Entry point of `--batch`: many instances in one run.
+ *
+ * Each line of standard input is solved as its own instance, and the
+ * results are printed in input order. Each result starts with a line
+ * holding its number of operations, followed by that many instructions;
+ * an invalid instance gives a single `Error` line instead. Process
+ * startup and allocations are paid once for the whole stream rather
+ * than once per instance.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup batch
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Prints the results of the round in input order.
+ *
+ * An allocation failure in any worker aborts the whole run.
+ *
+ * @param batch Batch state, with the round solved.
+ *
+ * @ingroup batch
+ * @see format_size
+ * @see oplog_print
+ */
+static void	print_round(const t_batch *batch)
+{
+	const t_task	*task;
+	t_oplog			view;
+	char			digits[PS_SIZE_DIGITS];
+	int				i;
+
+	i = 0;
+	while (i < batch->size)
+	{
+		task = &batch->tasks[i++];
+		if (task->status == PS_ERROR_ALLOC)
+			perror_and_exit();
+		if (task->status != PS_OK)
+			buffer_putstr("Error\n");
+		else
+		{
+			format_size(task->size, digits);
+			buffer_putstr(digits);
+			buffer_putchar('\n');
+			view.ops = batch->workers[task->worker].results.ops + task->offset;
+			view.size = task->size;
+			oplog_print(&view);
+		}
+	}
+}
+
+/**
+ * @brief Allocates the batch state and sizes the pool to the machine.
+ *
+ * @param engine Engine used above PS_OPTIMAL_MAX values.
+ * @return The batch state, or NULL if the allocation failed.
+ *
+ * @ingroup batch
+ */
+static t_batch	*init_batch(t_engine engine)
+{
+	t_batch	*batch;
+	long	cpus;
+	int		i;
+
+	batch = malloc(sizeof(t_batch));
+	if (!batch)
+		return (NULL);
+	ft_memset(batch, 0, sizeof(t_batch));
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	batch->count = 1;
+	if (cpus > 1)
+		batch->count = PS_BATCH_THREADS;
+	if (cpus > 1 && cpus < PS_BATCH_THREADS)
+		batch->count = (int)cpus;
+	i = 0;
+	while (i < batch->count)
+	{
+		batch->workers[i].id = i;
+		batch->workers[i].batch = batch;
+		batch->workers[i++].array.engine = engine;
+	}
+	return (batch);
+}
+
+/**
+ * @brief Stops the pool and releases the storage of every worker.
+ *
+ * @param batch Batch state.
+ *
+ * @ingroup batch
+ * @see stop_pool
+ */
+static void	free_batch(t_batch *batch)
+{
+	int	i;
+
+	stop_pool(batch);
+	i = 0;
+	while (i < batch->count)
+	{
+		free_array(&batch->workers[i].array);
+		oplog_free(&batch->workers[i++].results);
+	}
+	free(batch->data);
+	free(batch);
+}
+
+/**
+ * @brief Solves every instance of standard input, round after round.
+ *
+ * Output is flushed after each round, so results stream out while the
+ * rest of the input is still being read.
+ *
+ * @param engine Engine used above PS_OPTIMAL_MAX values.
+ * @return EXIT_SUCCESS. Exits with an error on read or allocation
+ *         failure.
+ *
+ * @ingroup batch
+ * @see start_pool
+ * @see read_round
+ * @see solve_round
+ * @see print_round
+ */
+int	run_batch(t_engine engine)
+{
+	t_batch	*batch;
+	bool	valid;
+
+	batch = init_batch(engine);
+	if (!batch || !start_pool(batch))
+		perror_and_exit();
+	valid = read_round(batch);
+	while (valid && batch->size > 0)
+	{
+		solve_round(batch);
+		print_round(batch);
+		buffer_flush();
+		valid = read_round(batch);
+	}
+	free_batch(batch);
+	if (!valid)
+		perror_and_exit();
+	return (EXIT_SUCCESS);
+}
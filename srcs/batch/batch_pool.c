@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_pool.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:35:44 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:51 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file batch_pool.c
+ * @brief Work-stealing pool solving the tasks of a `--batch` round.
+ *
+ * The tasks of a round are split into one contiguous range per worker.
+ * A worker first drains its own range, then steals from the ranges of
+ * the others in turn. Owner and thieves claim through the same atomic
+ * counter, so uneven instances still keep every thread busy and no lock
+ * is taken while solving. The calling thread is worker 0; the others are
+ * the helper threads of `start_pool`, woken once per round.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup batch
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Claims the next task of a range.
+ *
+ * @param range Range to claim from.
+ * @return Index of the task, or -1 if the range is drained.
+ *
+ * @ingroup batch
+ */
+static int	claim_task(t_range *range)
+{
+	int	task;
+
+	task = atomic_fetch_add_explicit(&range->next, 1, memory_order_relaxed);
+	if (task < range->end)
+		return (task);
+	return (-1);
+}
+
+/**
+ * @brief Solves tasks of the round: its own range, then every other one.
+ *
+ * @param worker Worker solving the tasks.
+ *
+ * @ingroup batch
+ * @see claim_task
+ * @see solve_task
+ */
+void	drain_ranges(t_batch_worker *worker)
+{
+	t_batch	*batch;
+	int		victim;
+	int		task;
+
+	batch = worker->batch;
+	victim = 0;
+	while (victim < batch->count)
+	{
+		task = claim_task(
+				&batch->workers[(worker->id + victim) % batch->count].range);
+		if (task < 0)
+			victim++;
+		else
+			solve_task(worker, &batch->tasks[task]);
+	}
+}
+
+/**
+ * @brief Gives every worker an equal slice of the round's tasks.
+ *
+ * @param batch Batch state.
+ *
+ * @ingroup batch
+ */
+static void	split_ranges(t_batch *batch)
+{
+	t_batch_worker	*worker;
+	int				i;
+
+	i = 0;
+	while (i < batch->count)
+	{
+		worker = &batch->workers[i];
+		worker->results.size = 0;
+		worker->results.failed = false;
+		atomic_store(&worker->range.next, batch->size * i / batch->count);
+		worker->range.end = batch->size * (i + 1) / batch->count;
+		i++;
+	}
+}
+
+/**
+ * @brief Solves every task of the round on the pool.
+ *
+ * Wakes the helper threads, drains the ranges alongside them, and waits
+ * for the last one to finish. The ranges of workers without a thread are
+ * stolen by the others.
+ *
+ * @param batch Batch state, with the round's tasks set.
+ *
+ * @ingroup batch
+ * @see split_ranges
+ * @see drain_ranges
+ */
+void	solve_round(t_batch *batch)
+{
+	split_ranges(batch);
+	pthread_mutex_lock(&batch->lock);
+	batch->busy = batch->started;
+	batch->round++;
+	pthread_cond_broadcast(&batch->wake);
+	pthread_mutex_unlock(&batch->lock);
+	drain_ranges(&batch->workers[0]);
+	pthread_mutex_lock(&batch->lock);
+	while (batch->busy > 0)
+		pthread_cond_wait(&batch->done, &batch->lock);
+	pthread_mutex_unlock(&batch->lock);
+}
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_read.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:21:18 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 00:21:18 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file batch_read.c
+ * @brief Reads the instances of `--batch` from standard input, by rounds.
+ *
+ * Each line of standard input is one instance, its values separated by
+ * whitespace. Input is read block by block until a round's worth of
+ * complete lines is waiting, so a stream of millions of instances is
+ * never held in memory at once.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup batch
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Appends one block of standard input to the pending bytes.
+ *
+ * The buffer grows when full, and `eof` is set once the input is
+ * exhausted.
+ *
+ * @param batch Batch state.
+ * @return false on read or allocation failure.
+ *
+ * @ingroup batch
+ */
+static bool	read_block(t_batch *batch)
+{
+	char	*grown;
+	ssize_t	bytes;
+
+	if (batch->len == batch->capacity)
+	{
+		grown = malloc(batch->capacity * 2 + PS_READ_BLOCK);
+		if (!grown)
+			return (false);
+		if (batch->len > 0)
+			ft_memcpy(grown, batch->data, batch->len);
+		free(batch->data);
+		batch->data = grown;
+		batch->capacity = batch->capacity * 2 + PS_READ_BLOCK;
+	}
+	bytes = read(STDIN_FILENO, batch->data + batch->len,
+			batch->capacity - batch->len);
+	if (bytes < 0)
+		return (false);
+	batch->eof = (bytes == 0);
+	batch->len += bytes;
+	return (true);
+}
+
+/**
+ * @brief Counts the complete lines among the bytes read since last time.
+ *
+ * @param batch Batch state.
+ *
+ * @ingroup batch
+ */
+static void	count_lines(t_batch *batch)
+{
+	while (batch->scanned < batch->len)
+	{
+		if (batch->data[batch->scanned] == '\n')
+			batch->lines++;
+		batch->scanned++;
+	}
+}
+
+/**
+ * @brief Drops the bytes of the instances printed by the previous round.
+ *
+ * @param batch Batch state.
+ *
+ * @ingroup batch
+ */
+static void	drop_used(t_batch *batch)
+{
+	if (batch->used == 0)
+		return ;
+	ft_memmove(batch->data, batch->data + batch->used,
+		batch->len - batch->used);
+	batch->len -= batch->used;
+	batch->scanned -= batch->used;
+	batch->used = 0;
+}
+
+/**
+ * @brief Turns the complete lines waiting in `data` into tasks.
+ *
+ * At most PS_BATCH_CHUNK lines are taken. A last line without a newline
+ * only counts once the input is exhausted.
+ *
+ * @param batch Batch state.
+ *
+ * @ingroup batch
+ */
+static void	split_tasks(t_batch *batch)
+{
+	char	*line;
+	char	*end;
+	char	*stop;
+
+	batch->size = 0;
+	line = batch->data;
+	stop = batch->data + batch->len;
+	while (batch->size < PS_BATCH_CHUNK && line < stop)
+	{
+		end = ft_memchr(line, '\n', stop - line);
+		if (!end && !batch->eof)
+			break ;
+		if (end)
+			batch->lines--;
+		else
+			end = stop;
+		batch->tasks[batch->size].line = line;
+		batch->tasks[batch->size++].end = end;
+		line = end + (end < stop);
+	}
+	batch->used = line - batch->data;
+}
+
+/**
+ * @brief Reads the instances of the next round.
+ *
+ * Reading stops once PS_BATCH_CHUNK complete lines, or PS_BATCH_BYTES
+ * bytes holding at least one line, are waiting. No task is set up once
+ * the input is exhausted.
+ *
+ * @param batch Batch state.
+ * @return false on read or allocation failure.
+ *
+ * @ingroup batch
+ * @see read_block
+ * @see split_tasks
+ */
+bool	read_round(t_batch *batch)
+{
+	drop_used(batch);
+	while (!batch->eof && batch->lines < PS_BATCH_CHUNK
+		&& (batch->lines == 0 || batch->len < PS_BATCH_BYTES))
+	{
+		if (!read_block(batch))
+			return (false);
+		count_lines(batch);
+	}
+	split_tasks(batch);
+	return (true);
+}
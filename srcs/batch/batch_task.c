@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_task.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:28:31 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 16:57:12 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file batch_task.c
+ * @brief Solves one instance of `--batch` inside a worker.
+ *
+ * The worker's stacks and log are reused from one instance to the next,
+ * and the operations are appended to the worker's results, so a warm
+ * worker solves instances without allocating.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup batch
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Converts one line into stack A and solves it.
+ *
+ * An empty line is an instance with nothing to sort. The stacks are
+ * reserved for as many values as the line can hold, so the line is read
+ * only once.
+ *
+ * @param array Reused stacks of the worker.
+ * @param line First byte of the line.
+ * @param end End of the line.
+ * @return PS_OK, or the reason the instance has no solution.
+ *
+ * @ingroup batch
+ * @see max_tokens
+ * @see reserve_array
+ * @see convert_tokens
+ * @see solve_array
+ */
+static t_status	solve_line(t_array *array, const char *line, const char *end)
+{
+	int	size;
+
+	size = max_tokens(line, end);
+	if (size < 0 || !reserve_array(array, size))
+		return (PS_ERROR_ALLOC);
+	if (!convert_tokens(array, line, end, true))
+		return (PS_ERROR_INPUT);
+	if (array->a.size == 0)
+		return (PS_OK);
+	stack_count_breaks(&array->a);
+	return (solve_array(array));
+}
+
+/**
+ * @brief Solves a task and stores its operations in the worker's results.
+ *
+ * @param worker Worker solving the task.
+ * @param task Task to solve.
+ *
+ * @ingroup batch
+ * @see solve_line
+ */
+void	solve_task(t_batch_worker *worker, t_task *task)
+{
+	t_array	*array;
+
+	array = &worker->array;
+	task->worker = worker->id;
+	task->offset = worker->results.size;
+	task->size = 0;
+	task->status = solve_line(array, task->line, task->end);
+	if (task->status != PS_OK || array->log.size == 0)
+		return ;
+	oplog_extend(&worker->results, array->log.ops, array->log.size);
+	task->size = array->log.size;
+	if (worker->results.failed)
+		task->status = PS_ERROR_ALLOC;
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_threads.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:44:12 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 09:44:12 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file batch_threads.c
+ * @brief Helper threads of `--batch`, started once for the whole run.
+ *
+ * Each helper sleeps until `solve_round` starts a round, drains the
+ * ranges of that round, and reports back, so threads are created once
+ * instead of once per round, and each keeps its stacks and its results
+ * log from one round to the next.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup batch
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Helper body: drains each round as it starts, until stopped.
+ *
+ * @param arg The `t_batch_worker` to run.
+ * @return Always NULL.
+ *
+ * @ingroup batch
+ * @see drain_ranges
+ */
+static void	*run_helper(void *arg)
+{
+	t_batch_worker	*worker;
+	t_batch			*batch;
+	int				seen;
+
+	worker = arg;
+	batch = worker->batch;
+	seen = 0;
+	pthread_mutex_lock(&batch->lock);
+	while (!batch->stop)
+	{
+		if (batch->round == seen)
+			pthread_cond_wait(&batch->wake, &batch->lock);
+		else
+		{
+			seen = batch->round;
+			pthread_mutex_unlock(&batch->lock);
+			drain_ranges(worker);
+			pthread_mutex_lock(&batch->lock);
+			if (--batch->busy == 0)
+				pthread_cond_signal(&batch->done);
+		}
+	}
+	pthread_mutex_unlock(&batch->lock);
+	return (NULL);
+}
+
+/**
+ * @brief Starts a helper thread for every worker but the first.
+ *
+ * A helper that cannot be created simply has its range stolen by the
+ * others at each round.
+ *
+ * @param batch Batch state, with its workers set up.
+ * @return false if the lock could not be set up.
+ *
+ * @ingroup batch
+ * @see run_helper
+ */
+bool	start_pool(t_batch *batch)
+{
+	t_batch_worker	*worker;
+	int				i;
+
+	if (pthread_mutex_init(&batch->lock, NULL) != 0)
+		return (false);
+	if (pthread_cond_init(&batch->wake, NULL) != 0
+		|| pthread_cond_init(&batch->done, NULL) != 0)
+		return (false);
+	i = 1;
+	while (i < batch->count)
+	{
+		worker = &batch->workers[i++];
+		worker->running = pthread_create(&worker->thread, NULL, run_helper,
+				worker) == 0;
+		batch->started += worker->running;
+	}
+	return (true);
+}
+
+/**
+ * @brief Stops and joins the helper threads.
+ *
+ * @param batch Batch state, with no round in progress.
+ *
+ * @ingroup batch
+ */
+void	stop_pool(t_batch *batch)
+{
+	int	i;
+
+	pthread_mutex_lock(&batch->lock);
+	batch->stop = true;
+	pthread_cond_broadcast(&batch->wake);
+	pthread_mutex_unlock(&batch->lock);
+	i = 1;
+	while (i < batch->count)
+	{
+		if (batch->workers[i].running)
+			pthread_join(batch->workers[i].thread, NULL);
+		i++;
+	}
+	pthread_cond_destroy(&batch->done);
+	pthread_cond_destroy(&batch->wake);
+	pthread_mutex_destroy(&batch->lock);
+}
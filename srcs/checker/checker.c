@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   checker.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:06:02 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 22:54:42 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file checker.c
+ * @brief Entry point of the checker program.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup checker
+ */
+#include "checker.h"
+
+/**
+ * @brief Main function of the checker program.
+ *
+ * Parses the arguments like push_swap, runs the instructions read from
+ * standard input, then prints OK if stack A is sorted and stack B is
+ * empty, KO otherwise. Invalid arguments or instructions print Error.
+ * `checker --file PATH` reads the values from a file, for inputs too
+ * large for the command line; standard input is kept for instructions.
+ *
+ * @param argc Argument count.
+ * @param argv Argument values.
+ * @return Always returns EXIT_SUCCESS once the instructions are checked.
+ *
+ * @ingroup checker
+ * @see parse_arguments
+ * @see parse_input
+ * @see assign_indices
+ * @see read_instructions
+ * @see stack_is_sorted
+ */
+int	main(int argc, char **argv)
+{
+	t_array	array;
+
+	if (argc < 2)
+		return (EXIT_SUCCESS);
+	ft_memset(&array, 0, sizeof(t_array));
+	if (argc == 3 && ft_strncmp(argv[1], "--file", 7) == 0)
+	{
+		array.input = argv[2];
+		parse_input(&array);
+	}
+	else
+		parse_arguments(&array, argc, argv);
+	if (!assign_indices(&array))
+		perror_and_exit();
+	read_instructions(&array);
+	if (stack_is_sorted(&array.a) && array.b.size == 0)
+		buffer_putstr("OK\n");
+	else
+		buffer_putstr("KO\n");
+	buffer_flush();
+	free_array(&array);
+	return (EXIT_SUCCESS);
+}
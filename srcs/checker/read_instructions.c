@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_instructions.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:58:49 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 23:01:55 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file read_instructions.c
+ * @brief Streaming reader for the instructions given to the checker.
+ *
+ * Standard input is read in CHECKER_BLOCK chunks. Each chunk is decoded
+ * into a log of operation codes, in either the text or the binary
+ * format (see oplog_decode.c), and then run before the next read.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup checker
+ */
+#include "checker.h"
+
+/**
+ * @brief Runs every operation decoded from one block.
+ *
+ * Operations run through the regular stack engine, which also records
+ * them; the checker never prints them, so that log is emptied as well
+ * to keep memory flat whatever the input length.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param input Operations decoded from the block, emptied afterwards.
+ *
+ * @ingroup checker
+ * @see run_operation
+ */
+static void	run_input(t_array *array, t_oplog *input)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < input->size)
+		run_operation(array, input->ops[i++]);
+	input->size = 0;
+	array->log.size = 0;
+}
+
+/**
+ * @brief Reads and runs every instruction from standard input.
+ *
+ * An invalid instruction, a read failure or a stream ending in the
+ * middle of an instruction is an error.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup checker
+ * @see oplog_decode
+ * @see run_input
+ */
+void	read_instructions(t_array *array)
+{
+	static char	block[CHECKER_BLOCK];
+	t_decoder	decoder;
+	t_oplog		input;
+	ssize_t		bytes;
+
+	ft_memset(&decoder, 0, sizeof(t_decoder));
+	ft_memset(&input, 0, sizeof(t_oplog));
+	bytes = read(STDIN_FILENO, block, CHECKER_BLOCK);
+	while (bytes > 0)
+	{
+		if (!oplog_decode(&input, &decoder, block, bytes) || input.failed)
+			perror_and_exit();
+		run_input(array, &input);
+		bytes = read(STDIN_FILENO, block, CHECKER_BLOCK);
+	}
+	oplog_free(&input);
+	if (bytes < 0 || !oplog_decode_end(&decoder))
+		perror_and_exit();
+}
@@ -6,16 +6,16 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/11 13:29:38 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 08:54:03 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:18:51 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
-
 /**
  * @file main.c
  * @brief Entry point of the push_swap program.
  *
- * Initializes the main stack structure, parses command-line arguments,
- * and triggers the appropriate sorting logic based on stack size.
+ * Command-line layer over `solve_array`: parses the options and the
+ * values, solves them in place in the parsed array, then prints the
+ * operations and turns any failure into the usual `Error` message.
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -26,26 +26,80 @@
  */
 #include "push_swap.h"
 
+/**
+ * @brief Prints the solution in the requested format and releases the
+ *        array.
+ *
+ * @param array Solved array; its log holds the operations.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if there is nothing to print
+ *         because the input is already sorted.
+ *
+ * @ingroup utils
+ * @see oplog_print
+ * @see oplog_print_binary
+ */
+static int	print_solution(t_array *array)
+{
+	int	status;
+
+	status = EXIT_FAILURE;
+	if (array->log.size > 0)
+	{
+		if (array->binary)
+			oplog_print_binary(&array->log);
+		else
+			oplog_print(&array->log);
+		buffer_flush();
+		status = EXIT_SUCCESS;
+	}
+	free_array(array);
+	return (status);
+}
+
 /**
  * @brief Main function of the push_swap program.
  *
- * Initializes the stack structure, parses arguments, and sorts the stack
- * using the most efficient strategy available.
+ * Parses options and values, solves them in place with `solve_array`,
+ * so no second copy of the input is made, then prints the operations to
+ * standard output. An input that is already sorted exits without any
+ * operation. `--explain` profiles the input first and passes the engine
+ * it picks on. `--batch` hands standard input over to `run_batch`
+ * instead.
  *
  * @param argc Argument count.
  * @param argv Argument values.
- * @return Always returns EXIT_SUCCESS.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if the input is already sorted.
  *
  * @ingroup utils
+ * @see parse_options
  * @see parse_arguments
- * @see sort_array
+ * @see parse_input
+ * @see explain_engine
+ * @see solve_array
+ * @see run_batch
+ * @see print_solution
  */
 int	main(int argc, char **argv)
 {
-	t_array	array;
+	t_array		array;
+	t_status	status;
+	int			first;
 
 	ft_memset(&array, 0, sizeof(t_array));
-	parse_arguments(&array, argc, argv);
-	sort_array(&array);
-	return (EXIT_SUCCESS);
+	first = parse_options(&array, argc, argv);
+	if (array.batch)
+		return (run_batch(array.engine));
+	if (array.input)
+		parse_input(&array);
+	else
+		parse_arguments(&array, argc - first + 1, argv + first - 1);
+	if (array.explain)
+		array.engine = explain_engine(&array);
+	status = solve_array(&array);
+	if (status != PS_OK)
+	{
+		free_array(&array);
+		perror_and_exit();
+	}
+	return (print_solution(&array));
 }
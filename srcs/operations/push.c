@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/12 16:20:10 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/27 14:22:44 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/17 12:12:25 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,7 @@
  *
  * This file defines the logic for the `pa` and `pb` operations, which move
  * the top element from one stack to the other. A static helper function,
- * `push`, performs the core memory manipulations and is used by both.
+ * `push`, pops from one ring buffer and pushes onto the other in O(1).
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -30,39 +30,31 @@
 /**
  * @brief Push the top element from one stack to another.
  *
- * This function copies the top element from `src` to `dst`, adjusts the
- * memory layout using `ft_memmove` for both source and destination, and
- * updates their respective sizes.
+ * This function pops the top element of `src` and pushes it on top of
+ * `dst`. Both stacks are ring buffers, so only their heads and sizes move.
  *
- * @param src Pointer to source stack array.
- * @param dst Pointer to destination stack array.
- * @param size_src Pointer to the size of the source stack.
- * @param size_dst Pointer to the size of the destination stack.
+ * @param src Pointer to the source stack.
+ * @param dst Pointer to the destination stack.
  *
  * @note No operation is performed if the source stack is empty.
  *
  * @ingroup operations
+ * @see stack_pop
+ * @see stack_push
  * @see pa
  * @see pb
  */
-static void	push(int *src, int *dst, int *size_src, int *size_dst)
+static void	push(t_stack *src, t_stack *dst)
 {
-	if (*size_src > 0)
-	{
-		if (*size_dst > 0)
-			ft_memmove(&dst[1], dst, (*size_dst) * sizeof(int));
-		dst[0] = src[0];
-		if (*size_src > 1)
-			ft_memmove(src, &src[1], (*size_src - 1) * sizeof(int));
-		(*size_src)--;
-		(*size_dst)++;
-	}
+	if (src->size > 0)
+		stack_push(dst, stack_pop(src));
 }
 
 /**
  * @brief Push the top element from stack B to stack A.
  *
- * This function performs the `pa` operation and logs it to standard output.
+ * This function performs the `pa` operation and records it in the
+ * operation log.
  *
  * @param array Pointer to the stack structure.
  *
@@ -71,14 +63,15 @@ static void	push(int *src, int *dst, int *size_src, int *size_dst)
  */
 void	pa(t_array *array)
 {
-	push(array->b, array->a, &array->b_size, &array->a_size);
-	ft_putstr_fd("pa\n", 1);
+	push(&array->b, &array->a);
+	oplog_append(&array->log, OP_PA);
 }
 
 /**
  * @brief Push the top element from stack A to stack B.
  *
- * This function performs the `pb` operation and logs it to standard output.
+ * This function performs the `pb` operation and records it in the
+ * operation log.
  *
  * @param array Pointer to the stack structure.
  *
@@ -87,6 +80,6 @@ void	pa(t_array *array)
  */
 void	pb(t_array *array)
 {
-	push(array->a, array->b, &array->a_size, &array->b_size);
-	ft_putstr_fd("pb\n", 1);
+	push(&array->a, &array->b);
+	oplog_append(&array->log, OP_PB);
 }
@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/12 16:26:58 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/27 14:25:58 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/17 13:24:35 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,8 +15,8 @@
  * @brief Implements reverse rotate operations for push_swap.
  *
  * Defines the reverse rotation logic and applies it to stacks A, B, or both.
- * The reverse rotation shifts all elements down by one, moving the last
- * element to the top.
+ * The reverse rotation moves the last element to the top, which on a ring
+ * buffer only means moving the head back by one slot.
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -28,38 +28,36 @@
 #include <push_swap.h>
 
 /**
- * @brief Shifts all elements of a stack down by one position.
+ * @brief Moves the bottom element of a stack to its top.
  *
- * The last element becomes the new top. No action is performed if the
- * stack has fewer than 2 elements.
+ * The head moves back by one slot and receives the bottom value, so the
+ * operation runs in constant time. Only the pairs (second to last,
+ * bottom) and (bottom, top) change, so the break count is updated from
+ * those. No action is performed if the stack has fewer than 2 elements.
  *
- * @param array The stack array to reverse rotate.
- * @param size The number of elements in the stack.
+ * @param stack The stack to reverse rotate.
  *
  * @ingroup operations
+ * @see stack_index
  */
-void	reverse_rotate(int *array, int size)
+void	reverse_rotate(t_stack *stack)
 {
-	int	last;
-	int	i;
+	int	bottom;
 
-	if (size > 1)
+	if (stack->size > 1)
 	{
-		last = array[size - 1];
-		i = size - 1;
-		while (i > 0)
-		{
-			array[i] = array[i - 1];
-			i--;
-		}
-		array[0] = last;
+		bottom = stack->data[stack_index(stack, stack->size - 1)];
+		stack->breaks -= stack_get(stack, stack->size - 2) > bottom;
+		stack->breaks += bottom > stack->data[stack->head];
+		stack->head = stack_index(stack, -1);
+		stack->data[stack->head] = bottom;
 	}
 }
 
 /**
  * @brief Performs a reverse rotation on stack A.
  *
- * Moves the bottom element of stack A to the top and prints the operation.
+ * Moves the bottom element of stack A to the top and records the operation.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -68,15 +66,15 @@ void	reverse_rotate(int *array, int size)
  */
 void	rra(t_array *array)
 {
-	reverse_rotate(array->a, array->a_size);
-	ft_putstr_fd("rra\n", 1);
+	reverse_rotate(&array->a);
+	oplog_append(&array->log, OP_RRA);
 }
 
 
 /**
  * @brief Performs a reverse rotation on stack B.
  *
- * Moves the bottom element of stack B to the top and prints the operation.
+ * Moves the bottom element of stack B to the top and records the operation.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -85,14 +83,14 @@ void	rra(t_array *array)
  */
 void	rrb(t_array *array)
 {
-	reverse_rotate(array->b, array->b_size);
-	ft_putstr_fd("rrb\n", 1);
+	reverse_rotate(&array->b);
+	oplog_append(&array->log, OP_RRB);
 }
 
 /**
  * @brief Performs a reverse rotation on both stacks A and B.
  *
- * Moves the bottom element of both stacks to the top and prints the
+ * Moves the bottom element of both stacks to the top and records the
  * operation.
  *
  * @param array Pointer to the main stack structure.
@@ -102,7 +100,7 @@ void	rrb(t_array *array)
  */
 void	rrr(t_array *array)
 {
-	reverse_rotate(array->a, array->a_size);
-	reverse_rotate(array->b, array->b_size);
-	ft_putstr_fd("rrr\n", 1);
+	reverse_rotate(&array->a);
+	reverse_rotate(&array->b);
+	oplog_append(&array->log, OP_RRR);
 }
@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/12 16:24:46 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/27 14:27:42 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/17 13:31:48 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,8 +15,8 @@
  * @brief Implements rotate operations for push_swap.
  *
  * Defines the rotate logic and applies it to stacks A, B, or both. The rotate
- * operation shifts all elements up by one, moving the top element to the
- * bottom of the stack.
+ * operation moves the top element to the bottom of the stack, which on a
+ * ring buffer only means advancing the head by one slot.
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -28,38 +28,37 @@
 #include "push_swap.h"
 
 /**
- * @brief Shifts all elements of a stack up by one position.
+ * @brief Moves the top element of a stack to its bottom.
  *
- * The top element becomes the new bottom. No action is performed if the
- * stack has fewer than 2 elements.
+ * The top value is copied into the free slot right below the bottom and
+ * the head advances by one, so the operation runs in constant time. Only
+ * the pairs (top, second) and (bottom, top) change, so the break count is
+ * updated from those. No action is performed if the stack has fewer than
+ * 2 elements.
  *
- * @param array The stack array to rotate.
- * @param size The number of elements in the stack.
+ * @param stack The stack to rotate.
  *
  * @ingroup operations
+ * @see stack_index
  */
-void	rotate(int *array, int size)
+void	rotate(t_stack *stack)
 {
-	int	first;
-	int	i;
+	int	top;
 
-	if (size > 1)
+	if (stack->size > 1)
 	{
-		first = array[0];
-		i = 0;
-		while (i < size - 1)
-		{
-			array[i] = array[i + 1];
-			i++;
-		}
-		array[size - 1] = first;
+		top = stack->data[stack->head];
+		stack->breaks -= top > stack_get(stack, 1);
+		stack->breaks += stack_get(stack, stack->size - 1) > top;
+		stack->data[stack_index(stack, stack->size)] = stack->data[stack->head];
+		stack->head = stack_index(stack, 1);
 	}
 }
 
 /**
  * @brief Performs a rotate operation on stack A.
  *
- * Moves the top element of stack A to the bottom and prints the operation.
+ * Moves the top element of stack A to the bottom and records the operation.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -68,14 +67,14 @@ void	rotate(int *array, int size)
  */
 void	ra(t_array *array)
 {
-	rotate(array->a, array->a_size);
-	ft_putstr_fd("ra\n", 1);
+	rotate(&array->a);
+	oplog_append(&array->log, OP_RA);
 }
 
 /**
  * @brief Performs a rotate operation on stack B.
  *
- * Moves the top element of stack B to the bottom and prints the operation.
+ * Moves the top element of stack B to the bottom and records the operation.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -84,14 +83,14 @@ void	ra(t_array *array)
  */
 void	rb(t_array *array)
 {
-	rotate(array->b, array->b_size);
-	ft_putstr_fd("rb\n", 1);
+	rotate(&array->b);
+	oplog_append(&array->log, OP_RB);
 }
 
 /**
  * @brief Performs a rotate operation on both stacks A and B.
  *
- * Moves the top element of both stacks to the bottom and prints the
+ * Moves the top element of both stacks to the bottom and records the
  * operation.
  *
  * @param array Pointer to the main stack structure.
@@ -101,7 +100,7 @@ void	rb(t_array *array)
  */
 void	rr(t_array *array)
 {
-	rotate(array->a, array->a_size);
-	rotate(array->b, array->b_size);
-	ft_putstr_fd("rr\n", 1);
+	rotate(&array->a);
+	rotate(&array->b);
+	oplog_append(&array->log, OP_RR);
 }
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   run_operation.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:41:42 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 15:41:42 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file run_operation.c
+ * @brief Runs a stack operation from its code.
+ *
+ * Lets strategies that compute their sequence up front (such as the
+ * optimal search) replay it through the regular operations.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup operations
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Performs and records the operation matching a code.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param op Code of the operation to run.
+ *
+ * @ingroup operations
+ */
+void	run_operation(t_array *array, t_op op)
+{
+	static void	(*const operations[OP_COUNT])(t_array *) = {sa, sb, ss,
+		pa, pb, ra, rb, rr, rra, rrb, rrr};
+
+	operations[op](array);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:19:13 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 14:36:45 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file stack.c
+ * @brief Ring buffer primitives backing stacks A and B.
+ *
+ * Each stack is a circular deque: the top element sits at `head` and the
+ * following elements wrap around the end of the storage. Logical indices
+ * (0 = top) are translated to physical slots here, so pushes, pops and
+ * rotations never have to shift the rest of the stack. Each primitive also
+ * updates the count of out-of-order adjacent pairs.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup stack
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Translates a logical stack index into a physical slot.
+ *
+ * Accepts indices in the range [-1, capacity], which is enough to address
+ * the slot just above the top and just below the bottom.
+ *
+ * @param stack Pointer to the stack.
+ * @param index Logical position, 0 being the top of the stack.
+ * @return Physical index into `stack->data`.
+ *
+ * @ingroup stack
+ */
+int	stack_index(const t_stack *stack, int index)
+{
+	index += stack->head;
+	if (index >= stack->capacity)
+		index -= stack->capacity;
+	else if (index < 0)
+		index += stack->capacity;
+	return (index);
+}
+
+/**
+ * @brief Returns the element at a logical position of the stack.
+ *
+ * @param stack Pointer to the stack.
+ * @param index Logical position, 0 being the top of the stack.
+ * @return The stored value.
+ *
+ * @ingroup stack
+ * @see stack_index
+ */
+int	stack_get(const t_stack *stack, int index)
+{
+	return (stack->data[stack_index(stack, index)]);
+}
+
+/**
+ * @brief Overwrites the element at a logical position of the stack.
+ *
+ * The pairs formed with the elements above and below are removed from
+ * the break count before the write and added back after it.
+ *
+ * @param stack Pointer to the stack.
+ * @param index Logical position, 0 being the top of the stack.
+ * @param value Value to store.
+ *
+ * @ingroup stack
+ * @see stack_index
+ */
+void	stack_set(t_stack *stack, int index, int value)
+{
+	int	slot;
+
+	slot = stack_index(stack, index);
+	if (index > 0)
+		stack->breaks -= stack_get(stack, index - 1) > stack->data[slot];
+	if (index < stack->size - 1)
+		stack->breaks -= stack->data[slot] > stack_get(stack, index + 1);
+	stack->data[slot] = value;
+	if (index > 0)
+		stack->breaks += stack_get(stack, index - 1) > value;
+	if (index < stack->size - 1)
+		stack->breaks += value > stack_get(stack, index + 1);
+}
+
+/**
+ * @brief Places a value on top of the stack.
+ *
+ * Moves `head` one slot backwards and stores the value there.
+ *
+ * @param stack Pointer to the stack.
+ * @param value Value to push.
+ *
+ * @ingroup stack
+ */
+void	stack_push(t_stack *stack, int value)
+{
+	if (stack->size > 0)
+		stack->breaks += value > stack->data[stack->head];
+	stack->head = stack_index(stack, -1);
+	stack->data[stack->head] = value;
+	stack->size++;
+}
+
+/**
+ * @brief Removes and returns the top element of the stack.
+ *
+ * The caller must make sure the stack is not empty.
+ *
+ * @param stack Pointer to the stack.
+ * @return The value that was on top.
+ *
+ * @ingroup stack
+ */
+int	stack_pop(t_stack *stack)
+{
+	int	value;
+
+	value = stack->data[stack->head];
+	if (stack->size > 1)
+		stack->breaks -= value > stack_get(stack, 1);
+	stack->head = stack_index(stack, 1);
+	stack->size--;
+	return (value);
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stack_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 09:26:26 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 13:46:14 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file stack_utils.c
+ * @brief Read-only helpers working on ring buffer stacks.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup stack
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Recomputes the break count of a stack from scratch.
+ *
+ * Needed after the storage has been filled directly rather than through
+ * the stack primitives, e.g. while parsing.
+ *
+ * @param stack Pointer to the stack.
+ *
+ * @ingroup stack
+ * @see stack_get
+ */
+void	stack_count_breaks(t_stack *stack)
+{
+	int	i;
+
+	stack->breaks = 0;
+	i = 1;
+	while (i < stack->size)
+	{
+		if (stack_get(stack, i - 1) > stack_get(stack, i))
+			stack->breaks++;
+		i++;
+	}
+}
+
+/**
+ * @brief Checks whether a stack is sorted in ascending order.
+ *
+ * Relies on the break count maintained by the stack primitives, so the
+ * check runs in constant time.
+ *
+ * @param stack Pointer to the stack.
+ * @return true if every element is smaller than the one below it.
+ *
+ * @ingroup stack
+ */
+bool	stack_is_sorted(const t_stack *stack)
+{
+	return (stack->breaks == 0);
+}
@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/12 16:20:45 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/27 14:29:02 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/17 13:53:27 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -29,29 +29,42 @@
 /**
  * @brief Swaps the first two elements of a stack.
  *
- * If the stack has fewer than two elements, no operation is performed.
+ * The break count is updated from the two pairs the swap affects. If the
+ * stack has fewer than two elements, no operation is performed.
  *
- * @param array The stack array to modify.
- * @param size The number of elements in the stack.
+ * @param stack The stack to modify.
  *
  * @ingroup operations
+ * @see stack_index
  */
-static void	swap(int *array, int size)
+static void	swap(t_stack *stack)
 {
+	int	second;
 	int	temp;
 
-	if (size > 1)
+	if (stack->size > 1)
 	{
-		temp = array[0];
-		array[0] = array[1];
-		array[1] = temp;
+		second = stack_index(stack, 1);
+		temp = stack->data[stack->head];
+		if (temp > stack->data[second])
+			stack->breaks--;
+		else
+			stack->breaks++;
+		if (stack->size > 2)
+		{
+			stack->breaks -= stack->data[second] > stack_get(stack, 2);
+			stack->breaks += temp > stack_get(stack, 2);
+		}
+		stack->data[stack->head] = stack->data[second];
+		stack->data[second] = temp;
 	}
 }
 
 /**
  * @brief Performs a swap on the top two elements of stack A.
  *
- * Executes the `sa` operation and logs it to standard output.
+ * Executes the `sa` operation and records it in the
+ * operation log.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -60,14 +73,15 @@ static void	swap(int *array, int size)
  */
 void	sa(t_array *array)
 {
-	swap(array->a, array->a_size);
-	ft_putstr_fd("sa\n", 1);
+	swap(&array->a);
+	oplog_append(&array->log, OP_SA);
 }
 
 /**
  * @brief Performs a swap on the top two elements of stack B.
  *
- * Executes the `sb` operation and logs it to standard output.
+ * Executes the `sb` operation and records it in the
+ * operation log.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -76,14 +90,15 @@ void	sa(t_array *array)
  */
 void	sb(t_array *array)
 {
-	swap(array->b, array->b_size);
-	ft_putstr_fd("sb\n", 1);
+	swap(&array->b);
+	oplog_append(&array->log, OP_SB);
 }
 
 /**
  * @brief Performs a swap on both stacks A and B simultaneously.
  *
- * Executes the `ss` operation and logs it to standard output.
+ * Executes the `ss` operation and records it in the
+ * operation log.
  *
  * @param array Pointer to the main stack structure.
  *
@@ -92,7 +107,7 @@ void	sb(t_array *array)
  */
 void	ss(t_array *array)
 {
-	swap(array->a, array->a_size);
-	swap(array->b, array->b_size);
-	ft_putstr_fd("ss\n", 1);
+	swap(&array->a);
+	swap(&array->b);
+	oplog_append(&array->log, OP_SS);
 }
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   oplog.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:43:33 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 22:11:24 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file oplog.c
+ * @brief Storage and printing of the operation log.
+ *
+ * Every stack operation appends its code to the log held in `t_array`.
+ * Once sorting is done the log goes through the peephole pass and is
+ * printed in one go through the output buffer.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup oplog
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Doubles the capacity of the operation log.
+ *
+ * On allocation failure the log is marked as failed and keeps refusing
+ * to grow, so no later operation lands after a gap. Callers check
+ * `failed` once the whole sequence has been produced.
+ *
+ * @param log Pointer to the operation log.
+ * @return true if the log has grown.
+ *
+ * @ingroup oplog
+ */
+static bool	oplog_grow(t_oplog *log)
+{
+	unsigned char	*ops;
+	size_t			capacity;
+
+	capacity = log->capacity * 2;
+	if (capacity == 0)
+		capacity = PS_OPLOG_INIT;
+	ops = NULL;
+	if (!log->failed)
+		ops = malloc(capacity);
+	log->failed = !ops;
+	if (!ops)
+		return (false);
+	if (log->size > 0)
+		ft_memcpy(ops, log->ops, log->size);
+	free(log->ops);
+	log->ops = ops;
+	log->capacity = capacity;
+	return (true);
+}
+
+/**
+ * @brief Records one operation at the end of the log.
+ *
+ * @param log Pointer to the operation log.
+ * @param op Code of the operation to record.
+ *
+ * @ingroup oplog
+ * @see oplog_grow
+ */
+void	oplog_append(t_oplog *log, t_op op)
+{
+	if (log->size == log->capacity && !oplog_grow(log))
+		return ;
+	log->ops[log->size++] = (unsigned char)op;
+}
+
+/**
+ * @brief Appends a block of already encoded operations to the log.
+ *
+ * @param log Operation log.
+ * @param ops Operation codes, one byte each.
+ * @param count Number of operations.
+ *
+ * @ingroup oplog
+ */
+void	oplog_extend(t_oplog *log, const unsigned char *ops, size_t count)
+{
+	while (log->capacity - log->size < count)
+	{
+		if (!oplog_grow(log))
+			return ;
+	}
+	ft_memcpy(log->ops + log->size, ops, count);
+	log->size += count;
+}
+
+/**
+ * @brief Writes every recorded operation to the output buffer.
+ *
+ * Each operation is printed on its own line, using its standard name.
+ *
+ * @param log Pointer to the operation log.
+ *
+ * @ingroup oplog
+ * @see buffer_putstr
+ */
+void	oplog_print(const t_oplog *log)
+{
+	static const char	*names[OP_COUNT] = {"sa\n", "sb\n", "ss\n", "pa\n",
+		"pb\n", "ra\n", "rb\n", "rr\n", "rra\n", "rrb\n", "rrr\n"};
+	size_t				i;
+
+	i = 0;
+	while (i < log->size)
+	{
+		buffer_putstr(names[log->ops[i]]);
+		i++;
+	}
+}
+
+/**
+ * @brief Releases the memory held by the operation log.
+ *
+ * @param log Pointer to the operation log.
+ *
+ * @ingroup oplog
+ */
+void	oplog_free(t_oplog *log)
+{
+	free(log->ops);
+	log->ops = NULL;
+	log->size = 0;
+	log->capacity = 0;
+	log->failed = false;
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   oplog_binary.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:47:04 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 19:47:04 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file oplog_binary.c
+ * @brief Compact binary output of the operation log.
+ *
+ * Each byte holds a run of up to PS_BINARY_RUN identical operations, so
+ * the long `ra`/`pa` runs of radix sort shrink to a fraction of a byte
+ * per operation, against 3 to 4 bytes in text.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup oplog
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Writes the log to the output buffer in the binary format.
+ *
+ * @param log Operation log to write.
+ *
+ * @ingroup oplog
+ * @see buffer_putchar
+ */
+void	oplog_print_binary(const t_oplog *log)
+{
+	size_t	i;
+	size_t	run;
+
+	buffer_putstr(PS_BINARY_MAGIC);
+	i = 0;
+	while (i < log->size)
+	{
+		run = 1;
+		while (i + run < log->size && run < PS_BINARY_RUN
+			&& log->ops[i + run] == log->ops[i])
+			run++;
+		buffer_putchar((char)(log->ops[i] << 4 | (run - 1)));
+		i += run;
+	}
+}
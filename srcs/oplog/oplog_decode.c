@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   oplog_decode.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:39:51 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 19:39:51 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file oplog_decode.c
+ * @brief Decodes operation streams, text or binary, into an operation log.
+ *
+ * Streams are fed block by block, so a text line or the binary signature
+ * may straddle two blocks; the unfinished part is kept in the decoder.
+ * The format is detected from the first byte of the stream.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup oplog
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Decodes one text instruction into an operation code.
+ *
+ * Each of the first three bytes maps to a letter code from 1 to 5 (0
+ * for anything else), and the three codes index a table holding every
+ * valid instruction. A third byte that is not a known letter is caught
+ * explicitly, since it would otherwise read like a two-byte line.
+ *
+ * @param decoder Decoder holding the line, zero padded to three bytes.
+ * @return Operation code, or -1 if the line is not a valid instruction.
+ *
+ * @ingroup oplog
+ */
+static int	decode_line(const t_decoder *decoder)
+{
+	static const unsigned char	letter[256] = {['a'] = 1, ['b'] = 2,
+		['s'] = 3, ['p'] = 4, ['r'] = 5};
+	static const unsigned char	ops[216] = {[114] = OP_SA + 1,
+		[120] = OP_SB + 1, [126] = OP_SS + 1, [150] = OP_PA + 1,
+		[156] = OP_PB + 1, [186] = OP_RA + 1, [192] = OP_RB + 1,
+		[210] = OP_RR + 1, [211] = OP_RRA + 1, [212] = OP_RRB + 1,
+		[215] = OP_RRR + 1};
+	int							third;
+
+	third = letter[decoder->pending[2]];
+	if (decoder->len == 3 && third == 0)
+		return (-1);
+	return (ops[letter[decoder->pending[0]] * 36
+			+ letter[decoder->pending[1]] * 6 + third] - 1);
+}
+
+/**
+ * @brief Decodes the bytes of a text stream.
+ *
+ * @param log Log receiving the operations.
+ * @param decoder Decoder state.
+ * @param block Bytes to decode.
+ * @param bytes Number of bytes in `block`.
+ * @return false on an unknown instruction or a line longer than 3 bytes.
+ *
+ * @ingroup oplog
+ * @see decode_line
+ */
+static bool	decode_text(t_oplog *log, t_decoder *decoder, const char *block,
+		size_t bytes)
+{
+	size_t	i;
+	int		op;
+
+	i = 0;
+	while (i < bytes)
+	{
+		if (block[i] == '\n')
+		{
+			op = decode_line(decoder);
+			if (op < 0)
+				return (false);
+			oplog_append(log, op);
+			ft_memset(decoder->pending, 0, sizeof(decoder->pending));
+			decoder->len = 0;
+		}
+		else if (decoder->len < 3)
+			decoder->pending[decoder->len++] = block[i];
+		else
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Decodes the bytes of a binary stream.
+ *
+ * The signature is checked first, then every byte expands into a run
+ * of one operation.
+ *
+ * @param log Log receiving the operations.
+ * @param decoder Decoder state.
+ * @param block Bytes to decode.
+ * @param bytes Number of bytes in `block`.
+ * @return false on a wrong signature or an unknown operation code.
+ *
+ * @ingroup oplog
+ */
+static bool	decode_binary(t_oplog *log, t_decoder *decoder, const char *block,
+		size_t bytes)
+{
+	unsigned char	run[PS_BINARY_RUN];
+	unsigned char	byte;
+	size_t			i;
+
+	i = 0;
+	while (i < bytes && decoder->len < 4)
+	{
+		if (block[i++] != PS_BINARY_MAGIC[decoder->len++])
+			return (false);
+	}
+	while (i < bytes)
+	{
+		byte = block[i++];
+		if (byte >> 4 >= OP_COUNT)
+			return (false);
+		ft_memset(run, byte >> 4, (byte & 0x0F) + 1);
+		oplog_extend(log, run, (byte & 0x0F) + 1);
+	}
+	return (true);
+}
+
+/**
+ * @brief Decodes one block of an operation stream into a log.
+ *
+ * @param log Log receiving the operations.
+ * @param decoder Decoder state, zeroed before the first block.
+ * @param block Bytes to decode.
+ * @param bytes Number of bytes in `block`.
+ * @return false if the block holds an invalid instruction.
+ *
+ * @ingroup oplog
+ * @see decode_text
+ * @see decode_binary
+ */
+bool	oplog_decode(t_oplog *log, t_decoder *decoder, const char *block,
+		size_t bytes)
+{
+	if (bytes == 0)
+		return (true);
+	if (decoder->format == FORMAT_UNKNOWN)
+	{
+		decoder->format = FORMAT_TEXT;
+		if (block[0] == PS_BINARY_MAGIC[0])
+			decoder->format = FORMAT_BINARY;
+	}
+	if (decoder->format == FORMAT_BINARY)
+		return (decode_binary(log, decoder, block, bytes));
+	return (decode_text(log, decoder, block, bytes));
+}
+
+/**
+ * @brief Checks that a stream did not stop in the middle of an instruction.
+ *
+ * @param decoder Decoder state after the last block.
+ * @return true if the stream ended cleanly.
+ *
+ * @ingroup oplog
+ */
+bool	oplog_decode_end(const t_decoder *decoder)
+{
+	if (decoder->format == FORMAT_BINARY)
+		return (decoder->len == 4);
+	return (decoder->len == 0);
+}
@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   peephole.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:50:46 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 10:27:30 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file peephole.c
+ * @brief Windowed rewrite pass shortening the operation log.
+ *
+ * Each operation is compared with the operations recorded before it:
+ * - `ra` + `rb` and `sa` + `sb` fuse into `rr` and `ss`
+ * - `ra` + `rra`, `pb` + `pa`, `sa` + `sa`... cancel out
+ * - `rr` + `rra` reduces to `rb`, `ss` + `sa` to `sb`, and so on
+ *
+ * An operation touching only stack A commutes with one touching only
+ * stack B, so the search walks back over such independent operations,
+ * up to PS_PEEPHOLE_WINDOW of them, before giving up.
+ *
+ * Cancelling `pb` + `pa` assumes the source stack was not empty, which
+ * holds for every sequence the sorting engines produce.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup oplog
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Returns which stacks an operation touches.
+ *
+ * @param op Operation code.
+ * @return 1 for stack A only, 2 for stack B only, 3 for both.
+ *
+ * @ingroup oplog
+ */
+static int	op_stacks(int op)
+{
+	static const int	stacks[OP_COUNT] = {1, 2, 3, 3, 3, 1, 2, 3, 1, 2, 3};
+
+	return (stacks[op]);
+}
+
+/**
+ * @brief Combines two rotations into their net rotation.
+ *
+ * Rotations are turned into (A, B) steps, added, and mapped back to a
+ * single operation when the sum is still expressible as one.
+ *
+ * @param first Earlier rotation.
+ * @param second Later rotation.
+ * @return The combined operation, OP_CANCEL or OP_NONE.
+ *
+ * @ingroup oplog
+ */
+static int	combine_rotations(int first, int second)
+{
+	static const int	step_a[OP_COUNT] = {0, 0, 0, 0, 0, 1, 0, 1, -1, 0, -1};
+	static const int	step_b[OP_COUNT] = {0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1};
+	static const int	result[9] = {OP_RRR, OP_RRA, OP_NONE, OP_RRB,
+		OP_CANCEL, OP_RB, OP_NONE, OP_RA, OP_RR};
+	int					a;
+	int					b;
+
+	a = step_a[first] + step_a[second];
+	b = step_b[first] + step_b[second];
+	if (a < -1 || a > 1 || b < -1 || b > 1)
+		return (OP_NONE);
+	return (result[(a + 1) * 3 + (b + 1)]);
+}
+
+/**
+ * @brief Returns the single operation equivalent to two operations.
+ *
+ * Swaps combine by toggling `sa` and `sb`, rotations by adding their
+ * steps, and pushes only cancel with the opposite push.
+ *
+ * @param first Earlier operation.
+ * @param second Later operation.
+ * @return The combined operation, OP_CANCEL or OP_NONE if no rule applies.
+ *
+ * @ingroup oplog
+ * @see combine_rotations
+ */
+static int	combine(int first, int second)
+{
+	static const int	swaps[4] = {OP_CANCEL, OP_SA, OP_SB, OP_SS};
+
+	if (first <= OP_SS && second <= OP_SS)
+		return (swaps[(first + 1) ^ (second + 1)]);
+	if (first >= OP_RA && second >= OP_RA)
+		return (combine_rotations(first, second));
+	if ((first == OP_PA && second == OP_PB)
+		|| (first == OP_PB && second == OP_PA))
+		return (OP_CANCEL);
+	return (OP_NONE);
+}
+
+/**
+ * @brief Tries to merge an operation into the already rewritten prefix.
+ *
+ * Walks back over the operations that commute with `op` until one of
+ * them combines with it. On a cancellation the partner is removed and
+ * the commuting operations after it shift down by one slot.
+ *
+ * @param ops Operation codes; `ops[0 .. *size)` is the rewritten prefix.
+ * @param size Pointer to the length of the prefix.
+ * @param op Operation to merge.
+ * @return true if `op` was absorbed, false if it must be appended.
+ *
+ * @ingroup oplog
+ * @see combine
+ */
+static bool	merge_backwards(unsigned char *ops, size_t *size, int op)
+{
+	size_t	j;
+	int		result;
+
+	j = *size;
+	while (j > 0 && *size - j < PS_PEEPHOLE_WINDOW)
+	{
+		j--;
+		result = combine(ops[j], op);
+		if (result == OP_CANCEL)
+		{
+			ft_memmove(ops + j, ops + j + 1, *size - j - 1);
+			(*size)--;
+			return (true);
+		}
+		if (result != OP_NONE)
+		{
+			ops[j] = (unsigned char)result;
+			return (true);
+		}
+		if (op_stacks(ops[j]) & op_stacks(op))
+			return (false);
+	}
+	return (false);
+}
+
+/**
+ * @brief Runs the rewrite passes until the log stops shrinking.
+ *
+ * Each pass rewrites the log in place with the peephole rules. A rewrite
+ * can expose a new pair (for example `rrr` followed by a freshly fused
+ * `rr`), so passes repeat until one of them leaves the log unchanged.
+ * The runs of rotations are collapsed after a pass only if the log
+ * changed since the last collapse (two runs joined once a `pb` + `pa`
+ * pair cancels, say), so the usual round is two passes and a single
+ * collapse instead of a collapse after every pass.
+ *
+ * @param log Pointer to the operation log.
+ * @param values Number of values, all in stack A before the first op.
+ *
+ * @ingroup oplog
+ * @see merge_backwards
+ * @see oplog_collapse_rotations
+ */
+void	oplog_optimize(t_oplog *log, int values)
+{
+	size_t	size;
+	size_t	before;
+	size_t	collapsed;
+	size_t	i;
+
+	collapsed = 0;
+	before = log->size + 1;
+	while (log->size < before)
+	{
+		before = log->size;
+		size = 0;
+		i = 0;
+		while (i < before)
+		{
+			if (!merge_backwards(log->ops, &size, log->ops[i]))
+				log->ops[size++] = log->ops[i];
+			i++;
+		}
+		log->size = size;
+		if (size != collapsed)
+		{
+			oplog_collapse_rotations(log, values);
+			collapsed = log->size;
+		}
+	}
+}
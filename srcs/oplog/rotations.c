@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rotations.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 20:52:01 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 10:34:43 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file rotations.c
+ * @brief Rewrites each run of rotations in its shortest form.
+ *
+ * Rotations commute with each other, so a run of them only matters by
+ * its net effect: stack A turned by some count modulo its size, and
+ * stack B likewise. Replaying the log tracks both sizes through the
+ * pushes, so each run can be rewritten as `k` or `k - size` steps per
+ * stack, whichever pair is cheaper once same-direction steps are shared
+ * as `rr` or `rrr`.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup oplog
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Number of operations needed for signed rotations of A and B.
+ *
+ * @param a Signed rotations of stack A, negative for reverse rotations.
+ * @param b Signed rotations of stack B.
+ * @return Operation count, with same-direction steps shared.
+ *
+ * @ingroup oplog
+ */
+static int	run_cost(int a, int b)
+{
+	bool	shared;
+
+	shared = (a > 0 && b > 0) || (a < 0 && b < 0);
+	if (a < 0)
+		a = -a;
+	if (b < 0)
+		b = -b;
+	if (!shared)
+		return (a + b);
+	if (a > b)
+		return (a);
+	return (b);
+}
+
+/**
+ * @brief Returns the step a rotation applies to one stack.
+ *
+ * @param op Rotation code.
+ * @param stack 0 for stack A, 1 for stack B.
+ * @return 1 for a rotation, -1 for a reverse rotation, 0 if untouched.
+ *
+ * @ingroup oplog
+ */
+static int	rotation_step(int op, int stack)
+{
+	static const int	steps[2][OP_COUNT] = {
+	{0, 0, 0, 0, 0, 1, 0, 1, -1, 0, -1},
+	{0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1}};
+
+	return (steps[stack][op]);
+}
+
+/**
+ * @brief Chooses the cheapest signed rotations for a net rotation.
+ *
+ * Each stack can reach its net rotation `r` (taken modulo its size)
+ * forwards with `r` steps or backwards with `size - r` steps; the four
+ * combinations are compared. A net of at most one step per stack is
+ * already the cheapest once that stack holds more than two values, which
+ * covers the single rotations that make up most runs, so it is kept as
+ * is.
+ *
+ * @param net Net forward rotations of A and B over the run, replaced by
+ *            the chosen signed counts.
+ * @param sizes Current sizes of A and B.
+ *
+ * @ingroup oplog
+ * @see run_cost
+ */
+static void	pick_rotations(int net[2], const int sizes[2])
+{
+	int	residue[2];
+	int	best[2];
+	int	i;
+
+	if (net[0] * net[0] <= 1 && net[1] * net[1] <= 1
+		&& (net[0] == 0 || sizes[0] > 2) && (net[1] == 0 || sizes[1] > 2))
+		return ;
+	residue[0] = 0;
+	residue[1] = 0;
+	if (sizes[0] > 1)
+		residue[0] = ((net[0] % sizes[0]) + sizes[0]) % sizes[0];
+	if (sizes[1] > 1)
+		residue[1] = ((net[1] % sizes[1]) + sizes[1]) % sizes[1];
+	best[0] = residue[0];
+	best[1] = residue[1];
+	i = 1;
+	while (i < 4)
+	{
+		net[0] = residue[0] - (i & 1) * sizes[0];
+		net[1] = residue[1] - (i >> 1) * sizes[1];
+		if (run_cost(net[0], net[1]) < run_cost(best[0], best[1]))
+			ft_memcpy(best, net, sizeof(best));
+		i++;
+	}
+	ft_memcpy(net, best, sizeof(best));
+}
+
+/**
+ * @brief Writes signed rotations of A and B as operations.
+ *
+ * @param out Destination of the operations.
+ * @param k Signed rotations of A and B, consumed.
+ * @return Number of operations written.
+ *
+ * @ingroup oplog
+ */
+static size_t	emit_rotations(unsigned char *out, int k[2])
+{
+	static const int	ops[9] = {OP_RRR, OP_RRA, OP_RRA, OP_RRB, OP_NONE,
+		OP_RB, OP_RA, OP_RA, OP_RR};
+	size_t				count;
+	int					op;
+
+	count = 0;
+	while (k[0] != 0 || k[1] != 0)
+	{
+		op = ops[((k[0] > 0) - (k[0] < 0) + 1) * 3
+			+ (k[1] > 0) - (k[1] < 0) + 1];
+		out[count++] = (unsigned char)op;
+		k[0] -= rotation_step(op, 0);
+		k[1] -= rotation_step(op, 1);
+	}
+	return (count);
+}
+
+/**
+ * @brief Replaces every run of rotations with its shortest form.
+ *
+ * The log is rewritten in place: a rewritten run is never longer than
+ * the run it replaces.
+ *
+ * @param log Pointer to the operation log.
+ * @param values Number of values, all in stack A before the first op.
+ *
+ * @ingroup oplog
+ * @see rotation_step
+ * @see pick_rotations
+ * @see emit_rotations
+ */
+void	oplog_collapse_rotations(t_oplog *log, int values)
+{
+	int		sizes[2];
+	int		net[2];
+	size_t	read;
+	size_t	write;
+
+	sizes[0] = values;
+	read = 0;
+	write = 0;
+	while (read < log->size)
+	{
+		ft_memset(net, 0, sizeof(net));
+		while (read < log->size && log->ops[read] >= OP_RA)
+		{
+			net[0] += rotation_step(log->ops[read], 0);
+			net[1] += rotation_step(log->ops[read++], 1);
+		}
+		sizes[1] = values - sizes[0];
+		pick_rotations(net, sizes);
+		write += emit_rotations(log->ops + write, net);
+		if (read < log->size)
+			sizes[0] += (log->ops[read] == OP_PA) - (log->ops[read] == OP_PB);
+		if (read < log->size)
+			log->ops[write++] = log->ops[read++];
+	}
+	log->size = write;
+}
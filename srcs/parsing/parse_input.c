@@ -0,0 +1,187 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_input.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:56:33 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 16:42:46 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_input.c
+ * @brief Reads the values from standard input or from a file.
+ *
+ * Large datasets do not fit in the command line, whose size is capped by
+ * the kernel. `push_swap -` reads standard input in PS_READ_BLOCK chunks
+ * and `push_swap --file PATH` maps the file in memory; both then go
+ * through the same tokenizer as a quoted argument, with any whitespace
+ * accepted between numbers.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup parsing
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Doubles the capacity of the standard input buffer.
+ *
+ * @param data Current buffer, released on success and on failure.
+ * @param len Number of bytes used in `data`.
+ * @param capacity Pointer to the capacity, doubled on success.
+ * @return The new buffer, or NULL if the allocation failed.
+ *
+ * @ingroup parsing
+ */
+static char	*grow_buffer(char *data, size_t len, size_t *capacity)
+{
+	char	*grown;
+
+	grown = malloc(*capacity * 2);
+	if (grown)
+	{
+		ft_memcpy(grown, data, len);
+		*capacity *= 2;
+	}
+	free(data);
+	return (grown);
+}
+
+/**
+ * @brief Reads the whole standard input into one buffer.
+ *
+ * @param len Receives the number of bytes read.
+ * @return The buffer, or NULL on read or allocation failure.
+ *
+ * @ingroup parsing
+ * @see grow_buffer
+ */
+static char	*read_stdin(size_t *len)
+{
+	char	*data;
+	size_t	capacity;
+	ssize_t	bytes;
+
+	capacity = PS_READ_BLOCK;
+	data = malloc(capacity);
+	*len = 0;
+	bytes = 1;
+	while (data && bytes > 0)
+	{
+		if (*len == capacity)
+			data = grow_buffer(data, *len, &capacity);
+		if (data)
+			bytes = read(STDIN_FILENO, data + *len, capacity - *len);
+		if (data && bytes > 0)
+			*len += bytes;
+	}
+	if (bytes < 0)
+	{
+		free(data);
+		return (NULL);
+	}
+	return (data);
+}
+
+/**
+ * @brief Maps a whole file in memory, read-only.
+ *
+ * An empty file holds nothing to sort and exits like an empty argument
+ * list.
+ *
+ * @param path Path of the file.
+ * @param len Receives the size of the file.
+ * @return The mapping, or NULL if the file cannot be opened or mapped.
+ *
+ * @ingroup parsing
+ */
+static char	*map_file(const char *path, size_t *len)
+{
+	struct stat	info;
+	char		*data;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &info) < 0)
+	{
+		if (fd >= 0)
+			close(fd);
+		return (NULL);
+	}
+	if (info.st_size == 0)
+	{
+		close(fd);
+		exit(EXIT_FAILURE);
+	}
+	*len = info.st_size;
+	data = mmap(NULL, *len, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return (NULL);
+	madvise(data, *len, MADV_SEQUENTIAL);
+	return (data);
+}
+
+/**
+ * @brief Releases the input buffer once the values are converted.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param data Input buffer.
+ * @param len Size of the input buffer.
+ *
+ * @ingroup parsing
+ */
+static void	release_input(t_array *array, char *data, size_t len)
+{
+	if (ft_strncmp(array->input, "-", 2) == 0)
+		free(data);
+	else
+		munmap(data, len);
+}
+
+/**
+ * @brief Parses the values of stack A from standard input or a file.
+ *
+ * Reserves room for as many values as the input can hold, converts them
+ * straight into stack A in a single pass, then fits the stacks to the
+ * number of values read, exactly like `parse_arguments`.
+ *
+ * @param array Pointer to the main stack structure, with `input` set.
+ *
+ * @ingroup parsing
+ * @see read_stdin
+ * @see map_file
+ * @see max_tokens
+ * @see convert_tokens
+ * @see fit_array
+ */
+void	parse_input(t_array *array)
+{
+	char	*data;
+	size_t	len;
+	bool	valid;
+
+	len = 0;
+	if (ft_strncmp(array->input, "-", 2) == 0)
+		data = read_stdin(&len);
+	else
+		data = map_file(array->input, &len);
+	if (!data)
+		perror_and_exit();
+	array->a.size = max_tokens(data, data + len);
+	valid = (array->a.size >= 0 && init_array(array, array->a.size)
+			&& convert_tokens(array, data, data + len, true));
+	release_input(array, data, len);
+	if (!valid)
+		perror_and_exit();
+	if (array->a.size == 0)
+		exit(EXIT_FAILURE);
+	fit_array(array, array->a.size);
+	stack_count_breaks(&array->a);
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_number.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:49:20 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 16:49:59 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_number.c
+ * @brief Single-pass conversion of separated numbers into stack A.
+ *
+ * Shared by every input source: a quoted argument, standard input or a
+ * mapped file. Buffers are bounded by an end pointer instead of a null
+ * terminator, so mapped files can be read in place.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup parsing
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Tells whether a byte separates two numbers.
+ *
+ * @param c Byte to test.
+ * @param any_space true to accept every whitespace, false for spaces only.
+ * @return true if `c` is a separator.
+ *
+ * @ingroup parsing
+ */
+static bool	is_separator(char c, bool any_space)
+{
+	return (c == ' ' || (any_space && c >= '\t' && c <= '\r'));
+}
+
+/**
+ * @brief Converts the number starting at `str`, stopping at its end.
+ *
+ * Accepts an optional `+` or `-` followed by at least one digit. Leading
+ * zeros are skipped, and at most 10 significant digits are accumulated
+ * in 64 bits, so a single comparison tells whether the number fits in
+ * an int.
+ *
+ * @param str Start of the number.
+ * @param end End of the buffer.
+ * @param value Receives the converted number.
+ * @return Pointer to the first byte after the digits, or NULL if there
+ *         are no digits or the number does not fit in an int.
+ *
+ * @ingroup parsing
+ */
+const char	*read_number(const char *str, const char *end, int *value)
+{
+	long long	num;
+	int			negative;
+	int			digits;
+
+	negative = (str < end && *str == '-');
+	str += (str < end && (*str == '-' || *str == '+'));
+	while (end - str > 1 && *str == '0' && (unsigned int)(str[1] - '0') < 10)
+		str++;
+	num = 0;
+	digits = 0;
+	while (str < end && (unsigned int)(*str - '0') < 10)
+	{
+		if (++digits > 10)
+			return (NULL);
+		num = num * 10 + (*str++ - '0');
+	}
+	if (digits == 0 || num > (long long)INT_MAX + negative)
+		return (NULL);
+	*value = (int)num;
+	if (negative)
+		*value = (int)-num;
+	return (str);
+}
+
+/**
+ * @brief Upper bound on the number of tokens in a buffer.
+ *
+ * Every token but the last is followed by a separator, so a buffer of
+ * `len` bytes holds at most `len / 2 + 1` tokens. Reserving that many
+ * slots lets `convert_tokens` read the buffer once, without counting
+ * the tokens first.
+ *
+ * @param str Start of the buffer.
+ * @param end End of the buffer.
+ * @return The bound, or -1 if it does not fit in an int.
+ *
+ * @ingroup parsing
+ */
+int	max_tokens(const char *str, const char *end)
+{
+	if ((size_t)(end - str) / 2 >= INT_MAX)
+		return (-1);
+	return ((int)((end - str) / 2 + 1));
+}
+
+/**
+ * @brief Converts the separated numbers of a buffer into stack A.
+ *
+ * Stack A must already hold room for `max_tokens` values; its size is
+ * set to the number of values converted.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param str Start of the buffer.
+ * @param end End of the buffer.
+ * @param any_space true to accept every whitespace as a separator.
+ * @return false if a token is not a valid int.
+ *
+ * @ingroup parsing
+ * @see max_tokens
+ * @see read_number
+ */
+bool	convert_tokens(t_array *array, const char *str, const char *end,
+		bool any_space)
+{
+	int	i;
+
+	i = 0;
+	while (str < end)
+	{
+		if (is_separator(*str, any_space))
+			str++;
+		else
+		{
+			str = read_number(str, end, &array->a.data[i++]);
+			if (!str || (str < end && !is_separator(*str, any_space)))
+				return (false);
+		}
+	}
+	array->a.size = i;
+	return (true);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_options.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:51:11 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 12:08:32 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file parse_options.c
+ * @brief Parses the command-line options placed before the values.
+ *
+ * Options start with `--`, which can never begin a valid integer, so they
+ * are told apart from the values without ambiguity. Supported options:
+ * - `--engine NAME`: forces the strategy used above PS_OPTIMAL_MAX values
+ *   (`auto`, `radix`, `turk`, `lis`, `rotation`, `radix-sim`, or
+ *   `portfolio` to keep the best of them)
+ * - `--file PATH`: reads the values from a file instead of the arguments
+ * - `--binary`: prints the operations in the binary format (see t_format)
+ * - `--batch`: solves one instance per line of standard input (see
+ *   batch.c)
+ * - `--explain`: prints the profile of the input and the engine chosen
+ *   to standard error (see explain.c)
+ *
+ * A single `-` after the options reads the values from standard input.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup parsing
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Converts an engine name into its `t_engine` value.
+ *
+ * The names are listed in the same order as the enumeration.
+ *
+ * @param name Engine name given on the command line.
+ * @return The matching engine. Exits with an error on unknown names.
+ *
+ * @ingroup parsing
+ * @see perror_and_exit
+ */
+static t_engine	parse_engine(const char *name)
+{
+	static const char	*names[] = {"auto", "radix", "turk", "lis",
+		"rotation", "radix-sim", "portfolio", NULL};
+	int					i;
+
+	i = 0;
+	while (names[i])
+	{
+		if (ft_strncmp(name, names[i], ft_strlen(names[i]) + 1) == 0)
+			return ((t_engine)i);
+		i++;
+	}
+	perror_and_exit();
+	return (ENGINE_AUTO);
+}
+
+/**
+ * @brief Sets the option matching a flag that takes no argument.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param arg Flag given on the command line.
+ * @return false if `arg` is not a known flag.
+ *
+ * @ingroup parsing
+ */
+static bool	parse_flag(t_array *array, const char *arg)
+{
+	if (ft_strncmp(arg, "--binary", 9) == 0)
+		array->binary = true;
+	else if (ft_strncmp(arg, "--batch", 8) == 0)
+		array->batch = true;
+	else if (ft_strncmp(arg, "--explain", 10) == 0)
+		array->explain = true;
+	else
+		return (false);
+	return (true);
+}
+
+/**
+ * @brief Consumes the options given before the values.
+ *
+ * Unknown options and options missing their argument are errors, and
+ * so are values given on the command line next to an input file or `-`.
+ * `--batch` always reads standard input, in text, so it takes neither
+ * values, an input, `--binary` nor `--explain`.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param argc Argument count.
+ * @param argv Argument values.
+ * @return Index in `argv` of the first value argument, `argc` when the
+ *         values come from a file or standard input.
+ *
+ * @ingroup parsing
+ * @see parse_engine
+ * @see parse_flag
+ */
+int	parse_options(t_array *array, int argc, char **argv)
+{
+	int	i;
+
+	i = 1;
+	while (i < argc && ft_strncmp(argv[i], "--", 2) == 0)
+	{
+		if (ft_strncmp(argv[i], "--engine", 9) == 0 && i + 1 < argc)
+		{
+			i++;
+			array->engine = parse_engine(argv[i]);
+		}
+		else if (ft_strncmp(argv[i], "--file", 7) == 0 && i + 1 < argc)
+			array->input = argv[++i];
+		else if (!parse_flag(array, argv[i]))
+			perror_and_exit();
+		i++;
+	}
+	if (!array->input && i + 1 == argc && ft_strncmp(argv[i], "-", 2) == 0)
+		array->input = argv[i++];
+	if ((array->input || array->batch) && i < argc)
+		perror_and_exit();
+	if (array->batch && (array->input || array->binary || array->explain))
+		perror_and_exit();
+	return (i);
+}
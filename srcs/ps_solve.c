@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ps_solve.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:49:45 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 16:28:20 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file ps_solve.c
+ * @brief In-memory solver, the entry point of libpush_swap.a.
+ *
+ * Solves one instance from a plain array of values and hands the
+ * operations back in a `t_oplog`, without printing anything or calling
+ * `exit()`: invalid input and allocation failures come back as a
+ * `t_status`. The push_swap program calls `solve_array` directly on the
+ * array it parsed, without the copy `ps_solve_engine` makes.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup api
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Normalizes, sorts and optimizes an array whose A stack is set.
+ *
+ * An input that is already sorted succeeds with no operation. Shared
+ * by `ps_solve_engine`, the push_swap program, which solves the array
+ * it parsed in place, and the batch workers, which reuse their arrays.
+ *
+ * @param array Pointer to the main stack structure.
+ * @return PS_OK, PS_ERROR_DUPLICATE or PS_ERROR_ALLOC.
+ *
+ * @ingroup api
+ * @see assign_indices
+ * @see sort_array
+ * @see oplog_optimize
+ */
+t_status	solve_array(t_array *array)
+{
+	if (!assign_indices(array))
+		return (PS_ERROR_DUPLICATE);
+	if (!stack_is_sorted(&array->a))
+	{
+		sort_array(array);
+		oplog_optimize(&array->log, array->a.size);
+	}
+	if (array->log.failed)
+		return (PS_ERROR_ALLOC);
+	return (PS_OK);
+}
+
+/**
+ * @brief Solves one instance with a given engine.
+ *
+ * On success, `out` owns the operations and must be released with
+ * `oplog_free`. On failure it is left empty.
+ *
+ * @param values Values to sort, top of stack A first.
+ * @param n Number of values, at most INT_MAX.
+ * @param engine Strategy used above PS_OPTIMAL_MAX values.
+ * @param out Receives the operations.
+ * @return PS_OK, or the reason no sequence was produced.
+ *
+ * @ingroup api
+ * @see solve_array
+ */
+t_status	ps_solve_engine(const int *values, size_t n, t_engine engine,
+		t_oplog *out)
+{
+	t_array		array;
+	t_status	status;
+
+	ft_memset(out, 0, sizeof(t_oplog));
+	if (n == 0)
+		return (PS_OK);
+	if (n > INT_MAX)
+		return (PS_ERROR_INPUT);
+	ft_memset(&array, 0, sizeof(t_array));
+	if (!init_array(&array, (int)n))
+		return (PS_ERROR_ALLOC);
+	ft_memcpy(array.a.data, values, n * sizeof(int));
+	array.a.size = (int)n;
+	array.engine = engine;
+	stack_count_breaks(&array.a);
+	status = solve_array(&array);
+	if (status == PS_OK)
+	{
+		*out = array.log;
+		ft_memset(&array.log, 0, sizeof(t_oplog));
+	}
+	free_array(&array);
+	return (status);
+}
+
+/**
+ * @brief Solves one instance, picking the engine from its profile.
+ *
+ * @param values Values to sort, top of stack A first.
+ * @param n Number of values, at most INT_MAX.
+ * @param out Receives the operations, see `ps_solve_engine`.
+ * @return PS_OK, or the reason no sequence was produced.
+ *
+ * @ingroup api
+ * @see ps_solve_engine
+ * @see profile_stack
+ */
+t_status	ps_solve(const int *values, size_t n, t_oplog *out)
+{
+	return (ps_solve_engine(values, n, ENGINE_AUTO, out));
+}
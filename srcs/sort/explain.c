@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   explain.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:50:35 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 12:15:45 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file explain.c
+ * @brief Prints the profile of the input and the engine chosen for it.
+ *
+ * `--explain` writes one `name value` line per feature to standard error,
+ * then the predicted operation count of each engine and the engine that
+ * runs. `-` stands for a feature that does not apply (`swaps` when no
+ * rotation and swaps can sort the input) or a cost that is not
+ * predicted:
+ *
+ * @code
+ * size 100000
+ * runs 2
+ * offset 43211
+ * inversions 551
+ * lis 100000
+ * swaps 0
+ * cost radix 2125000
+ * cost turk -
+ * cost lis 100000
+ * cost rotation 43211
+ * engine rotation
+ * @endcode
+ *
+ * `table` and `search` stand for the small-input strategies, which run
+ * whatever the engine, and `none` for an input that is already sorted.
+ * Standard output only ever holds the operations.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup sorting
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Writes one `name value` line to standard error.
+ *
+ * @param name Name of the feature, with its trailing space.
+ * @param value Value of the feature, SIZE_MAX to write `-`.
+ *
+ * @ingroup sorting
+ * @see format_size
+ */
+static void	put_feature(const char *name, size_t value)
+{
+	char	digits[PS_SIZE_DIGITS];
+
+	ft_putstr_fd((char *)name, STDERR_FILENO);
+	if (value == SIZE_MAX)
+		ft_putchar_fd('-', STDERR_FILENO);
+	else
+	{
+		format_size(value, digits);
+		ft_putstr_fd(digits, STDERR_FILENO);
+	}
+	ft_putchar_fd('\n', STDERR_FILENO);
+}
+
+/**
+ * @brief Writes the features and the predictions of a profile.
+ *
+ * @param profile Profile of stack A.
+ * @param names Engine names, in the order of the enumeration.
+ *
+ * @ingroup sorting
+ * @see put_feature
+ */
+static void	print_profile(const t_profile *profile, const char **names)
+{
+	t_engine	engine;
+
+	put_feature("size ", profile->size);
+	put_feature("runs ", profile->runs);
+	put_feature("offset ", profile->offset);
+	put_feature("inversions ", profile->inversions);
+	put_feature("lis ", profile->lis);
+	if (profile->swaps < 0)
+		put_feature("swaps ", SIZE_MAX);
+	else
+		put_feature("swaps ", profile->swaps);
+	engine = ENGINE_RADIX;
+	while (engine < ENGINE_PORTFOLIO)
+	{
+		ft_putstr_fd("cost ", STDERR_FILENO);
+		ft_putstr_fd((char *)names[engine], STDERR_FILENO);
+		put_feature(" ", profile->cost[engine]);
+		engine++;
+	}
+}
+
+/**
+ * @brief Profiles the parsed input, explains the choice, and returns it.
+ *
+ * Normalizes stack A in place: the values keep their order, so the
+ * operations solving them are unchanged. An engine forced with
+ * `--engine` is kept, and the predictions are printed next to it.
+ *
+ * @param array Pointer to the main stack structure, with A parsed.
+ * @return Engine to solve the input with. Exits with an error on
+ *         duplicates.
+ *
+ * @ingroup sorting
+ * @see profile_stack
+ * @see print_profile
+ */
+t_engine	explain_engine(t_array *array)
+{
+	static const char	*names[] = {"auto", "radix", "turk", "lis",
+		"rotation", "radix-sim", "portfolio"};
+	t_profile			profile;
+	const char			*choice;
+
+	if (!assign_indices(array))
+		perror_and_exit();
+	profile_stack(&array->a, &profile);
+	print_profile(&profile, names);
+	if (array->engine != ENGINE_AUTO)
+		profile.engine = array->engine;
+	choice = names[profile.engine];
+	if (stack_is_sorted(&array->a))
+		choice = "none";
+	else if (array->a.size <= PS_TABLE_MAX)
+		choice = "table";
+	else if (array->a.size <= PS_OPTIMAL_MAX)
+		choice = "search";
+	ft_putstr_fd("engine ", STDERR_FILENO);
+	ft_putendl_fd((char *)choice, STDERR_FILENO);
+	return (profile.engine);
+}
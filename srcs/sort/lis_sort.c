@@ -0,0 +1,220 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lis_sort.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:52:51 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:36:09 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file lis_sort.c
+ * @brief Adaptive engine keeping the longest increasing subsequence of A.
+ *
+ * The values of a longest increasing subsequence of stack A, read from
+ * its smallest value around the ring, are already in order: they stay
+ * in A, and only the other values are pushed to B, then reinserted with
+ * the turk engine's cheapest moves. On mostly ordered inputs B stays
+ * small, so the operations grow with the disorder of the input rather
+ * than with its size.
+ *
+ * The subsequence is found in O(n log n) by patience sorting: `tails[k]`
+ * holds the position of the smallest value ending an increasing
+ * subsequence of length k, and `prev` links each value to the one
+ * before it.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup turk
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Finds where a value extends the subsequences found so far.
+ *
+ * @param a Stack A.
+ * @param tails Ends of the best subsequence of each length.
+ * @param len Longest length found so far.
+ * @param value Value to place.
+ * @return Smallest length k, from 1, whose end is not below `value`, or
+ *         `len + 1` if `value` extends the longest subsequence.
+ *
+ * @ingroup turk
+ */
+static int	lower_bound(const t_stack *a, const int *tails, int len, int value)
+{
+	int	low;
+	int	high;
+	int	mid;
+
+	low = 1;
+	high = len + 1;
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if (stack_get(a, tails[mid]) < value)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return (low);
+}
+
+/**
+ * @brief Finds a longest increasing subsequence of A, around the ring.
+ *
+ * The ring is read from `start`, the position of the smallest value.
+ * `tails[0]` is a sentinel, so every value has a predecessor slot.
+ *
+ * @param a Stack A.
+ * @param start Position where the reading starts.
+ * @param tails Room for `a->size + 1` positions.
+ * @param prev Room for `a->size` positions, receives the links.
+ * @return Length of the subsequence, which ends at `tails[length]`.
+ *
+ * @ingroup turk
+ * @see lower_bound
+ */
+static int	build_lis(const t_stack *a, int start, int *tails, int *prev)
+{
+	int	len;
+	int	slot;
+	int	pos;
+	int	i;
+
+	tails[0] = -1;
+	len = 0;
+	i = 0;
+	while (i < a->size)
+	{
+		pos = (start + i++) % a->size;
+		slot = lower_bound(a, tails, len, stack_get(a, pos));
+		prev[pos] = tails[slot - 1];
+		tails[slot] = pos;
+		len += (slot > len);
+	}
+	return (len);
+}
+
+/**
+ * @brief Marks the subsequence, and picks the shorter walk through A.
+ *
+ * The marks overwrite `tails`, indexed by position in A. Every value
+ * outside the subsequence is reached either walking down from the top
+ * to the last of them, or walking up from the bottom to the first.
+ *
+ * @param tails Result of `build_lis`, overwritten with the marks.
+ * @param prev Links filled by `build_lis`.
+ * @param len Length of the subsequence.
+ * @param size Number of values in A.
+ * @return Number of positions to walk, positive downwards, negative
+ *         upwards, 0 if every value is kept.
+ *
+ * @ingroup turk
+ */
+static int	mark_kept(int *tails, const int *prev, int len, int size)
+{
+	int	pos;
+	int	first;
+	int	last;
+
+	pos = tails[len];
+	ft_memset(tails, 0, (size_t)size * sizeof(int));
+	while (pos >= 0)
+	{
+		tails[pos] = 1;
+		pos = prev[pos];
+	}
+	first = 0;
+	while (first < size && tails[first])
+		first++;
+	last = size - 1;
+	while (last >= 0 && tails[last])
+		last--;
+	if (last + 1 <= size - first)
+		return (last + 1);
+	return (first - size);
+}
+
+/**
+ * @brief Pushes every value outside the subsequence to B.
+ *
+ * Kept values passed on the way down are rotated with `ra`; on the way
+ * up, every value is brought to the top with `rra` first. Values past
+ * the walk are never touched.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param keep Marks of the values staying in A, by position.
+ * @param steps Walk chosen by `mark_kept`.
+ *
+ * @ingroup turk
+ */
+static void	push_unkept(t_array *array, const int *keep, int steps)
+{
+	int	pos;
+
+	pos = 0;
+	while (pos < steps)
+	{
+		if (keep[pos++])
+			ra(array);
+		else
+			pb(array);
+	}
+	pos = array->a.size;
+	while (steps < 0)
+	{
+		rra(array);
+		if (!keep[--pos])
+			pb(array);
+		steps++;
+	}
+}
+
+/**
+ * @brief Sorts stack A around its longest increasing subsequence.
+ *
+ * Stack A holds normalized indices, so its smallest value is 0. An
+ * allocation failure is reported through the operation log.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup turk
+ * @see build_lis
+ * @see mark_kept
+ * @see push_unkept
+ * @see cheapest_move
+ * @see rotate_min_to_top
+ */
+void	lis_sort(t_array *array)
+{
+	int	*tails;
+	int	len;
+	int	start;
+
+	tails = malloc((2 * (size_t)array->a.size + 1) * sizeof(int));
+	if (!tails)
+	{
+		array->log.failed = true;
+		return ;
+	}
+	start = 0;
+	while (stack_get(&array->a, start) != 0)
+		start++;
+	len = build_lis(&array->a, start, tails, tails + array->a.size + 1);
+	push_unkept(array, tails,
+		mark_kept(tails, tails + array->a.size + 1, len, array->a.size));
+	free(tails);
+	while (array->b.size > 0 && !sort_aborted(array))
+	{
+		apply_move(array, cheapest_move(array));
+		pa(array);
+	}
+	rotate_min_to_top(array);
+}
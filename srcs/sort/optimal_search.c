@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   optimal_search.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:03:21 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 16:39:26 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file optimal_search.c
+ * @brief Bidirectional breadth-first search used by the optimal sort.
+ *
+ * The search grows one frontier from the input and one from the sorted
+ * state, always expanding a whole layer of the smaller frontier. When a
+ * layer links the two sides, the shortest link found in that layer gives
+ * a minimal sequence. Every operation has an inverse operation, which is
+ * what lets the backward side walk the same state graph.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup optimal
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Returns the operation undoing another one.
+ *
+ * @param op Operation code.
+ * @return Code of the inverse operation.
+ *
+ * @ingroup optimal
+ */
+static int	inverse_op(int op)
+{
+	static const int	inverse[OP_COUNT] = {OP_SA, OP_SB, OP_SS, OP_PB,
+		OP_PA, OP_RRA, OP_RRB, OP_RRR, OP_RA, OP_RB, OP_RR};
+
+	return (inverse[op]);
+}
+
+/**
+ * @brief Handles a state reached from `code` through `op`.
+ *
+ * Unseen states join the frontier of the current side. States already
+ * owned by the other side link both searches; the shortest link is kept
+ * in `meet` as (forward state, forward operation, backward state).
+ *
+ * @param search Search bookkeeping.
+ * @param side 0 for forward, 1 for backward.
+ * @param code State being expanded.
+ * @param link Operation applied to it, followed by the state reached.
+ *
+ * @ingroup optimal
+ */
+static void	visit(t_search *search, int side, int code, int link[2])
+{
+	int	next;
+
+	next = link[1];
+	if (search->side[next] == 0)
+	{
+		search->side[next] = side + 1;
+		search->parent[next] = code;
+		search->via[next] = link[0];
+		search->depth[next] = search->depth[code] + 1;
+		search->queue[side][search->tail[side]++] = next;
+	}
+	else if (search->side[next] != side + 1 && search->depth[code]
+		+ search->depth[next] + 1 < search->best)
+	{
+		search->best = search->depth[code] + search->depth[next] + 1;
+		search->meet[0 + side * 2] = code;
+		search->meet[1] = link[0];
+		search->meet[2 - side * 2] = next;
+	}
+}
+
+/**
+ * @brief Expands one state on the given side of the search.
+ *
+ * The backward side applies inverse operations, and records the forward
+ * operation so that the path can be replayed from the input.
+ *
+ * @param search Search bookkeeping.
+ * @param side 0 for forward, 1 for backward.
+ * @param code Encoded state to expand.
+ *
+ * @ingroup optimal
+ * @see visit
+ * @see apply_state_op
+ */
+static void	expand_state(t_search *search, int side, int code)
+{
+	t_state	state;
+	t_state	next;
+	int		link[2];
+	int		op;
+
+	state.size = search->size;
+	decode_state(&state, code);
+	op = 0;
+	while (op < OP_COUNT)
+	{
+		next = state;
+		if (apply_state_op(&next, op))
+		{
+			link[0] = op;
+			if (side == 1)
+				link[0] = inverse_op(op);
+			link[1] = encode_state(&next);
+			visit(search, side, code, link);
+		}
+		op++;
+	}
+}
+
+/**
+ * @brief Expands every state of the current layer of one side.
+ *
+ * @param search Search bookkeeping.
+ * @param side 0 for forward, 1 for backward.
+ *
+ * @ingroup optimal
+ * @see expand_state
+ */
+static void	expand_layer(t_search *search, int side)
+{
+	int	end;
+
+	end = search->tail[side];
+	while (search->head[side] < end)
+		expand_state(search, side, search->queue[side][search->head[side]++]);
+}
+
+/**
+ * @brief Searches for a shortest path between two encoded states.
+ *
+ * The per-state arrays must be allocated and zeroed. On return, `meet`
+ * describes the middle of the path and `best` its length.
+ *
+ * @param search Search bookkeeping.
+ * @param start Encoded initial state.
+ * @param goal Encoded sorted state.
+ *
+ * @ingroup optimal
+ * @see expand_layer
+ */
+void	run_search(t_search *search, int start, int goal)
+{
+	search->side[start] = 1;
+	search->side[goal] = 2;
+	search->queue[0][search->tail[0]++] = start;
+	search->queue[1][search->tail[1]++] = goal;
+	search->best = INT_MAX;
+	while (search->best == INT_MAX)
+	{
+		if (search->tail[0] - search->head[0]
+			<= search->tail[1] - search->head[1])
+			expand_layer(search, 0);
+		else
+			expand_layer(search, 1);
+	}
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   optimal_sort.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:56:08 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 22:33:03 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file optimal_sort.c
+ * @brief Finds a provably minimal operation sequence for up to 8 values.
+ *
+ * Searches every arrangement of the values in stacks A and B, using all
+ * 11 operations, with a bidirectional breadth-first search (see
+ * optimal_search.c). States are encoded as compact indices (see
+ * optimal_state.c), and no-op or redundant operations are pruned before
+ * being explored.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup optimal
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Allocates the search arrays for every possible state.
+ *
+ * @param search Search bookkeeping to fill.
+ * @param states Number of states, (size + 1)!.
+ * @return true on success, false if an allocation failed.
+ *
+ * @ingroup optimal
+ */
+static bool	init_search(t_search *search, int states)
+{
+	ft_memset(search, 0, sizeof(t_search));
+	search->parent = malloc(states * sizeof(int));
+	search->via = malloc(states);
+	search->side = ft_calloc(states, 1);
+	search->depth = ft_calloc(states, 1);
+	search->queue[0] = malloc(states * sizeof(int));
+	search->queue[1] = malloc(states * sizeof(int));
+	return (search->parent && search->via && search->side && search->depth
+		&& search->queue[0] && search->queue[1]);
+}
+
+/**
+ * @brief Releases the search arrays.
+ *
+ * @param search Search bookkeeping.
+ *
+ * @ingroup optimal
+ */
+static void	free_search(t_search *search)
+{
+	free(search->parent);
+	free(search->via);
+	free(search->side);
+	free(search->depth);
+	free(search->queue[0]);
+	free(search->queue[1]);
+}
+
+/**
+ * @brief Replays the forward path from the initial state to `code`.
+ *
+ * Recursion follows the parent links back to the start, so operations
+ * run in forward order. The depth is bounded by the length of the path.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param search Completed search.
+ * @param code Forward state at the end of the path.
+ *
+ * @ingroup optimal
+ * @see run_operation
+ */
+static void	replay_forward(t_array *array, const t_search *search, int code)
+{
+	if (search->depth[code] == 0)
+		return ;
+	replay_forward(array, search, search->parent[code]);
+	run_operation(array, search->via[code]);
+}
+
+/**
+ * @brief Replays the path found by the search.
+ *
+ * Runs the forward half, the operation linking both halves, then walks
+ * the backward half, whose links already point towards the sorted state.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param search Completed search.
+ *
+ * @ingroup optimal
+ * @see replay_forward
+ */
+static void	replay_path(t_array *array, const t_search *search)
+{
+	int	code;
+
+	replay_forward(array, search, search->meet[0]);
+	run_operation(array, search->meet[1]);
+	code = search->meet[2];
+	while (search->depth[code] != 0)
+	{
+		run_operation(array, search->via[code]);
+		code = search->parent[code];
+	}
+}
+
+/**
+ * @brief Sorts up to PS_OPTIMAL_MAX values with a minimal sequence.
+ *
+ * Stack A holds normalized indices, so the goal is the identity
+ * permutation with every value in A, whose code is the number of values.
+ * If the search cannot be allocated, the operation log is marked as
+ * failed and the stacks are left untouched.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup optimal
+ * @see init_search
+ * @see run_search
+ * @see replay_path
+ */
+void	optimal_sort(t_array *array)
+{
+	t_search	search;
+	t_state		state;
+	int			states;
+	int			i;
+
+	state.size = array->a.size;
+	state.a_size = array->a.size;
+	states = 1;
+	i = 0;
+	while (i++ < state.size)
+	{
+		state.v[i - 1] = stack_get(&array->a, i - 1);
+		states *= i + 1;
+	}
+	if (!init_search(&search, states))
+	{
+		free_search(&search);
+		array->log.failed = true;
+		return ;
+	}
+	search.size = state.size;
+	run_search(&search, encode_state(&state), state.size);
+	replay_path(array, &search);
+	free_search(&search);
+}
@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   optimal_state.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:48:55 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 15:48:55 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file optimal_state.c
+ * @brief Compact state encoding used by the optimal small sort.
+ *
+ * A state of n values is ranked as its Lehmer code (the permutation of
+ * stack A followed by stack B) times n + 1, plus the size of A. This
+ * gives every reachable state a unique index below (n + 1)!, so the
+ * search can use flat arrays instead of a hash set.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup optimal
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Encodes a state into its unique index.
+ *
+ * @param state State to encode.
+ * @return Index in the range [0, (size + 1)!).
+ *
+ * @ingroup optimal
+ * @see decode_state
+ */
+int	encode_state(const t_state *state)
+{
+	int	code;
+	int	smaller;
+	int	i;
+	int	j;
+
+	code = 0;
+	i = 0;
+	while (i < state->size)
+	{
+		smaller = 0;
+		j = i + 1;
+		while (j < state->size)
+			smaller += state->v[j++] < state->v[i];
+		code = code * (state->size - i) + smaller;
+		i++;
+	}
+	return (code * (state->size + 1) + state->a_size);
+}
+
+/**
+ * @brief Rebuilds a state from its index.
+ *
+ * `state->size` must be set by the caller.
+ *
+ * @param state State to fill.
+ * @param code Index produced by `encode_state`.
+ *
+ * @ingroup optimal
+ * @see encode_state
+ */
+void	decode_state(t_state *state, int code)
+{
+	unsigned char	digits[PS_OPTIMAL_MAX];
+	unsigned char	left[PS_OPTIMAL_MAX];
+	int				i;
+
+	state->a_size = code % (state->size + 1);
+	code /= state->size + 1;
+	i = state->size;
+	while (i-- > 0)
+	{
+		digits[i] = code % (state->size - i);
+		code /= state->size - i;
+		left[i] = i;
+	}
+	i = 0;
+	while (i < state->size)
+	{
+		state->v[i] = left[digits[i]];
+		ft_memmove(left + digits[i], left + digits[i] + 1,
+			state->size - i - digits[i] - 1);
+		i++;
+	}
+}
+
+/**
+ * @brief Rotates a slice of the state array by one position.
+ *
+ * @param v State array.
+ * @param start First slot of the slice.
+ * @param len Number of slots in the slice.
+ * @param up true to move the first slot to the end, false for the opposite.
+ *
+ * @ingroup optimal
+ * @see apply_state_op
+ */
+static void	rotate_slice(unsigned char *v, int start, int len, bool up)
+{
+	unsigned char	moved;
+
+	if (up)
+	{
+		moved = v[start];
+		ft_memmove(v + start, v + start + 1, len - 1);
+		v[start + len - 1] = moved;
+	}
+	else
+	{
+		moved = v[start + len - 1];
+		ft_memmove(v + start + 1, v + start, len - 1);
+		v[start] = moved;
+	}
+}
+
+/**
+ * @brief Tells whether an operation can change the state.
+ *
+ * Operations on a stack with too few elements are no-ops, and combined
+ * operations with one side inactive duplicate a single operation, so
+ * they are pruned from the search.
+ *
+ * @param state Current state.
+ * @param op Operation to check.
+ * @return true if the operation is worth exploring.
+ *
+ * @ingroup optimal
+ */
+static bool	is_useful(const t_state *state, t_op op)
+{
+	int	b_size;
+
+	b_size = state->size - state->a_size;
+	if (op == OP_PA)
+		return (b_size > 0);
+	if (op == OP_PB)
+		return (state->a_size > 0);
+	if (op == OP_SS || op == OP_RR || op == OP_RRR)
+		return (state->a_size > 1 && b_size > 1);
+	if (op == OP_SA || op == OP_RA || op == OP_RRA)
+		return (state->a_size > 1);
+	return (b_size > 1);
+}
+
+/**
+ * @brief Applies an operation to a compact state.
+ *
+ * A swap is a rotation of the two top slots. Pushes rotate the slice
+ * spanning stack A and the top of B, then move the split.
+ *
+ * @param state State to modify.
+ * @param op Operation to apply.
+ * @return false if the operation was pruned and the state left unchanged.
+ *
+ * @ingroup optimal
+ * @see is_useful
+ * @see rotate_slice
+ */
+bool	apply_state_op(t_state *state, t_op op)
+{
+	int	a;
+	int	b;
+
+	if (!is_useful(state, op))
+		return (false);
+	a = state->a_size;
+	b = state->size - a;
+	if (op == OP_SA || op == OP_SS)
+		rotate_slice(state->v, 0, 2, true);
+	if (op == OP_SB || op == OP_SS)
+		rotate_slice(state->v, a, 2, true);
+	if (op == OP_RA || op == OP_RR || op == OP_RRA || op == OP_RRR)
+		rotate_slice(state->v, 0, a, op == OP_RA || op == OP_RR);
+	if (op == OP_RB || op == OP_RR || op == OP_RRB || op == OP_RRR)
+		rotate_slice(state->v, a, b, op == OP_RB || op == OP_RR);
+	if (op == OP_PA)
+		rotate_slice(state->v, 0, a + 1, false);
+	if (op == OP_PB)
+		rotate_slice(state->v, 0, a, true);
+	state->a_size += (op == OP_PA) - (op == OP_PB);
+	return (true);
+}
@@ -0,0 +1,3996 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   optimal_tables.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:01:05 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 17:01:05 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file optimal_tables.c
+ * @brief Minimal operation sequences for 2 to PS_TABLE_MAX values.
+ *
+ * Generated by tools/gen_tables.c through `make tables`, do not edit.
+ *
+ * @ingroup optimal
+ */
+#include "push_swap.h"
+
+static const unsigned char	g_ops[] = {
+	0, 8, 0, 0, 8, 5, 5, 0, 4, 8, 0, 3, 4, 0, 3, 8,
+	0, 0, 5, 4, 5, 0, 3, 0, 4, 8, 0, 3, 0, 4, 0, 3,
+	0, 8, 0, 5, 0, 4, 0, 3, 8, 0, 4, 0, 3, 0, 8, 0,
+	0, 4, 0, 3, 0, 0, 8, 8, 8, 8, 8, 0, 5, 8, 0, 5,
+	0, 5, 0, 8, 0, 5, 0, 8, 8, 0, 8, 8, 0, 8, 8, 0,
+	5, 5, 4, 4, 0, 3, 3, 4, 8, 0, 3, 4, 0, 5, 3, 4,
+	4, 5, 0, 3, 3, 4, 0, 3, 4, 4, 8, 0, 3, 0, 3, 8,
+	8, 0, 5, 0, 8, 0, 4, 0, 5, 0, 3, 5, 5, 0, 5, 5,
+	0, 0, 8, 0, 5, 5, 4, 0, 8, 0, 3, 5, 0, 5, 5, 0,
+	5, 0, 4, 0, 8, 3, 8, 0, 8, 0, 4, 8, 8, 0, 3, 0,
+	5, 4, 8, 0, 5, 0, 3, 4, 5, 0, 3, 0, 8, 0, 5, 0,
+	4, 0, 8, 8, 3, 4, 0, 8, 8, 0, 3, 0, 8, 8, 0, 5,
+	5, 0, 4, 4, 2, 3, 3, 4, 8, 0, 3, 0, 4, 0, 5, 3,
+	0, 4, 4, 7, 0, 3, 3, 4, 0, 3, 0, 4, 0, 4, 10, 0,
+	3, 3, 8, 8, 0, 5, 8, 4, 8, 0, 3, 8, 5, 5, 0, 5,
+	5, 0, 8, 0, 5, 5, 0, 4, 0, 8, 0, 3, 0, 5, 0, 5,
+	5, 0, 5, 4, 0, 3, 8, 8, 0, 8, 8, 4, 8, 0, 3, 0,
+	5, 0, 4, 5, 4, 2, 3, 3, 4, 5, 0, 3, 0, 0, 8, 0,
+	5, 4, 0, 8, 3, 8, 4, 0, 8, 8, 0, 3, 0, 0, 4, 0,
+	3, 4, 4, 10, 0, 3, 0, 3, 0, 8, 8, 0, 5, 0, 0, 8,
+	0, 4, 4, 7, 3, 0, 3, 4, 4, 2, 3, 8, 3, 0, 4, 0,
+	3, 0, 5, 4, 4, 7, 0, 3, 3, 0, 8, 8, 0, 5, 0, 8,
+	4, 8, 0, 3, 0, 8, 4, 4, 2, 3, 3, 8, 5, 5, 4, 0,
+	5, 3, 5, 5, 0, 5, 5, 5, 4, 0, 5, 3, 0, 5, 5, 0,
+	5, 0, 8, 8, 8, 8, 0, 8, 0, 8, 8, 8, 4, 8, 0, 3,
+	8, 8, 0, 8, 8, 0, 8, 4, 0, 5, 0, 3, 5, 0, 5, 5,
+	5, 0, 5, 5, 0, 8, 0, 5, 5, 5, 4, 0, 5, 3, 8, 0,
+	8, 8, 0, 8, 0, 4, 0, 8, 3, 5, 0, 5, 5, 4, 5, 0,
+	3, 8, 0, 5, 5, 0, 5, 4, 0, 5, 3, 0, 8, 0, 8, 8,
+	0, 8, 0, 0, 4, 0, 3, 8, 5, 0, 5, 0, 5, 4, 5, 0,
+	3, 0, 0, 5, 5, 4, 0, 5, 3, 0, 5, 5, 0, 5, 0, 5,
+	5, 4, 0, 5, 3, 0, 0, 5, 5, 0, 5, 0, 0, 8, 8, 0,
+	8, 8, 0, 5, 5, 8, 8, 0, 8, 5, 5, 0, 8, 8, 0, 8,
+	0, 5, 5, 0, 4, 0, 3, 8, 4, 8, 8, 0, 3, 5, 8, 8,
+	0, 8, 8, 5, 4, 0, 3, 8, 0, 5, 0, 4, 0, 5, 3, 5,
+	0, 4, 0, 8, 8, 0, 3, 5, 0, 8, 8, 0, 8, 8, 0, 5,
+	4, 0, 3, 0, 8, 0, 5, 4, 0, 5, 3, 5, 0, 8, 4, 8,
+	0, 5, 0, 3, 5, 0, 4, 0, 3, 8, 4, 5, 0, 3, 0, 5,
+	0, 4, 0, 3, 0, 8, 4, 5, 0, 3, 8, 0, 8, 0, 5, 8,
+	0, 8, 0, 5, 0, 0, 5, 5, 0, 8, 8, 0, 8, 0, 5, 5,
+	0, 0, 8, 8, 0, 8, 0, 4, 0, 8, 8, 3, 5, 4, 0, 8,
+	8, 3, 5, 0, 8, 8, 0, 5, 5, 4, 4, 4, 0, 3, 3, 3,
+	4, 4, 8, 0, 3, 3, 4, 4, 0, 5, 3, 3, 4, 4, 4, 5,
+	0, 3, 3, 3, 4, 4, 0, 3, 3, 8, 8, 0, 8, 8, 0, 8,
+	8, 4, 8, 8, 0, 5, 0, 3, 4, 8, 0, 3, 4, 4, 0, 5,
+	0, 3, 3, 4, 5, 5, 0, 5, 5, 0, 3, 4, 0, 8, 0, 5,
+	5, 3, 4, 4, 0, 8, 0, 3, 3, 4, 5, 0, 5, 5, 0, 5,
+	0, 3, 4, 4, 0, 8, 3, 3, 4, 8, 0, 8, 0, 3, 4, 4,
+	8, 8, 0, 3, 3, 4, 0, 5, 3, 4, 4, 8, 0, 5, 0, 3,
+	3, 4, 4, 5, 0, 3, 3, 4, 0, 8, 0, 5, 0, 3, 4, 4,
+	0, 8, 8, 3, 3, 4, 4, 0, 8, 8, 0, 3, 3, 4, 0, 3,
+	8, 8, 0, 5, 5, 4, 0, 3, 4, 4, 4, 2, 3, 3, 3, 4,
+	4, 8, 0, 3, 0, 3, 4, 4, 0, 5, 3, 0, 3, 4, 4, 4,
+	5, 2, 3, 3, 3, 4, 4, 0, 3, 0, 3, 8, 8, 8, 4, 0,
+	5, 5, 3, 0, 8, 8, 0, 5, 0, 8, 0, 4, 4, 8, 0, 3,
+	8, 3, 8, 8, 8, 0, 5, 5, 0, 4, 0, 8, 0, 5, 5, 0,
+	3, 4, 4, 0, 8, 0, 3, 0, 3, 5, 5, 0, 5, 5, 0, 5,
+	0, 4, 4, 0, 3, 8, 3, 4, 8, 0, 8, 3, 4, 8, 4, 8,
+	0, 3, 3, 4, 0, 5, 0, 3, 4, 4, 5, 4, 2, 3, 3, 3,
+	4, 4, 5, 0, 3, 0, 3, 4, 0, 8, 0, 5, 3, 4, 4, 0,
+	8, 3, 8, 3, 5, 5, 4, 0, 5, 5, 3, 5, 0, 4, 0, 4,
+	0, 3, 3, 4, 4, 4, 8, 2, 3, 0, 3, 3, 4, 0, 8, 8,
+	0, 5, 0, 3, 4, 0, 8, 0, 3, 4, 0, 4, 0, 5, 0, 3,
+	3, 4, 4, 4, 2, 3, 8, 3, 3, 4, 0, 4, 0, 3, 0, 3,
+	4, 5, 4, 4, 5, 2, 3, 3, 3, 4, 0, 8, 8, 0, 5, 3,
+	4, 0, 8, 3, 4, 4, 8, 0, 3, 0, 8, 3, 5, 0, 5, 5,
+	0, 5, 5, 0, 8, 4, 8, 0, 8, 3, 5, 0, 4, 5, 5, 0,
+	5, 3, 8, 8, 4, 8, 0, 5, 0, 3, 0, 4, 5, 5, 0, 5,
+	0, 3, 8, 0, 8, 0, 4, 8, 8, 0, 3, 4, 8, 0, 8, 8,
+	3, 4, 8, 4, 8, 0, 3, 8, 3, 4, 8, 0, 8, 8, 0, 3,
+	4, 8, 4, 0, 5, 0, 3, 3, 4, 5, 0, 5, 5, 3, 4, 5,
+	0, 5, 5, 0, 3, 0, 8, 0, 5, 5, 4, 5, 4, 0, 5, 3,
+	3, 4, 8, 0, 8, 8, 0, 8, 3, 4, 0, 4, 0, 8, 3, 3,
+	4, 5, 0, 5, 3, 4, 5, 4, 5, 0, 3, 3, 4, 8, 0, 5,
+	5, 0, 3, 4, 5, 4, 0, 5, 3, 0, 3, 0, 8, 8, 4, 0,
+	5, 5, 3, 0, 4, 0, 4, 0, 3, 8, 3, 4, 5, 0, 5, 0,
+	3, 4, 5, 4, 5, 0, 3, 0, 3, 4, 0, 5, 5, 4, 0, 5,
+	3, 3, 4, 0, 5, 5, 0, 5, 3, 5, 4, 0, 5, 5, 3, 5,
+	0, 5, 0, 4, 0, 5, 5, 0, 5, 0, 3, 4, 0, 8, 8, 3,
+	4, 0, 8, 8, 0, 3, 4, 5, 5, 3, 4, 8, 8, 0, 8, 3,
+	4, 5, 5, 0, 3, 4, 8, 8, 0, 8, 0, 3, 4, 5, 5, 0,
+	4, 0, 3, 3, 4, 8, 4, 8, 8, 0, 3, 3, 0, 5, 4, 8,
+	8, 0, 8, 8, 3, 4, 5, 4, 0, 3, 3, 4, 8, 0, 5, 0,
+	3, 4, 4, 0, 5, 3, 5, 3, 4, 0, 4, 0, 8, 8, 0, 3,
+	3, 4, 5, 0, 3, 4, 8, 8, 0, 8, 8, 0, 3, 4, 5, 4,
+	0, 3, 0, 3, 0, 8, 0, 5, 0, 4, 4, 0, 5, 3, 5, 0,
+	3, 5, 4, 5, 0, 5, 5, 3, 5, 0, 4, 5, 0, 4, 0, 3,
+	3, 4, 8, 4, 5, 0, 3, 0, 3, 4, 5, 0, 4, 0, 3, 0,
+	3, 4, 8, 4, 5, 0, 3, 3, 4, 8, 0, 8, 0, 5, 3, 4,
+	8, 0, 8, 0, 5, 0, 3, 4, 0, 5, 5, 3, 4, 0, 8, 8,
+	0, 8, 3, 4, 0, 5, 5, 0, 3, 4, 0, 8, 8, 0, 8, 0,
+	3, 4, 4, 0, 8, 8, 3, 5, 3, 4, 4, 0, 8, 8, 3, 5,
+	0, 3, 0, 8, 8, 0, 5, 5, 0, 4, 4, 7, 0, 8, 3, 3,
+	4, 4, 10, 0, 3, 3, 4, 4, 2, 5, 3, 3, 4, 4, 4, 5,
+	0, 3, 3, 3, 0, 4, 4, 2, 3, 3, 8, 8, 0, 8, 8, 0,
+	8, 8, 0, 4, 8, 8, 0, 5, 0, 3, 0, 4, 8, 0, 3, 0,
+	4, 4, 2, 5, 0, 3, 3, 5, 4, 5, 0, 5, 5, 0, 3, 4,
+	0, 8, 0, 5, 5, 3, 0, 4, 4, 2, 8, 0, 3, 3, 5, 4,
+	0, 5, 5, 0, 5, 0, 3, 4, 4, 2, 8, 3, 3, 4, 4, 10,
+	8, 3, 3, 4, 4, 10, 8, 0, 3, 3, 4, 0, 5, 3, 0, 4,
+	4, 10, 0, 5, 0, 3, 3, 4, 4, 7, 0, 3, 3, 4, 4, 10,
+	0, 5, 3, 3, 4, 4, 2, 8, 8, 3, 3, 4, 4, 2, 8, 8,
+	0, 3, 3, 4, 0, 3, 0, 4, 4, 4, 0, 7, 3, 3, 3, 4,
+	5, 4, 2, 8, 3, 3, 4, 0, 4, 10, 0, 3, 3, 4, 4, 4,
+	7, 3, 3, 3, 4, 4, 4, 7, 0, 3, 3, 3, 4, 4, 0, 3,
+	0, 3, 0, 8, 8, 8, 4, 0, 5, 5, 3, 8, 8, 0, 5, 8,
+	4, 4, 8, 0, 3, 3, 8, 8, 8, 8, 0, 5, 5, 4, 5, 0,
+	4, 2, 8, 3, 3, 4, 5, 5, 4, 7, 0, 3, 3, 5, 5, 0,
+	5, 5, 0, 5, 4, 4, 0, 3, 3, 8, 4, 8, 0, 3, 8, 8,
+	4, 4, 8, 0, 3, 3, 4, 0, 5, 0, 3, 0, 4, 4, 8, 8,
+	0, 3, 3, 8, 4, 4, 5, 0, 3, 0, 3, 0, 4, 0, 8, 0,
+	5, 3, 0, 4, 4, 0, 8, 3, 3, 8, 5, 5, 4, 0, 5, 5,
+	3, 5, 4, 0, 4, 2, 3, 3, 4, 4, 4, 0, 7, 3, 0, 3,
+	3, 5, 5, 4, 5, 0, 5, 0, 3, 4, 0, 8, 0, 3, 0, 4,
+	4, 4, 7, 3, 0, 3, 3, 5, 5, 4, 0, 5, 5, 0, 3, 4,
+	0, 4, 0, 3, 0, 3, 0, 4, 5, 4, 4, 7, 0, 3, 3, 3,
+	4, 0, 3, 8, 8, 0, 5, 4, 0, 3, 8, 4, 4, 8, 0, 3,
+	0, 3, 8, 5, 0, 5, 5, 0, 5, 5, 8, 4, 8, 0, 8, 3,
+	5, 8, 0, 8, 8, 0, 5, 8, 8, 4, 8, 0, 5, 0, 3, 4,
+	4, 0, 3, 0, 3, 8, 8, 0, 8, 8, 4, 8, 0, 3, 4, 8,
+	0, 8, 3, 8, 4, 8, 4, 8, 0, 3, 3, 8, 4, 8, 0, 8,
+	8, 0, 3, 0, 8, 4, 4, 0, 5, 0, 3, 3, 4, 5, 0, 5,
+	5, 3, 0, 4, 5, 0, 5, 5, 0, 3, 0, 0, 8, 0, 5, 5,
+	0, 4, 5, 4, 2, 5, 3, 3, 4, 8, 0, 8, 8, 0, 3, 8,
+	4, 0, 4, 2, 8, 3, 3, 4, 5, 0, 5, 3, 0, 4, 5, 4,
+	7, 0, 3, 3, 4, 8, 0, 5, 5, 0, 3, 0, 4, 5, 4, 4,
+	7, 3, 3, 3, 0, 8, 8, 4, 0, 5, 5, 3, 4, 0, 4, 0,
+	3, 3, 8, 4, 0, 8, 0, 3, 8, 8, 4, 4, 0, 8, 0, 3,
+	3, 5, 0, 5, 5, 4, 0, 5, 0, 3, 4, 0, 5, 5, 0, 5,
+	3, 0, 5, 4, 0, 5, 5, 3, 5, 0, 5, 4, 0, 4, 0, 3,
+	0, 3, 8, 4, 0, 8, 3, 8, 4, 0, 8, 8, 0, 3, 0, 4,
+	5, 5, 3, 0, 4, 8, 8, 0, 3, 8, 4, 5, 5, 0, 3, 0,
+	8, 4, 8, 0, 8, 0, 3, 4, 8, 8, 4, 10, 0, 3, 3, 8,
+	4, 4, 8, 8, 0, 3, 3, 0, 5, 0, 4, 8, 8, 0, 8, 3,
+	8, 4, 5, 4, 2, 3, 3, 4, 8, 0, 5, 0, 3, 0, 4, 4,
+	0, 5, 3, 5, 3, 0, 4, 0, 4, 2, 8, 8, 0, 3, 3, 4,
+	5, 0, 3, 0, 4, 5, 5, 4, 2, 8, 3, 3, 8, 8, 4, 5,
+	0, 5, 3, 0, 8, 0, 5, 4, 0, 4, 0, 8, 3, 3, 8, 5,
+	4, 5, 0, 5, 5, 3, 5, 4, 5, 0, 4, 2, 3, 3, 4, 8,
+	4, 5, 0, 3, 0, 3, 0, 4, 5, 0, 4, 0, 3, 0, 3, 0,
+	8, 4, 4, 5, 0, 3, 3, 0, 4, 8, 0, 8, 3, 5, 8, 4,
+	0, 8, 0, 5, 0, 3, 4, 0, 5, 5, 3, 0, 4, 0, 8, 8,
+	0, 3, 8, 4, 0, 5, 5, 0, 3, 0, 8, 4, 4, 0, 8, 8,
+	3, 3, 4, 4, 2, 8, 3, 8, 3, 5, 8, 4, 4, 0, 8, 8,
+	0, 3, 3, 0, 4, 0, 3, 4, 4, 4, 10, 0, 3, 3, 3, 5,
+	4, 4, 0, 8, 3, 3, 4, 4, 10, 0, 3, 0, 3, 4, 4, 2,
+	5, 3, 0, 3, 4, 4, 4, 0, 10, 3, 3, 3, 4, 4, 2, 3,
+	0, 3, 4, 4, 0, 4, 10, 0, 3, 3, 3, 0, 8, 8, 0, 5,
+	0, 0, 8, 0, 4, 4, 10, 0, 3, 8, 3, 5, 4, 5, 0, 5,
+	5, 3, 4, 4, 2, 4, 2, 3, 3, 3, 4, 4, 2, 8, 0, 3,
+	0, 3, 5, 4, 0, 5, 5, 0, 5, 3, 4, 4, 2, 3, 8, 3,
+	0, 4, 8, 0, 8, 3, 4, 4, 10, 8, 0, 3, 0, 3, 4, 4,
+	7, 3, 0, 3, 4, 4, 7, 4, 2, 3, 3, 3, 4, 4, 7, 0,
+	3, 0, 3, 0, 4, 0, 8, 0, 5, 3, 4, 4, 2, 8, 3, 8,
+	3, 4, 4, 2, 8, 8, 0, 3, 0, 3, 0, 4, 0, 3, 0, 4,
+	4, 4, 10, 0, 3, 3, 3, 0, 5, 4, 4, 2, 8, 3, 3, 4,
+	4, 10, 0, 3, 0, 3, 0, 4, 4, 2, 5, 3, 0, 3, 0, 4,
+	4, 4, 7, 2, 3, 3, 3, 4, 4, 2, 3, 0, 3, 0, 8, 8,
+	8, 4, 0, 5, 5, 0, 3, 0, 8, 8, 0, 5, 0, 8, 4, 4,
+	10, 0, 3, 3, 8, 0, 8, 8, 8, 0, 5, 5, 5, 4, 0, 4,
+	2, 8, 3, 3, 5, 4, 5, 4, 7, 0, 3, 3, 0, 5, 5, 0,
+	5, 5, 0, 5, 4, 4, 2, 3, 3, 8, 4, 8, 0, 3, 0, 8,
+	8, 4, 4, 8, 0, 3, 0, 3, 4, 4, 7, 3, 0, 3, 0, 4,
+	4, 10, 8, 0, 3, 3, 8, 4, 4, 7, 0, 3, 0, 3, 0, 0,
+	4, 0, 8, 0, 5, 3, 0, 4, 4, 2, 8, 3, 3, 8, 4, 4,
+	10, 4, 7, 0, 3, 3, 3, 4, 0, 4, 2, 3, 0, 3, 4, 5,
+	4, 4, 0, 10, 3, 3, 3, 5, 5, 4, 5, 0, 5, 3, 4, 0,
+	3, 0, 8, 0, 4, 0, 4, 10, 0, 3, 8, 3, 5, 5, 4, 0,
+	5, 5, 3, 4, 0, 4, 2, 3, 0, 3, 0, 4, 5, 4, 4, 7,
+	2, 3, 3, 3, 5, 5, 4, 5, 0, 5, 3, 0, 4, 0, 3, 0,
+	8, 4, 0, 4, 10, 0, 3, 3, 8, 5, 5, 4, 0, 5, 5, 3,
+	0, 8, 8, 0, 8, 0, 5, 8, 8, 8, 0, 5, 8, 8, 0, 8,
+	0, 5, 0, 8, 8, 8, 0, 5, 0, 8, 8, 8, 8, 0, 4, 8,
+	0, 3, 8, 8, 5, 5, 4, 0, 5, 3, 5, 4, 8, 0, 3, 8,
+	8, 0, 5, 5, 4, 0, 5, 3, 5, 0, 5, 5, 0, 5, 5, 5,
+	5, 0, 5, 5, 0, 4, 8, 0, 8, 3, 8, 8, 4, 5, 4, 2,
+	5, 3, 0, 3, 5, 4, 4, 7, 3, 5, 0, 5, 3, 4, 0, 4,
+	2, 3, 8, 3, 4, 5, 4, 7, 3, 0, 3, 4, 5, 4, 7, 0,
+	3, 0, 3, 4, 8, 0, 8, 3, 8, 8, 0, 5, 5, 4, 4, 7,
+	0, 3, 3, 0, 8, 8, 4, 0, 5, 5, 0, 3, 4, 0, 4, 2,
+	3, 3, 8, 4, 0, 8, 0, 3, 0, 8, 4, 5, 4, 7, 0, 3,
+	0, 3, 0, 5, 0, 5, 5, 4, 0, 5, 3, 5, 0, 5, 5, 0,
+	5, 5, 0, 5, 5, 4, 0, 5, 3, 0, 5, 0, 5, 5, 0, 5,
+	0, 4, 0, 3, 8, 8, 4, 0, 3, 8, 8, 0, 8, 0, 8, 8,
+	8, 4, 8, 0, 3, 8, 8, 0, 8, 8, 0, 8, 4, 8, 0, 8,
+	3, 5, 4, 0, 5, 3, 5, 5, 5, 4, 0, 5, 3, 5, 5, 0,
+	0, 5, 0, 4, 0, 3, 4, 8, 8, 0, 3, 8, 8, 4, 5, 4,
+	2, 3, 0, 3, 8, 4, 0, 5, 0, 3, 0, 4, 0, 4, 2, 8,
+	3, 8, 3, 5, 4, 4, 2, 8, 8, 3, 5, 3, 0, 5, 0, 4,
+	0, 3, 0, 4, 8, 8, 0, 3, 8, 8, 0, 4, 5, 4, 2, 3,
+	0, 3, 0, 8, 4, 0, 5, 0, 3, 4, 0, 4, 2, 8, 3, 3,
+	8, 8, 4, 4, 5, 4, 2, 3, 3, 3, 4, 0, 8, 0, 3, 8,
+	8, 5, 4, 5, 0, 5, 3, 5, 4, 0, 8, 0, 3, 8, 8, 0,
+	5, 4, 5, 0, 5, 3, 5, 0, 0, 8, 0, 8, 0, 5, 0, 8,
+	0, 8, 0, 5, 0, 4, 0, 8, 3, 8, 8, 4, 0, 8, 8, 0,
+	3, 0, 8, 4, 0, 8, 3, 8, 8, 0, 8, 4, 4, 0, 8, 3,
+	8, 3, 5, 4, 0, 5, 5, 3, 5, 5, 4, 0, 5, 5, 3, 5,
+	0, 0, 4, 0, 4, 0, 3, 3, 4, 8, 8, 0, 3, 8, 8, 8,
+	5, 4, 4, 0, 8, 0, 3, 3, 0, 4, 0, 8, 0, 3, 4, 4,
+	4, 10, 3, 8, 3, 3, 5, 4, 4, 0, 8, 8, 3, 3, 0, 4,
+	0, 4, 0, 3, 0, 3, 5, 4, 4, 4, 5, 2, 3, 3, 3, 0,
+	4, 0, 8, 8, 0, 5, 3, 0, 4, 0, 8, 3, 4, 4, 10, 0,
+	3, 0, 8, 3, 5, 4, 4, 0, 8, 3, 8, 3, 8, 4, 5, 0,
+	5, 3, 5, 5, 4, 5, 0, 5, 3, 5, 4, 5, 4, 0, 5, 3,
+	0, 3, 5, 4, 5, 0, 5, 0, 3, 0, 8, 0, 8, 0, 0, 4,
+	8, 8, 0, 3, 8, 0, 5, 5, 0, 5, 5, 4, 4, 0, 5, 3,
+	5, 3, 0, 4, 8, 0, 8, 8, 0, 3, 5, 4, 4, 0, 5, 3,
+	5, 0, 3, 5, 4, 0, 5, 5, 3, 5, 4, 0, 5, 5, 0, 3,
+	5, 4, 4, 10, 0, 3, 3, 4, 8, 8, 0, 3, 8, 8, 8, 0,
+	5, 4, 4, 2, 8, 0, 3, 3, 0, 4, 0, 8, 0, 3, 0, 4,
+	4, 4, 10, 3, 10, 3, 3, 5, 4, 4, 2, 8, 8, 3, 3, 5,
+	4, 0, 4, 10, 0, 3, 3, 5, 4, 4, 4, 7, 0, 3, 3, 3,
+	0, 4, 0, 3, 8, 8, 0, 5, 0, 4, 0, 3, 8, 4, 4, 10,
+	0, 3, 0, 3, 8, 5, 4, 4, 0, 8, 3, 3, 8, 8, 4, 5,
+	0, 5, 3, 5, 0, 5, 4, 5, 0, 5, 3, 0, 0, 8, 8, 4,
+	8, 0, 5, 0, 3, 4, 4, 2, 3, 0, 3, 8, 0, 8, 0, 8,
+	8, 4, 0, 8, 0, 3, 8, 0, 5, 5, 0, 5, 0, 5, 4, 4,
+	0, 5, 3, 5, 3, 0, 0, 4, 8, 0, 8, 8, 0, 3, 0, 4,
+	4, 10, 4, 7, 3, 0, 3, 3, 5, 4, 0, 5, 5, 3, 0, 5,
+	4, 0, 5, 5, 0, 3, 0, 5, 4, 4, 10, 0, 3, 0, 3, 5,
+	4, 4, 4, 0, 10, 3, 3, 3, 0, 5, 5, 4, 5, 0, 5, 3,
+	0, 4, 0, 3, 0, 8, 0, 4, 4, 2, 8, 3, 3, 8, 8, 5,
+	4, 4, 2, 8, 3, 8, 3, 5, 4, 4, 10, 0, 3, 0, 3, 0,
+	5, 4, 4, 4, 7, 2, 3, 3, 3, 0, 5, 5, 4, 5, 0, 5,
+	3, 0, 0, 4, 0, 3, 0, 8, 4, 4, 2, 8, 3, 3, 8, 8,
+	0, 5, 4, 4, 2, 8, 3, 3, 8, 0, 8, 8, 0, 8, 0, 5,
+	0, 8, 8, 8, 0, 5, 0, 8, 8, 0, 8, 0, 5, 0, 0, 8,
+	8, 8, 0, 5, 0, 0, 8, 8, 0, 8, 8, 0, 4, 8, 0, 3,
+	0, 8, 8, 0, 5, 5, 4, 0, 5, 3, 5, 4, 8, 0, 3, 0,
+	8, 8, 0, 0, 5, 5, 4, 0, 5, 3, 5, 0, 0, 5, 5, 0,
+	5, 5, 0, 5, 5, 0, 5, 5, 0, 8, 4, 5, 5, 3, 5, 5,
+	5, 4, 0, 5, 3, 4, 8, 0, 3, 8, 8, 0, 8, 5, 5, 4,
+	0, 5, 0, 3, 5, 5, 0, 5, 5, 5, 4, 5, 0, 3, 8, 4,
+	5, 5, 3, 5, 0, 5, 5, 4, 0, 5, 3, 0, 4, 8, 0, 3,
+	8, 8, 0, 8, 0, 5, 5, 4, 0, 5, 0, 3, 0, 5, 5, 0,
+	5, 0, 5, 5, 4, 5, 0, 3, 0, 5, 5, 4, 4, 2, 5, 3,
+	0, 3, 5, 5, 4, 4, 7, 3, 0, 3, 5, 5, 4, 4, 2, 5,
+	3, 0, 3, 0, 5, 5, 4, 4, 7, 3, 0, 3, 0, 4, 0, 3,
+	0, 8, 8, 4, 0, 3, 0, 8, 8, 0, 8, 8, 8, 8, 8, 0,
+	8, 8, 8, 8, 0, 8, 8, 0, 8, 0, 8, 8, 4, 8, 0, 3,
+	8, 4, 8, 8, 0, 3, 8, 0, 8, 8, 8, 8, 4, 8, 0, 3,
+	8, 8, 8, 0, 8, 8, 0, 8, 8, 4, 8, 0, 8, 3, 8, 5,
+	4, 0, 5, 3, 5, 5, 4, 4, 7, 3, 5, 0, 3, 8, 0, 8,
+	8, 8, 0, 8, 4, 8, 0, 3, 8, 8, 0, 8, 0, 8, 8, 0,
+	8, 0, 8, 4, 8, 0, 8, 8, 3, 5, 4, 0, 5, 3, 5, 0,
+	5, 4, 4, 7, 3, 5, 0, 3, 0, 8, 0, 8, 8, 4, 8, 0,
+	3, 8, 4, 8, 0, 8, 8, 0, 3, 0, 8, 8, 4, 0, 8, 8,
+	0, 3, 8, 4, 8, 0, 8, 8, 0, 3, 0, 4, 0, 8, 8, 3,
+	5, 0, 4, 0, 8, 8, 3, 5, 0, 5, 0, 5, 5, 5, 0, 5,
+	5, 4, 0, 3, 5, 0, 5, 5, 0, 8, 4, 5, 0, 5, 5, 3,
+	5, 0, 5, 5, 0, 4, 0, 3, 8, 4, 5, 0, 5, 5, 0, 3,
+	8, 0, 5, 5, 5, 4, 4, 0, 5, 3, 3, 8, 0, 8, 8, 0,
+	8, 8, 5, 4, 4, 0, 5, 0, 3, 3, 5, 4, 0, 5, 3, 5,
+	4, 4, 5, 0, 3, 3, 8, 0, 5, 5, 4, 0, 3, 5, 4, 4,
+	0, 5, 3, 0, 3, 8, 8, 4, 0, 5, 5, 3, 0, 8, 0, 8,
+	0, 5, 5, 0, 5, 4, 0, 5, 0, 3, 5, 4, 4, 5, 0, 3,
+	0, 3, 4, 0, 8, 0, 5, 3, 5, 5, 4, 4, 7, 3, 5, 0,
+	5, 3, 8, 8, 4, 0, 8, 8, 0, 3, 8, 4, 5, 0, 5, 5,
+	3, 5, 5, 0, 0, 4, 0, 8, 8, 3, 0, 4, 0, 8, 8, 0,
+	3, 5, 0, 5, 5, 4, 5, 4, 0, 3, 3, 5, 4, 5, 0, 3,
+	8, 4, 5, 0, 5, 3, 0, 5, 4, 5, 0, 4, 0, 3, 3, 8,
+	4, 5, 4, 7, 0, 3, 3, 8, 0, 5, 5, 0, 5, 4, 4, 2,
+	5, 3, 3, 8, 0, 8, 8, 0, 8, 8, 0, 5, 4, 4, 2, 5,
+	0, 3, 3, 5, 4, 0, 5, 3, 0, 5, 4, 4, 7, 0, 3, 3,
+	8, 0, 5, 5, 4, 0, 3, 0, 5, 4, 4, 4, 7, 3, 3, 3,
+	8, 8, 4, 0, 5, 5, 3, 8, 0, 8, 0, 5, 5, 5, 4, 0,
+	5, 0, 3, 0, 8, 4, 5, 4, 0, 5, 3, 3, 4, 0, 8, 0,
+	5, 3, 5, 5, 0, 4, 4, 7, 3, 5, 0, 5, 3, 0, 8, 8,
+	4, 0, 8, 8, 0, 8, 3, 4, 5, 0, 5, 5, 3, 5, 5, 0,
+	4, 0, 8, 3, 8, 0, 4, 0, 8, 8, 0, 3, 0, 5, 0, 5,
+	0, 5, 4, 5, 4, 2, 3, 3, 5, 4, 5, 0, 3, 0, 8, 4,
+	5, 0, 5, 3, 5, 4, 5, 0, 4, 2, 3, 3, 8, 4, 5, 4,
+	5, 0, 3, 3, 8, 0, 5, 5, 0, 4, 0, 3, 5, 4, 4, 2,
+	5, 3, 0, 3, 8, 8, 4, 0, 5, 5, 0, 3, 0, 4, 0, 8,
+	8, 3, 5, 5, 0, 5, 4, 4, 7, 3, 0, 3, 5, 4, 4, 7,
+	0, 3, 0, 3, 8, 0, 5, 5, 0, 4, 0, 3, 0, 5, 4, 4,
+	2, 5, 3, 0, 3, 0, 8, 8, 4, 0, 5, 5, 0, 3, 4, 0,
+	8, 8, 3, 5, 5, 5, 4, 4, 7, 3, 0, 3, 0, 5, 4, 4,
+	7, 0, 3, 0, 3, 0, 4, 5, 5, 3, 5, 4, 0, 5, 3, 4,
+	5, 5, 3, 5, 0, 5, 4, 5, 5, 3, 5, 4, 0, 5, 3, 0,
+	4, 5, 5, 3, 5, 0, 5, 0, 0, 4, 0, 3, 8, 8, 0, 4,
+	0, 3, 8, 8, 0, 0, 8, 0, 8, 8, 8, 4, 0, 8, 0, 3,
+	8, 0, 8, 0, 8, 8, 0, 8, 4, 5, 0, 5, 0, 3, 4, 5,
+	0, 5, 3, 5, 5, 4, 5, 0, 5, 3, 5, 5, 0, 8, 4, 0,
+	5, 5, 3, 5, 0, 5, 5, 4, 0, 5, 3, 4, 8, 0, 3, 0,
+	8, 8, 0, 8, 0, 5, 5, 4, 0, 5, 0, 3, 0, 5, 5, 0,
+	5, 0, 5, 5, 4, 5, 0, 3, 8, 4, 0, 5, 5, 3, 5, 0,
+	0, 5, 5, 4, 0, 5, 3, 0, 4, 8, 0, 3, 0, 8, 8, 0,
+	8, 0, 0, 5, 5, 4, 0, 5, 0, 3, 0, 0, 5, 5, 0, 5,
+	0, 0, 5, 5, 4, 5, 0, 3, 0, 0, 5, 5, 4, 4, 2, 5,
+	3, 0, 3, 4, 0, 5, 5, 3, 5, 0, 5, 5, 5, 4, 4, 4,
+	7, 2, 3, 3, 3, 4, 0, 5, 5, 3, 5, 0, 5, 0, 0, 4,
+	0, 3, 0, 8, 8, 0, 4, 0, 3, 0, 8, 8, 0, 0, 8, 8,
+	8, 0, 8, 8, 0, 8, 0, 8, 8, 8, 0, 0, 8, 8, 0, 8,
+	0, 0, 8, 8, 4, 8, 0, 3, 8, 4, 0, 8, 8, 0, 3, 5,
+	5, 8, 8, 0, 8, 8, 5, 5, 4, 0, 3, 8, 4, 5, 5, 3,
+	0, 8, 8, 4, 8, 0, 3, 8, 8, 4, 8, 8, 0, 3, 8, 5,
+	5, 0, 8, 8, 0, 8, 8, 0, 5, 5, 4, 0, 3, 0, 8, 4,
+	5, 5, 3, 8, 8, 4, 8, 0, 8, 3, 8, 4, 8, 8, 0, 8,
+	3, 5, 5, 0, 4, 0, 3, 8, 4, 5, 5, 0, 3, 0, 5, 5,
+	0, 4, 0, 3, 0, 8, 4, 5, 5, 0, 3, 8, 8, 4, 8, 0,
+	8, 0, 3, 8, 4, 8, 8, 0, 8, 0, 3, 4, 0, 5, 3, 5,
+	5, 4, 0, 3, 0, 8, 8, 0, 8, 4, 0, 5, 3, 5, 5, 0,
+	4, 0, 3, 0, 8, 8, 0, 8, 0, 8, 8, 4, 4, 8, 8, 0,
+	3, 3, 8, 4, 8, 4, 8, 8, 0, 3, 3, 5, 8, 8, 0, 8,
+	8, 8, 5, 4, 4, 0, 3, 3, 8, 0, 5, 0, 4, 0, 3, 4,
+	4, 2, 5, 3, 5, 3, 8, 4, 8, 8, 0, 3, 8, 8, 5, 4,
+	0, 3, 8, 8, 0, 8, 8, 0, 8, 8, 8, 4, 5, 5, 3, 0,
+	8, 0, 5, 0, 4, 4, 2, 5, 3, 5, 0, 3, 8, 4, 8, 8,
+	0, 8, 3, 8, 5, 4, 0, 4, 0, 3, 3, 8, 4, 5, 4, 2,
+	3, 0, 3, 5, 4, 0, 4, 0, 3, 0, 3, 8, 4, 5, 4, 2,
+	3, 3, 4, 8, 0, 8, 3, 5, 0, 8, 4, 8, 0, 5, 0, 3,
+	0, 4, 0, 5, 3, 5, 0, 4, 0, 8, 8, 0, 8, 3, 4, 4,
+	7, 3, 5, 0, 3, 4, 0, 8, 0, 5, 3, 5, 0, 4, 4, 2,
+	8, 8, 3, 5, 3, 4, 4, 2, 8, 8, 3, 5, 0, 3, 5, 0,
+	8, 8, 0, 8, 8, 8, 0, 5, 4, 4, 2, 3, 3, 8, 0, 5,
+	0, 4, 0, 3, 0, 4, 4, 2, 5, 3, 5, 3, 0, 8, 4, 8,
+	8, 0, 3, 8, 8, 0, 5, 4, 0, 3, 0, 8, 8, 0, 8, 8,
+	0, 8, 0, 8, 8, 4, 5, 5, 3, 8, 0, 5, 8, 8, 4, 8,
+	0, 8, 8, 3, 8, 4, 8, 8, 0, 8, 8, 3, 5, 4, 0, 4,
+	2, 3, 3, 8, 4, 5, 4, 2, 3, 0, 3, 0, 8, 8, 4, 8,
+	8, 0, 8, 3, 8, 4, 5, 4, 0, 3, 3, 4, 8, 0, 8, 3,
+	5, 8, 4, 8, 0, 5, 0, 3, 4, 0, 5, 3, 5, 0, 0, 4,
+	0, 8, 8, 0, 3, 8, 4, 4, 7, 3, 5, 0, 3, 0, 4, 0,
+	8, 0, 5, 3, 5, 4, 4, 0, 8, 3, 8, 3, 5, 4, 4, 2,
+	8, 8, 3, 5, 0, 3, 0, 5, 0, 4, 0, 3, 5, 5, 4, 4,
+	0, 8, 3, 3, 5, 4, 4, 2, 3, 0, 3, 8, 4, 5, 0, 3,
+	0, 4, 4, 4, 7, 3, 3, 5, 0, 3, 8, 4, 5, 5, 4, 2,
+	8, 3, 3, 5, 0, 4, 0, 3, 0, 5, 5, 4, 4, 2, 8, 3,
+	3, 8, 8, 4, 5, 5, 0, 3, 8, 4, 5, 0, 3, 8, 8, 4,
+	8, 0, 8, 8, 0, 3, 8, 4, 8, 8, 0, 8, 8, 0, 3, 5,
+	4, 0, 4, 2, 3, 0, 3, 4, 5, 5, 0, 5, 3, 5, 5, 4,
+	0, 4, 2, 3, 0, 3, 0, 4, 5, 5, 0, 5, 3, 5, 0, 8,
+	0, 8, 0, 5, 8, 0, 8, 0, 5, 0, 0, 4, 0, 8, 3, 8,
+	8, 0, 4, 0, 8, 8, 0, 3, 0, 8, 0, 4, 0, 8, 3, 8,
+	8, 0, 8, 4, 4, 0, 5, 3, 5, 0, 3, 4, 5, 0, 5, 5,
+	3, 5, 4, 5, 0, 5, 5, 3, 5, 0, 0, 8, 0, 8, 8, 8,
+	4, 5, 4, 2, 5, 3, 5, 3, 0, 8, 0, 8, 8, 0, 8, 8,
+	4, 5, 0, 4, 2, 3, 3, 4, 5, 0, 5, 3, 5, 4, 5, 4,
+	7, 3, 5, 0, 3, 0, 8, 0, 8, 8, 8, 0, 4, 5, 4, 2,
+	5, 3, 5, 3, 0, 0, 8, 0, 8, 8, 0, 8, 0, 8, 4, 5,
+	0, 4, 0, 3, 3, 4, 5, 0, 5, 3, 5, 0, 4, 5, 4, 7,
+	3, 5, 0, 3, 0, 5, 5, 4, 4, 10, 0, 3, 0, 3, 4, 0,
+	5, 5, 0, 5, 3, 5, 0, 8, 8, 4, 0, 8, 8, 0, 3, 4,
+	0, 5, 5, 0, 5, 3, 5, 0, 4, 0, 8, 8, 3, 5, 4, 0,
+	8, 8, 3, 5, 0, 4, 5, 5, 3, 5, 4, 8, 8, 0, 8, 3,
+	5, 4, 5, 5, 3, 5, 0, 4, 8, 8, 0, 8, 3, 5, 0, 4,
+	5, 5, 3, 5, 0, 4, 0, 3, 8, 4, 8, 0, 8, 0, 5, 0,
+	3, 0, 5, 5, 0, 8, 8, 0, 8, 8, 0, 5, 5, 4, 0, 3,
+	8, 4, 0, 5, 5, 3, 0, 0, 8, 8, 4, 8, 0, 3, 8, 8,
+	4, 0, 8, 8, 0, 3, 8, 0, 5, 5, 0, 0, 8, 8, 0, 8,
+	8, 0, 0, 5, 5, 4, 0, 3, 0, 8, 4, 0, 5, 5, 3, 0,
+	8, 8, 4, 8, 0, 8, 3, 8, 4, 0, 8, 8, 0, 8, 3, 0,
+	5, 5, 0, 4, 0, 3, 8, 4, 0, 5, 5, 0, 3, 0, 0, 5,
+	5, 0, 4, 0, 3, 0, 8, 4, 0, 5, 5, 0, 3, 4, 8, 0,
+	8, 0, 5, 3, 5, 4, 8, 0, 8, 0, 5, 3, 5, 0, 4, 0,
+	5, 5, 3, 5, 4, 0, 8, 8, 0, 8, 3, 5, 4, 0, 5, 5,
+	3, 5, 0, 4, 0, 8, 8, 0, 8, 3, 5, 0, 4, 4, 0, 8,
+	8, 3, 5, 3, 5, 4, 4, 0, 8, 8, 3, 5, 3, 5, 0, 8,
+	8, 0, 5, 5, 8, 8, 8, 0, 5, 5, 5, 4, 4, 4, 8, 0,
+	3, 3, 3, 4, 4, 4, 0, 5, 3, 3, 3, 8, 8, 8, 4, 0,
+	5, 5, 3, 5, 4, 4, 4, 0, 3, 3, 3, 8, 8, 0, 8, 8,
+	0, 8, 8, 8, 4, 4, 8, 8, 0, 5, 0, 3, 3, 4, 4, 8,
+	0, 3, 3, 4, 4, 4, 0, 5, 0, 3, 3, 3, 4, 4, 5, 5,
+	0, 5, 5, 0, 3, 3, 4, 4, 0, 8, 0, 5, 5, 3, 3, 4,
+	4, 4, 0, 8, 0, 3, 3, 3, 8, 8, 4, 8, 8, 0, 3, 8,
+	8, 8, 4, 4, 4, 0, 8, 3, 3, 3, 4, 4, 8, 0, 8, 0,
+	3, 3, 4, 4, 4, 8, 8, 0, 3, 3, 3, 4, 4, 0, 5, 3,
+	3, 4, 4, 4, 8, 0, 5, 0, 3, 3, 3, 4, 4, 4, 5, 0,
+	3, 3, 3, 4, 4, 0, 8, 0, 5, 0, 3, 3, 4, 4, 4, 0,
+	8, 8, 3, 3, 3, 4, 4, 4, 0, 8, 8, 0, 3, 3, 3, 4,
+	4, 0, 3, 3, 8, 8, 0, 8, 8, 8, 0, 8, 8, 4, 4, 4,
+	4, 2, 3, 3, 3, 3, 4, 4, 4, 8, 0, 3, 0, 3, 3, 4,
+	4, 4, 0, 5, 3, 0, 3, 3, 4, 4, 4, 4, 5, 2, 3, 3,
+	3, 3, 4, 4, 4, 0, 3, 0, 3, 3, 8, 8, 0, 8, 8, 0,
+	8, 0, 8, 8, 4, 8, 8, 0, 5, 0, 3, 4, 8, 0, 3, 4,
+	4, 4, 8, 0, 3, 8, 3, 3, 4, 8, 8, 8, 0, 5, 5, 0,
+	3, 4, 4, 0, 8, 0, 5, 5, 0, 3, 3, 4, 4, 4, 0, 8,
+	0, 3, 0, 3, 3, 4, 5, 5, 0, 5, 5, 0, 5, 0, 3, 4,
+	4, 4, 0, 3, 8, 3, 3, 4, 4, 8, 0, 8, 3, 3, 4, 4,
+	8, 4, 8, 0, 3, 3, 3, 4, 4, 0, 5, 0, 3, 3, 4, 4,
+	4, 5, 4, 2, 3, 3, 3, 3, 4, 4, 4, 5, 0, 3, 0, 3,
+	3, 4, 4, 0, 8, 0, 5, 3, 3, 4, 4, 4, 0, 8, 3, 8,
+	3, 3, 4, 5, 5, 4, 0, 5, 5, 3, 5, 0, 3, 4, 4, 0,
+	4, 0, 3, 3, 3, 5, 5, 4, 5, 5, 3, 5, 0, 5, 5, 4,
+	4, 0, 8, 8, 0, 5, 0, 3, 3, 4, 4, 0, 8, 0, 3, 3,
+	4, 4, 0, 4, 0, 5, 0, 3, 3, 3, 4, 4, 4, 4, 2, 3,
+	8, 3, 3, 3, 4, 4, 0, 4, 0, 3, 0, 3, 3, 4, 4, 5,
+	4, 4, 5, 2, 3, 3, 3, 3, 4, 4, 0, 8, 8, 0, 5, 3,
+	3, 4, 4, 0, 8, 3, 3, 4, 4, 4, 8, 0, 3, 0, 8, 3,
+	3, 4, 5, 0, 5, 5, 0, 5, 5, 0, 3, 4, 8, 4, 8, 0,
+	8, 3, 5, 0, 3, 4, 4, 5, 5, 0, 5, 3, 3, 4, 8, 8,
+	4, 8, 0, 5, 0, 3, 0, 3, 4, 4, 5, 5, 0, 5, 0, 3,
+	3, 4, 8, 0, 8, 0, 3, 4, 4, 8, 8, 0, 3, 3, 4, 4,
+	8, 0, 8, 8, 3, 3, 4, 4, 8, 4, 8, 0, 3, 8, 3, 3,
+	4, 4, 8, 0, 8, 8, 0, 3, 3, 4, 4, 8, 4, 0, 5, 0,
+	3, 3, 3, 4, 4, 5, 0, 5, 5, 3, 3, 4, 4, 5, 0, 5,
+	5, 0, 3, 3, 4, 0, 8, 0, 5, 5, 3, 4, 4, 5, 4, 0,
+	5, 3, 3, 3, 4, 4, 8, 0, 8, 8, 0, 8, 3, 3, 4, 4,
+	0, 4, 0, 8, 3, 3, 3, 4, 4, 5, 0, 5, 3, 3, 4, 4,
+	5, 4, 5, 0, 3, 3, 3, 4, 4, 8, 0, 5, 5, 0, 3, 3,
+	4, 4, 5, 4, 0, 5, 3, 0, 3, 3, 4, 0, 8, 8, 4, 0,
+	5, 5, 3, 0, 3, 4, 4, 0, 4, 0, 3, 8, 3, 3, 4, 4,
+	5, 0, 5, 0, 3, 3, 4, 4, 5, 4, 5, 0, 3, 0, 3, 3,
+	4, 4, 0, 5, 5, 4, 0, 5, 3, 3, 3, 4, 4, 0, 5, 5,
+	0, 5, 3, 3, 4, 5, 4, 0, 5, 5, 3, 5, 0, 5, 0, 3,
+	4, 4, 0, 5, 5, 0, 5, 0, 3, 3, 4, 4, 0, 8, 8, 3,
+	3, 4, 4, 0, 8, 8, 0, 3, 3, 4, 4, 5, 5, 3, 3, 4,
+	4, 8, 8, 0, 8, 3, 3, 4, 4, 5, 5, 0, 3, 3, 4, 4,
+	8, 8, 0, 8, 0, 3, 3, 4, 4, 5, 5, 0, 4, 0, 3, 3,
+	3, 4, 4, 8, 4, 8, 8, 0, 3, 3, 3, 4, 0, 5, 3, 4,
+	4, 8, 8, 0, 8, 8, 3, 3, 4, 4, 5, 4, 0, 3, 3, 3,
+	4, 4, 8, 0, 5, 0, 3, 3, 4, 4, 4, 0, 5, 3, 5, 3,
+	3, 4, 4, 0, 4, 0, 8, 8, 0, 3, 3, 3, 4, 4, 5, 0,
+	3, 3, 4, 4, 8, 8, 0, 8, 8, 0, 3, 3, 4, 4, 5, 4,
+	0, 3, 0, 3, 3, 4, 0, 8, 0, 5, 0, 3, 4, 4, 4, 0,
+	5, 3, 5, 0, 3, 3, 4, 5, 4, 5, 0, 5, 5, 3, 5, 0,
+	3, 4, 4, 5, 0, 4, 0, 3, 3, 3, 4, 4, 8, 4, 5, 0,
+	3, 0, 3, 3, 4, 4, 5, 0, 4, 0, 3, 0, 3, 3, 4, 4,
+	8, 4, 5, 0, 3, 3, 3, 4, 4, 8, 0, 8, 0, 5, 3, 3,
+	4, 4, 8, 0, 8, 0, 5, 0, 3, 3, 4, 4, 0, 5, 5, 3,
+	3, 4, 4, 0, 8, 8, 0, 8, 3, 3, 4, 4, 0, 5, 5, 0,
+	3, 3, 4, 4, 0, 8, 8, 0, 8, 0, 3, 3, 4, 4, 4, 0,
+	8, 8, 3, 5, 3, 3, 4, 4, 4, 0, 8, 8, 3, 5, 0, 3,
+	3, 4, 0, 3, 8, 8, 0, 5, 5, 4, 0, 3, 4, 4, 4, 5,
+	2, 8, 3, 3, 3, 4, 4, 4, 8, 2, 3, 3, 3, 4, 4, 4,
+	2, 5, 3, 3, 3, 4, 4, 4, 4, 5, 0, 3, 3, 3, 0, 3,
+	4, 4, 4, 2, 3, 3, 3, 8, 8, 0, 8, 8, 0, 8, 8, 0,
+	8, 4, 4, 8, 8, 0, 5, 0, 3, 0, 3, 4, 4, 8, 0, 3,
+	0, 3, 4, 4, 4, 2, 5, 0, 3, 3, 3, 4, 5, 4, 5, 0,
+	5, 5, 0, 3, 3, 4, 4, 0, 8, 0, 5, 5, 3, 0, 3, 4,
+	4, 4, 2, 8, 0, 3, 3, 3, 4, 5, 4, 0, 5, 5, 0, 5,
+	0, 3, 3, 4, 4, 4, 2, 8, 3, 3, 3, 4, 4, 4, 10, 10,
+	3, 3, 3, 0, 4, 4, 4, 8, 8, 2, 3, 3, 3, 4, 4, 0,
+	5, 3, 0, 3, 4, 4, 4, 8, 2, 5, 0, 3, 3, 3, 4, 4,
+	4, 5, 2, 3, 3, 3, 4, 4, 4, 8, 2, 5, 3, 3, 3, 4,
+	4, 4, 2, 8, 8, 3, 3, 3, 4, 4, 4, 2, 8, 8, 0, 3,
+	3, 3, 4, 4, 0, 3, 0, 3, 5, 5, 5, 4, 5, 0, 5, 5,
+	3, 0, 4, 4, 5, 4, 2, 8, 3, 3, 3, 4, 4, 2, 4, 10,
+	0, 3, 3, 3, 4, 4, 0, 4, 2, 5, 3, 3, 3, 4, 4, 4,
+	4, 7, 0, 3, 3, 3, 3, 0, 8, 8, 8, 4, 5, 5, 3, 0,
+	8, 8, 8, 4, 0, 5, 5, 3, 0, 8, 8, 0, 5, 0, 8, 0,
+	8, 8, 0, 8, 0, 5, 5, 0, 8, 8, 8, 0, 5, 5, 0, 4,
+	4, 5, 0, 4, 2, 8, 3, 3, 3, 4, 4, 5, 5, 4, 5, 2,
+	3, 3, 3, 5, 5, 5, 0, 5, 5, 0, 5, 0, 5, 5, 5, 0,
+	5, 5, 5, 0, 4, 4, 8, 0, 3, 8, 3, 4, 8, 4, 4, 8,
+	0, 3, 3, 3, 4, 4, 0, 5, 0, 3, 0, 3, 4, 4, 4, 8,
+	8, 0, 3, 3, 8, 3, 5, 5, 5, 4, 5, 0, 5, 3, 5, 0,
+	5, 5, 5, 4, 5, 5, 3, 5, 0, 4, 4, 4, 0, 8, 3, 3,
+	8, 3, 5, 5, 5, 4, 0, 5, 5, 3, 5, 0, 4, 4, 0, 4,
+	2, 3, 3, 3, 4, 4, 4, 4, 8, 2, 3, 2, 3, 3, 3, 4,
+	5, 5, 4, 5, 0, 5, 0, 3, 3, 4, 4, 0, 8, 0, 3, 0,
+	3, 4, 4, 0, 4, 2, 5, 0, 3, 3, 3, 4, 5, 5, 4, 0,
+	5, 5, 0, 3, 3, 5, 5, 0, 5, 5, 4, 5, 5, 3, 0, 5,
+	5, 0, 5, 5, 4, 0, 5, 5, 3, 0, 5, 5, 0, 5, 5, 5,
+	0, 5, 0, 4, 4, 0, 3, 8, 3, 4, 4, 4, 8, 0, 3, 0,
+	3, 8, 3, 5, 5, 0, 5, 5, 0, 5, 5, 0, 4, 8, 4, 8,
+	0, 8, 3, 5, 3, 4, 8, 0, 8, 8, 0, 5, 3, 4, 8, 8,
+	4, 8, 0, 5, 0, 3, 3, 4, 4, 4, 0, 3, 0, 3, 8, 3,
+	4, 8, 0, 8, 3, 4, 8, 4, 8, 0, 3, 3, 4, 4, 8, 0,
+	8, 3, 8, 3, 4, 4, 8, 4, 8, 0, 3, 3, 8, 3, 4, 4,
+	8, 0, 8, 8, 0, 3, 0, 3, 4, 8, 4, 4, 0, 5, 0, 3,
+	3, 3, 4, 4, 5, 0, 5, 5, 3, 0, 3, 4, 4, 5, 0, 5,
+	5, 0, 3, 0, 3, 4, 0, 8, 0, 5, 5, 0, 3, 4, 4, 5,
+	4, 2, 5, 3, 3, 3, 4, 4, 8, 0, 8, 8, 0, 3, 8, 3,
+	4, 4, 0, 4, 2, 8, 3, 3, 3, 4, 4, 5, 0, 5, 3, 0,
+	3, 4, 4, 5, 4, 5, 2, 3, 3, 3, 4, 4, 8, 0, 5, 5,
+	0, 3, 0, 3, 4, 4, 5, 0, 4, 2, 5, 3, 3, 3, 5, 5,
+	4, 5, 5, 3, 5, 0, 5, 0, 5, 5, 4, 5, 5, 3, 5, 5,
+	0, 4, 4, 0, 8, 0, 3, 8, 3, 5, 5, 4, 5, 0, 5, 3,
+	5, 5, 0, 4, 5, 0, 5, 5, 4, 0, 5, 0, 3, 3, 4, 4,
+	0, 5, 5, 0, 5, 3, 0, 3, 5, 5, 4, 0, 5, 5, 3, 5,
+	0, 5, 0, 5, 5, 4, 0, 5, 5, 3, 5, 5, 0, 4, 4, 0,
+	8, 3, 8, 3, 4, 4, 0, 8, 8, 0, 3, 0, 3, 4, 4, 5,
+	5, 3, 0, 3, 4, 4, 8, 8, 0, 3, 8, 3, 4, 4, 5, 5,
+	0, 3, 0, 3, 4, 8, 4, 8, 0, 8, 0, 3, 3, 4, 4, 10,
+	8, 4, 10, 0, 3, 3, 3, 4, 8, 4, 4, 8, 8, 0, 3, 3,
+	3, 4, 0, 5, 0, 3, 4, 4, 8, 8, 0, 8, 3, 8, 3, 4,
+	4, 5, 4, 2, 3, 3, 3, 4, 4, 8, 0, 5, 0, 3, 0, 3,
+	4, 4, 4, 0, 5, 3, 5, 3, 0, 3, 4, 4, 0, 4, 2, 8,
+	8, 0, 3, 3, 3, 4, 4, 5, 0, 3, 0, 3, 4, 4, 5, 5,
+	4, 2, 8, 3, 3, 3, 4, 8, 8, 4, 5, 0, 5, 3, 3, 4,
+	0, 8, 0, 5, 3, 4, 4, 0, 4, 0, 8, 3, 3, 8, 3, 5,
+	5, 4, 5, 0, 5, 5, 3, 5, 0, 4, 4, 5, 0, 4, 2, 3,
+	3, 3, 4, 4, 8, 4, 5, 0, 3, 0, 3, 0, 3, 5, 5, 4,
+	0, 5, 5, 0, 5, 3, 5, 0, 4, 8, 4, 4, 5, 0, 3, 3,
+	3, 4, 0, 4, 8, 0, 8, 3, 5, 3, 4, 8, 4, 0, 8, 0,
+	5, 0, 3, 3, 4, 4, 0, 5, 5, 3, 0, 3, 4, 4, 0, 8,
+	8, 0, 3, 8, 3, 4, 4, 0, 5, 5, 0, 3, 0, 3, 4, 8,
+	4, 4, 0, 8, 8, 3, 3, 3, 4, 4, 4, 2, 8, 3, 8, 3,
+	5, 3, 4, 8, 4, 4, 0, 8, 8, 0, 3, 3, 3, 4, 0, 4,
+	0, 3, 3, 4, 4, 8, 8, 0, 8, 3, 8, 8, 3, 4, 5, 4,
+	4, 0, 8, 3, 3, 3, 4, 4, 4, 8, 2, 3, 0, 3, 3, 4,
+	4, 4, 2, 5, 3, 0, 3, 3, 4, 5, 4, 4, 0, 8, 8, 0,
+	3, 3, 3, 4, 4, 4, 2, 3, 0, 3, 3, 4, 4, 4, 2, 4,
+	8, 2, 3, 3, 3, 3, 4, 0, 8, 8, 0, 5, 0, 3, 4, 0,
+	8, 0, 3, 4, 4, 4, 8, 2, 3, 8, 3, 3, 4, 5, 4, 5,
+	0, 5, 5, 3, 3, 4, 4, 4, 2, 4, 2, 3, 3, 3, 3, 4,
+	4, 4, 2, 8, 0, 3, 0, 3, 3, 4, 5, 4, 0, 5, 5, 0,
+	5, 3, 3, 4, 4, 4, 2, 3, 8, 3, 3, 4, 0, 4, 8, 0,
+	8, 3, 3, 4, 4, 4, 8, 8, 2, 3, 0, 3, 3, 4, 0, 4,
+	0, 5, 0, 3, 3, 4, 4, 4, 8, 8, 2, 3, 8, 3, 3, 4,
+	4, 4, 5, 2, 3, 0, 3, 3, 4, 0, 4, 0, 8, 0, 5, 3,
+	3, 4, 4, 4, 2, 8, 3, 8, 3, 3, 4, 4, 4, 2, 8, 8,
+	0, 3, 0, 3, 3, 4, 0, 4, 0, 3, 0, 3, 5, 0, 5, 5,
+	4, 5, 0, 5, 5, 3, 0, 4, 5, 4, 4, 2, 8, 3, 3, 3,
+	4, 4, 4, 8, 2, 3, 0, 3, 0, 3, 4, 4, 4, 2, 5, 3,
+	0, 3, 0, 3, 4, 4, 4, 4, 7, 2, 3, 3, 3, 3, 0, 4,
+	4, 4, 2, 3, 0, 3, 0, 3, 5, 0, 5, 5, 5, 4, 0, 5,
+	5, 3, 0, 4, 0, 8, 8, 0, 5, 3, 4, 0, 8, 3, 4, 4,
+	4, 8, 2, 3, 3, 8, 3, 5, 0, 5, 5, 5, 0, 5, 5, 0,
+	4, 5, 4, 0, 4, 2, 8, 3, 3, 3, 4, 5, 4, 5, 4, 5,
+	2, 3, 3, 3, 5, 0, 5, 5, 0, 5, 5, 0, 5, 0, 4, 4,
+	4, 2, 3, 3, 8, 3, 4, 4, 8, 0, 3, 0, 8, 3, 4, 8,
+	4, 4, 8, 0, 3, 0, 3, 3, 4, 0, 4, 0, 5, 0, 3, 0,
+	3, 4, 4, 4, 8, 8, 2, 3, 3, 8, 3, 4, 4, 4, 5, 2,
+	3, 0, 3, 0, 3, 5, 0, 5, 5, 4, 5, 5, 3, 5, 0, 4,
+	4, 4, 2, 8, 3, 3, 8, 3, 5, 0, 5, 5, 4, 0, 5, 5,
+	3, 5, 0, 4, 4, 0, 4, 2, 3, 0, 3, 3, 4, 4, 7, 4,
+	4, 0, 10, 3, 3, 3, 3, 4, 5, 5, 4, 5, 0, 5, 3, 3,
+	4, 4, 0, 3, 0, 8, 0, 3, 4, 4, 2, 4, 10, 0, 3, 8,
+	3, 3, 4, 5, 5, 4, 0, 5, 5, 3, 3, 4, 4, 0, 4, 2,
+	3, 0, 3, 0, 3, 4, 4, 7, 4, 4, 2, 10, 3, 3, 3, 3,
+	4, 5, 5, 4, 5, 0, 5, 3, 0, 3, 4, 4, 0, 3, 0, 8,
+	3, 4, 4, 2, 4, 10, 0, 3, 3, 8, 3, 4, 5, 5, 4, 0,
+	5, 5, 3, 0, 3, 8, 4, 8, 0, 8, 3, 5, 0, 8, 0, 8,
+	8, 0, 5, 0, 8, 8, 4, 8, 0, 5, 0, 3, 0, 4, 8, 8,
+	8, 0, 5, 0, 3, 8, 0, 8, 0, 4, 8, 8, 0, 3, 4, 4,
+	8, 0, 3, 8, 8, 3, 4, 5, 5, 4, 0, 5, 3, 5, 3, 4,
+	4, 8, 0, 3, 8, 8, 0, 3, 4, 5, 5, 4, 0, 5, 3, 5,
+	0, 3, 4, 5, 5, 0, 5, 5, 3, 4, 5, 5, 0, 5, 5, 0,
+	3, 4, 4, 8, 0, 8, 3, 8, 8, 3, 4, 4, 5, 4, 2, 5,
+	3, 0, 3, 3, 4, 5, 0, 4, 0, 5, 5, 0, 5, 3, 3, 4,
+	4, 0, 4, 2, 3, 8, 3, 3, 4, 4, 5, 4, 7, 3, 2, 3,
+	3, 4, 4, 5, 4, 5, 2, 3, 0, 3, 3, 4, 4, 8, 0, 8,
+	3, 8, 8, 0, 3, 4, 5, 5, 4, 4, 5, 2, 3, 3, 3, 4,
+	0, 8, 8, 4, 0, 5, 5, 0, 3, 3, 4, 4, 0, 4, 2, 3,
+	3, 8, 3, 4, 4, 0, 8, 0, 3, 0, 8, 3, 4, 4, 5, 4,
+	5, 2, 3, 0, 3, 0, 3, 4, 5, 0, 5, 5, 4, 0, 5, 3,
+	3, 4, 5, 0, 5, 5, 0, 5, 3, 4, 5, 0, 5, 5, 4, 0,
+	5, 3, 0, 3, 4, 5, 0, 5, 5, 0, 5, 0, 3, 4, 4, 0,
+	3, 8, 8, 3, 4, 4, 0, 3, 8, 8, 0, 3, 4, 8, 0, 8,
+	8, 3, 4, 8, 4, 8, 0, 3, 8, 3, 4, 8, 0, 8, 8, 0,
+	3, 4, 8, 4, 8, 0, 8, 3, 3, 4, 5, 4, 0, 5, 3, 5,
+	5, 3, 4, 5, 4, 0, 5, 3, 5, 5, 0, 3, 4, 0, 5, 0,
+	4, 0, 3, 3, 4, 4, 8, 8, 0, 3, 8, 8, 3, 4, 4, 5,
+	4, 2, 3, 0, 3, 3, 4, 8, 4, 0, 5, 0, 3, 0, 3, 4,
+	4, 0, 4, 2, 8, 3, 8, 3, 3, 4, 5, 4, 4, 2, 8, 8,
+	3, 5, 3, 3, 4, 0, 5, 0, 4, 0, 3, 0, 3, 4, 4, 8,
+	8, 0, 3, 8, 8, 0, 3, 4, 4, 5, 4, 2, 3, 0, 3, 0,
+	3, 4, 8, 4, 0, 5, 0, 3, 3, 4, 4, 0, 4, 2, 8, 3,
+	3, 8, 3, 4, 8, 4, 4, 5, 4, 2, 3, 3, 3, 3, 4, 4,
+	0, 8, 0, 3, 8, 8, 3, 4, 5, 4, 5, 0, 5, 3, 5, 3,
+	4, 4, 0, 8, 0, 3, 8, 8, 0, 3, 4, 5, 4, 5, 0, 5,
+	3, 5, 0, 3, 4, 0, 8, 0, 8, 0, 5, 3, 4, 0, 8, 0,
+	8, 0, 5, 0, 3, 4, 4, 0, 8, 3, 8, 8, 3, 4, 4, 0,
+	8, 8, 0, 3, 0, 8, 3, 4, 4, 0, 8, 3, 8, 8, 0, 3,
+	4, 8, 4, 4, 0, 8, 3, 8, 3, 3, 4, 5, 4, 0, 5, 5,
+	3, 5, 3, 4, 5, 4, 0, 5, 5, 3, 5, 0, 3, 0, 8, 0,
+	8, 0, 5, 5, 5, 0, 8, 8, 4, 0, 5, 5, 3, 5, 4, 5,
+	4, 4, 0, 8, 0, 3, 3, 3, 4, 0, 4, 0, 8, 0, 3, 3,
+	4, 4, 4, 2, 8, 3, 8, 8, 3, 3, 4, 5, 4, 4, 0, 8,
+	8, 3, 3, 3, 4, 0, 4, 0, 4, 0, 3, 0, 3, 3, 4, 5,
+	4, 4, 4, 5, 2, 3, 3, 3, 3, 4, 0, 4, 0, 8, 8, 0,
+	5, 3, 3, 4, 0, 4, 0, 8, 3, 3, 4, 4, 4, 8, 2, 3,
+	0, 8, 3, 3, 4, 5, 4, 4, 0, 8, 3, 8, 3, 3, 4, 8,
+	4, 5, 0, 5, 3, 5, 3, 4, 5, 4, 5, 0, 5, 3, 3, 4,
+	5, 4, 5, 4, 0, 5, 3, 0, 3, 3, 4, 5, 4, 5, 0, 5,
+	0, 3, 3, 4, 0, 8, 0, 8, 0, 3, 4, 0, 4, 8, 8, 0,
+	3, 3, 4, 8, 0, 5, 5, 0, 5, 3, 4, 5, 4, 4, 0, 5,
+	3, 5, 3, 3, 4, 0, 4, 8, 0, 8, 8, 0, 3, 3, 4, 5,
+	4, 4, 0, 5, 3, 5, 0, 3, 3, 4, 5, 4, 0, 5, 5, 3,
+	3, 4, 5, 4, 0, 5, 5, 0, 3, 3, 4, 0, 4, 0, 4, 2,
+	3, 3, 3, 4, 4, 8, 8, 0, 3, 8, 8, 8, 0, 3, 4, 5,
+	4, 4, 2, 8, 0, 3, 3, 3, 4, 0, 4, 0, 8, 0, 3, 0,
+	3, 4, 4, 4, 2, 8, 3, 8, 3, 8, 3, 4, 5, 4, 4, 2,
+	8, 8, 3, 3, 3, 4, 5, 4, 2, 4, 10, 0, 3, 3, 3, 4,
+	4, 4, 7, 4, 2, 3, 10, 3, 3, 3, 5, 4, 5, 5, 3, 5,
+	5, 0, 5, 0, 4, 0, 4, 0, 3, 8, 3, 4, 4, 4, 8, 2,
+	3, 0, 3, 8, 3, 5, 4, 5, 5, 3, 5, 0, 5, 5, 0, 4,
+	8, 4, 5, 0, 5, 3, 5, 0, 3, 4, 5, 4, 5, 0, 5, 3,
+	0, 3, 5, 4, 5, 0, 5, 3, 5, 5, 0, 5, 0, 4, 4, 4,
+	2, 3, 0, 3, 8, 3, 4, 0, 8, 0, 8, 3, 4, 8, 4, 0,
+	8, 0, 3, 3, 4, 8, 0, 5, 5, 0, 5, 0, 3, 4, 5, 4,
+	4, 0, 5, 3, 5, 3, 0, 3, 4, 0, 4, 8, 0, 8, 8, 0,
+	3, 0, 3, 5, 4, 5, 4, 7, 3, 5, 5, 3, 5, 0, 4, 5,
+	4, 0, 5, 5, 3, 0, 3, 4, 5, 4, 0, 5, 5, 0, 3, 0,
+	3, 4, 0, 4, 0, 4, 2, 3, 0, 3, 3, 4, 4, 4, 4, 7,
+	2, 3, 3, 10, 3, 3, 4, 0, 5, 5, 4, 5, 0, 5, 3, 3,
+	4, 0, 4, 0, 3, 0, 8, 0, 3, 4, 4, 4, 2, 8, 3, 3,
+	8, 8, 3, 4, 5, 4, 4, 2, 8, 3, 8, 3, 3, 4, 0, 4,
+	0, 4, 2, 3, 0, 3, 0, 3, 5, 5, 4, 4, 4, 2, 10, 3,
+	3, 3, 8, 5, 4, 0, 5, 5, 3, 5, 5, 0, 5, 0, 4, 0,
+	4, 0, 3, 0, 8, 3, 4, 4, 4, 2, 8, 3, 3, 8, 8, 0,
+	3, 4, 5, 4, 4, 2, 8, 3, 3, 8, 3, 4, 0, 8, 8, 0,
+	8, 0, 5, 3, 4, 0, 8, 8, 8, 0, 5, 3, 4, 0, 8, 8,
+	0, 8, 0, 5, 0, 3, 4, 0, 8, 8, 8, 0, 5, 0, 3, 4,
+	0, 8, 8, 3, 4, 0, 8, 8, 0, 3, 4, 4, 8, 0, 3, 0,
+	8, 8, 3, 4, 0, 5, 5, 4, 0, 5, 3, 5, 3, 4, 4, 8,
+	0, 3, 0, 8, 8, 0, 3, 4, 0, 5, 5, 4, 0, 5, 3, 5,
+	0, 3, 4, 0, 5, 5, 0, 5, 5, 3, 4, 0, 5, 5, 0, 5,
+	5, 0, 3, 4, 8, 4, 5, 5, 3, 5, 3, 4, 5, 5, 4, 0,
+	5, 3, 3, 4, 4, 8, 0, 3, 8, 8, 0, 8, 3, 4, 5, 5,
+	4, 0, 5, 0, 3, 3, 4, 5, 5, 0, 5, 3, 4, 5, 5, 4,
+	5, 0, 3, 3, 4, 8, 4, 5, 5, 3, 5, 0, 3, 4, 5, 5,
+	4, 0, 5, 3, 0, 3, 4, 4, 8, 0, 3, 8, 8, 0, 8, 0,
+	3, 4, 5, 5, 4, 0, 5, 0, 3, 0, 3, 4, 5, 5, 0, 5,
+	0, 3, 4, 5, 5, 4, 5, 0, 3, 0, 3, 4, 5, 5, 4, 4,
+	2, 5, 3, 0, 3, 3, 4, 5, 5, 0, 4, 0, 5, 0, 3, 3,
+	4, 5, 5, 4, 4, 2, 5, 3, 0, 3, 0, 3, 4, 5, 5, 0,
+	4, 0, 5, 0, 3, 0, 3, 4, 4, 0, 3, 0, 8, 8, 3, 4,
+	4, 0, 3, 0, 8, 8, 0, 3, 4, 8, 8, 8, 3, 4, 8, 8,
+	0, 8, 3, 4, 8, 8, 8, 0, 3, 4, 8, 8, 0, 8, 0, 3,
+	4, 8, 8, 4, 8, 0, 3, 3, 4, 8, 4, 8, 8, 0, 3, 3,
+	4, 8, 0, 8, 8, 8, 3, 4, 8, 4, 8, 0, 3, 8, 8, 3,
+	4, 8, 0, 8, 8, 0, 8, 3, 4, 8, 4, 8, 0, 8, 3, 8,
+	3, 4, 5, 4, 0, 5, 3, 5, 3, 4, 5, 0, 4, 0, 5, 5,
+	0, 3, 3, 4, 8, 0, 8, 8, 8, 0, 3, 4, 8, 4, 8, 0,
+	3, 8, 8, 0, 3, 4, 8, 0, 8, 8, 0, 8, 0, 3, 4, 8,
+	4, 8, 0, 8, 8, 3, 3, 4, 5, 4, 0, 5, 3, 5, 0, 3,
+	4, 5, 0, 4, 0, 5, 5, 0, 3, 0, 3, 4, 8, 0, 8, 8,
+	4, 8, 0, 3, 3, 4, 8, 4, 8, 0, 8, 8, 0, 3, 0, 3,
+	4, 8, 8, 4, 0, 8, 8, 0, 3, 3, 4, 8, 4, 8, 0, 8,
+	8, 0, 3, 3, 4, 0, 4, 0, 8, 8, 3, 5, 3, 4, 0, 4,
+	0, 8, 8, 3, 5, 0, 3, 4, 5, 0, 5, 5, 3, 4, 5, 0,
+	5, 5, 4, 0, 3, 3, 4, 5, 0, 5, 5, 0, 3, 4, 8, 4,
+	5, 0, 5, 5, 3, 3, 4, 5, 0, 5, 5, 0, 4, 0, 3, 3,
+	4, 8, 4, 5, 0, 5, 5, 0, 3, 3, 0, 8, 0, 5, 5, 8,
+	8, 4, 5, 0, 5, 3, 5, 4, 8, 0, 8, 8, 0, 8, 8, 3,
+	4, 5, 4, 4, 0, 5, 0, 3, 3, 3, 4, 5, 4, 0, 5, 3,
+	3, 4, 5, 4, 4, 5, 0, 3, 3, 3, 4, 8, 0, 5, 5, 4,
+	0, 3, 3, 4, 5, 4, 4, 0, 5, 3, 0, 3, 3, 4, 8, 8,
+	4, 0, 5, 5, 3, 0, 3, 4, 8, 0, 8, 0, 5, 5, 0, 3,
+	4, 5, 4, 0, 5, 0, 3, 3, 4, 5, 4, 4, 5, 0, 3, 0,
+	3, 3, 4, 4, 0, 8, 0, 5, 3, 5, 5, 3, 4, 0, 4, 0,
+	5, 5, 0, 5, 3, 3, 4, 8, 8, 4, 0, 8, 8, 0, 3, 8,
+	3, 4, 4, 5, 0, 5, 5, 3, 5, 5, 0, 3, 4, 0, 4, 0,
+	8, 8, 3, 3, 4, 0, 4, 0, 8, 8, 0, 3, 3, 4, 5, 0,
+	5, 3, 4, 5, 4, 5, 4, 0, 3, 3, 3, 4, 5, 4, 5, 0,
+	3, 3, 4, 8, 4, 5, 0, 5, 3, 0, 3, 4, 5, 4, 5, 0,
+	4, 0, 3, 3, 3, 4, 8, 4, 5, 4, 5, 2, 3, 3, 3, 4,
+	8, 0, 5, 5, 0, 3, 4, 5, 4, 4, 2, 5, 3, 3, 3, 4,
+	8, 0, 8, 8, 0, 8, 8, 0, 3, 4, 5, 4, 4, 2, 5, 0,
+	3, 3, 3, 4, 5, 4, 0, 5, 3, 0, 3, 4, 5, 4, 4, 5,
+	2, 3, 3, 3, 4, 8, 0, 5, 5, 4, 0, 3, 0, 3, 4, 5,
+	4, 0, 4, 2, 5, 3, 3, 3, 0, 8, 8, 4, 0, 5, 5, 3,
+	0, 0, 8, 0, 8, 0, 5, 5, 0, 4, 5, 4, 0, 5, 0, 3,
+	0, 3, 5, 4, 5, 5, 0, 5, 3, 5, 5, 0, 4, 4, 0, 8,
+	0, 5, 3, 5, 5, 0, 3, 4, 0, 4, 0, 5, 5, 0, 5, 3,
+	0, 3, 5, 4, 5, 0, 5, 5, 3, 5, 0, 5, 0, 5, 4, 5,
+	0, 5, 5, 3, 5, 5, 0, 4, 0, 4, 0, 8, 3, 8, 3, 4,
+	0, 4, 0, 8, 8, 0, 3, 0, 3, 4, 5, 0, 5, 0, 3, 4,
+	5, 4, 5, 4, 2, 3, 3, 3, 4, 5, 4, 5, 0, 3, 0, 3,
+	4, 8, 4, 5, 0, 5, 3, 3, 4, 5, 4, 5, 0, 4, 2, 3,
+	3, 3, 4, 8, 4, 5, 4, 5, 0, 3, 3, 3, 4, 8, 0, 5,
+	5, 0, 4, 0, 3, 3, 4, 5, 4, 4, 2, 5, 3, 0, 3, 3,
+	4, 8, 8, 4, 0, 5, 5, 0, 3, 0, 3, 4, 4, 0, 8, 8,
+	3, 5, 5, 0, 3, 4, 5, 0, 4, 0, 5, 0, 3, 3, 4, 5,
+	4, 4, 5, 2, 3, 0, 3, 3, 4, 8, 0, 5, 5, 0, 4, 0,
+	3, 0, 3, 4, 5, 4, 4, 2, 5, 3, 0, 3, 0, 3, 4, 8,
+	8, 4, 0, 5, 5, 0, 3, 3, 4, 4, 0, 8, 8, 3, 5, 5,
+	3, 4, 5, 0, 4, 0, 5, 0, 3, 0, 3, 5, 4, 0, 5, 5,
+	0, 5, 3, 5, 5, 0, 4, 4, 5, 5, 3, 5, 4, 0, 5, 3,
+	3, 4, 4, 5, 5, 3, 5, 0, 5, 3, 4, 4, 5, 5, 3, 5,
+	4, 0, 5, 3, 0, 3, 4, 4, 5, 5, 3, 5, 0, 5, 0, 3,
+	4, 0, 4, 0, 3, 8, 8, 3, 4, 0, 4, 0, 3, 8, 8, 0,
+	3, 4, 0, 8, 0, 8, 8, 3, 4, 8, 4, 0, 8, 0, 3, 8,
+	3, 4, 0, 8, 0, 8, 8, 0, 3, 4, 8, 4, 5, 0, 5, 0,
+	3, 3, 4, 4, 5, 0, 5, 3, 5, 5, 3, 4, 4, 5, 0, 5,
+	3, 5, 5, 0, 3, 4, 8, 4, 0, 5, 5, 3, 5, 3, 4, 0,
+	5, 5, 4, 0, 5, 3, 3, 4, 4, 8, 0, 3, 0, 8, 8, 0,
+	8, 3, 4, 0, 5, 5, 4, 0, 5, 0, 3, 3, 4, 0, 5, 5,
+	0, 5, 3, 4, 0, 5, 5, 4, 5, 0, 3, 3, 4, 8, 4, 0,
+	5, 5, 3, 5, 0, 3, 4, 0, 5, 5, 4, 0, 5, 3, 0, 3,
+	5, 4, 4, 5, 5, 3, 5, 3, 5, 0, 5, 0, 5, 4, 4, 5,
+	5, 3, 5, 3, 5, 5, 0, 4, 0, 5, 5, 0, 5, 0, 3, 4,
+	0, 5, 5, 4, 5, 0, 3, 0, 3, 4, 0, 5, 5, 4, 4, 2,
+	5, 3, 0, 3, 3, 4, 4, 0, 5, 5, 3, 5, 0, 5, 3, 4,
+	5, 5, 4, 4, 4, 7, 2, 3, 3, 3, 3, 0, 4, 4, 0, 5,
+	5, 3, 5, 0, 5, 0, 3, 4, 0, 4, 0, 3, 0, 8, 8, 3,
+	4, 0, 4, 0, 3, 0, 8, 8, 0, 3, 4, 0, 8, 8, 8, 3,
+	4, 0, 8, 8, 0, 8, 3, 4, 0, 8, 8, 8, 0, 3, 4, 0,
+	8, 8, 0, 8, 0, 3, 4, 0, 8, 8, 4, 8, 0, 3, 3, 4,
+	8, 4, 0, 8, 8, 0, 3, 3, 4, 5, 5, 3, 4, 8, 8, 0,
+	8, 8, 3, 4, 5, 5, 4, 0, 3, 3, 4, 8, 4, 5, 5, 3,
+	0, 3, 4, 8, 8, 4, 8, 0, 3, 8, 3, 4, 8, 4, 8, 8,
+	0, 3, 8, 3, 4, 5, 5, 0, 3, 4, 8, 8, 0, 8, 8, 0,
+	3, 4, 5, 5, 4, 0, 3, 0, 3, 4, 8, 4, 5, 5, 3, 3,
+	4, 8, 8, 4, 8, 0, 8, 3, 3, 4, 8, 4, 8, 8, 0, 8,
+	3, 3, 4, 5, 5, 0, 4, 0, 3, 3, 4, 8, 4, 5, 5, 0,
+	3, 0, 3, 4, 5, 5, 0, 4, 0, 3, 0, 3, 4, 8, 4, 5,
+	5, 0, 3, 3, 4, 8, 8, 4, 8, 0, 8, 0, 3, 3, 4, 8,
+	4, 8, 8, 0, 8, 0, 3, 3, 4, 4, 0, 5, 3, 5, 5, 3,
+	4, 4, 0, 3, 0, 8, 8, 0, 8, 3, 4, 4, 0, 5, 3, 5,
+	5, 0, 3, 4, 4, 0, 3, 0, 8, 8, 0, 8, 0, 3, 4, 8,
+	8, 4, 4, 8, 8, 0, 3, 3, 3, 4, 8, 4, 8, 4, 8, 8,
+	0, 3, 3, 3, 0, 5, 8, 8, 0, 5, 5, 0, 5, 4, 5, 4,
+	4, 0, 3, 3, 3, 4, 8, 0, 5, 0, 4, 0, 3, 3, 4, 4,
+	4, 2, 5, 3, 5, 3, 3, 4, 8, 4, 8, 8, 0, 3, 8, 8,
+	3, 4, 5, 4, 0, 3, 3, 4, 8, 8, 0, 8, 8, 0, 8, 3,
+	4, 8, 8, 4, 5, 5, 3, 0, 3, 4, 8, 0, 5, 0, 3, 4,
+	4, 4, 2, 5, 3, 5, 0, 3, 3, 4, 8, 4, 8, 8, 0, 8,
+	3, 8, 3, 4, 5, 4, 0, 4, 0, 3, 3, 3, 4, 8, 4, 5,
+	4, 2, 3, 0, 3, 3, 4, 5, 4, 0, 4, 0, 3, 0, 3, 3,
+	4, 8, 4, 5, 4, 2, 3, 3, 3, 4, 4, 8, 0, 8, 3, 5,
+	0, 3, 4, 8, 4, 8, 0, 5, 0, 3, 0, 3, 4, 4, 0, 5,
+	3, 5, 3, 4, 0, 4, 0, 8, 8, 0, 8, 3, 3, 4, 0, 4,
+	0, 5, 5, 0, 3, 3, 4, 4, 0, 8, 0, 5, 3, 5, 0, 3,
+	4, 4, 4, 2, 8, 8, 3, 5, 3, 3, 4, 4, 4, 2, 8, 8,
+	3, 5, 0, 3, 3, 4, 5, 0, 3, 4, 8, 8, 0, 8, 8, 8,
+	0, 3, 4, 5, 4, 4, 2, 3, 3, 3, 4, 8, 0, 5, 0, 4,
+	0, 3, 0, 3, 4, 4, 4, 2, 5, 3, 5, 3, 0, 3, 4, 8,
+	4, 8, 8, 0, 3, 8, 8, 0, 3, 4, 5, 4, 0, 3, 0, 3,
+	4, 8, 8, 0, 8, 8, 0, 8, 0, 3, 8, 8, 4, 5, 0, 5,
+	3, 0, 0, 8, 0, 5, 0, 4, 8, 8, 4, 8, 0, 8, 8, 3,
+	3, 0, 8, 8, 8, 0, 5, 5, 0, 5, 0, 4, 5, 4, 0, 4,
+	2, 3, 3, 3, 4, 8, 4, 5, 4, 2, 3, 0, 3, 0, 3, 4,
+	8, 8, 4, 8, 8, 0, 8, 3, 3, 4, 8, 4, 5, 4, 0, 3,
+	3, 3, 4, 4, 8, 0, 8, 3, 5, 3, 4, 8, 4, 8, 0, 5,
+	0, 3, 3, 4, 4, 0, 5, 3, 5, 0, 3, 4, 0, 4, 0, 8,
+	8, 0, 3, 8, 3, 4, 0, 4, 0, 5, 5, 0, 3, 0, 3, 4,
+	4, 0, 8, 0, 5, 3, 5, 3, 4, 4, 4, 0, 8, 3, 8, 3,
+	5, 3, 5, 4, 5, 4, 0, 5, 5, 3, 5, 3, 5, 0, 4, 5,
+	0, 4, 0, 3, 3, 4, 5, 5, 4, 4, 0, 8, 3, 3, 3, 4,
+	5, 4, 4, 2, 3, 0, 3, 3, 4, 8, 4, 5, 0, 3, 0, 3,
+	4, 4, 0, 4, 2, 5, 3, 5, 0, 3, 3, 4, 8, 4, 5, 5,
+	4, 2, 8, 3, 3, 3, 4, 5, 0, 4, 0, 3, 0, 3, 4, 5,
+	5, 4, 4, 2, 8, 3, 3, 3, 4, 8, 8, 4, 5, 5, 0, 3,
+	3, 4, 8, 4, 5, 0, 3, 3, 4, 8, 8, 4, 8, 0, 8, 8,
+	0, 3, 3, 5, 4, 0, 5, 5, 0, 5, 5, 3, 5, 0, 4, 5,
+	4, 0, 4, 2, 3, 0, 3, 3, 4, 4, 5, 5, 0, 5, 3, 5,
+	3, 4, 5, 4, 0, 4, 2, 3, 0, 3, 0, 3, 4, 4, 5, 5,
+	0, 5, 3, 5, 0, 3, 4, 8, 0, 8, 0, 5, 3, 4, 8, 0,
+	8, 0, 5, 0, 3, 4, 0, 4, 0, 8, 3, 8, 8, 3, 4, 0,
+	4, 0, 8, 8, 0, 3, 0, 8, 3, 4, 0, 4, 0, 8, 3, 8,
+	8, 0, 3, 4, 8, 4, 4, 0, 5, 3, 5, 0, 3, 3, 4, 4,
+	5, 0, 5, 5, 3, 5, 3, 4, 4, 5, 0, 5, 5, 3, 5, 0,
+	3, 4, 0, 8, 0, 8, 8, 8, 3, 4, 4, 5, 4, 2, 5, 3,
+	5, 3, 3, 4, 0, 8, 0, 8, 8, 0, 8, 3, 4, 8, 4, 5,
+	0, 4, 2, 3, 3, 3, 4, 4, 5, 0, 5, 3, 5, 3, 4, 4,
+	5, 4, 7, 3, 7, 0, 3, 3, 4, 0, 8, 0, 8, 8, 8, 0,
+	3, 4, 4, 5, 4, 2, 5, 3, 5, 3, 0, 3, 4, 0, 8, 0,
+	8, 8, 0, 8, 0, 3, 4, 8, 4, 5, 0, 4, 0, 3, 3, 3,
+	4, 4, 5, 0, 5, 3, 5, 0, 3, 4, 4, 5, 4, 7, 3, 7,
+	0, 3, 0, 3, 4, 5, 0, 4, 0, 4, 2, 3, 0, 3, 3, 4,
+	4, 0, 5, 5, 0, 5, 3, 5, 3, 4, 0, 8, 8, 4, 0, 8,
+	8, 0, 3, 3, 4, 4, 0, 5, 5, 0, 5, 3, 5, 0, 3, 4,
+	4, 0, 8, 8, 3, 5, 3, 4, 4, 0, 8, 8, 3, 5, 0, 3,
+	4, 4, 5, 5, 3, 5, 3, 4, 4, 8, 8, 0, 8, 3, 5, 3,
+	4, 4, 5, 5, 3, 5, 0, 3, 4, 4, 8, 8, 0, 8, 3, 5,
+	0, 3, 4, 4, 5, 5, 3, 5, 0, 4, 0, 3, 3, 4, 8, 4,
+	8, 0, 8, 0, 5, 0, 3, 3, 4, 0, 5, 5, 3, 4, 0, 8,
+	8, 0, 8, 8, 3, 4, 0, 5, 5, 4, 0, 3, 3, 4, 8, 4,
+	0, 5, 5, 3, 0, 3, 4, 0, 8, 8, 4, 8, 0, 3, 8, 3,
+	4, 8, 4, 0, 8, 8, 0, 3, 8, 3, 4, 0, 5, 5, 0, 3,
+	4, 0, 8, 8, 0, 8, 8, 0, 3, 4, 0, 5, 5, 4, 0, 3,
+	0, 3, 4, 8, 4, 0, 5, 5, 3, 3, 4, 0, 8, 8, 4, 8,
+	0, 8, 3, 3, 4, 8, 4, 0, 8, 8, 0, 8, 3, 3, 4, 0,
+	5, 5, 0, 4, 0, 3, 3, 4, 8, 4, 0, 5, 5, 0, 3, 0,
+	3, 4, 0, 5, 5, 0, 4, 0, 3, 0, 3, 4, 8, 4, 0, 5,
+	5, 0, 3, 3, 4, 4, 8, 0, 8, 0, 5, 3, 5, 3, 4, 4,
+	8, 0, 8, 0, 5, 3, 5, 0, 3, 4, 4, 0, 5, 5, 3, 5,
+	3, 4, 4, 0, 8, 8, 0, 8, 3, 5, 3, 4, 4, 0, 5, 5,
+	3, 5, 0, 3, 4, 4, 0, 8, 8, 0, 8, 3, 5, 0, 3, 4,
+	4, 4, 0, 8, 8, 3, 5, 3, 5, 3, 4, 4, 4, 0, 8, 8,
+	3, 5, 3, 5, 0, 3, 0, 8, 8, 0, 5, 5, 0, 8, 8, 8,
+	0, 5, 5, 5, 0, 4, 4, 4, 10, 2, 3, 3, 3, 4, 4, 4,
+	2, 7, 3, 3, 3, 8, 8, 8, 4, 0, 5, 5, 3, 5, 0, 4,
+	4, 7, 0, 8, 3, 3, 8, 8, 0, 8, 8, 0, 8, 8, 8, 0,
+	4, 4, 10, 8, 0, 5, 0, 3, 3, 4, 4, 10, 0, 3, 3, 4,
+	4, 4, 2, 7, 0, 3, 3, 3, 4, 4, 7, 5, 0, 5, 5, 0,
+	3, 3, 4, 4, 2, 8, 0, 5, 5, 3, 3, 4, 4, 4, 0, 10,
+	2, 3, 3, 3, 8, 8, 4, 8, 8, 0, 3, 8, 8, 8, 0, 4,
+	4, 4, 0, 8, 3, 3, 3, 0, 4, 4, 10, 0, 8, 0, 3, 3,
+	4, 4, 4, 10, 8, 2, 3, 3, 3, 4, 4, 2, 5, 3, 3, 4,
+	4, 4, 10, 2, 5, 0, 3, 3, 3, 4, 4, 4, 5, 0, 3, 3,
+	3, 0, 4, 4, 2, 8, 0, 5, 0, 3, 3, 4, 4, 4, 2, 10,
+	10, 3, 3, 3, 4, 4, 4, 2, 10, 10, 0, 3, 3, 3, 4, 4,
+	2, 3, 3, 8, 8, 0, 8, 8, 8, 0, 8, 8, 0, 4, 4, 7,
+	4, 0, 8, 3, 3, 3, 4, 4, 4, 10, 2, 3, 0, 3, 3, 4,
+	4, 4, 2, 7, 3, 0, 3, 3, 4, 4, 4, 4, 5, 2, 3, 3,
+	3, 3, 0, 4, 4, 7, 0, 8, 0, 3, 3, 8, 8, 0, 8, 8,
+	0, 8, 0, 8, 8, 0, 4, 8, 8, 0, 5, 0, 3, 0, 4, 8,
+	0, 3, 0, 4, 4, 4, 10, 2, 3, 8, 3, 3, 5, 4, 5, 5,
+	0, 5, 5, 0, 3, 4, 4, 2, 8, 0, 5, 5, 0, 3, 3, 4,
+	4, 4, 0, 10, 2, 3, 0, 3, 3, 5, 4, 5, 0, 5, 5, 0,
+	5, 0, 3, 4, 4, 7, 0, 8, 8, 3, 3, 4, 4, 10, 0, 8,
+	3, 3, 4, 4, 10, 4, 8, 0, 3, 3, 3, 4, 4, 2, 5, 0,
+	3, 3, 4, 4, 4, 10, 8, 2, 3, 8, 3, 3, 4, 4, 4, 5,
+	0, 3, 2, 3, 3, 4, 4, 2, 8, 0, 5, 3, 3, 4, 4, 4,
+	0, 8, 3, 10, 3, 3, 5, 4, 5, 4, 0, 5, 5, 3, 5, 0,
+	3, 4, 4, 2, 4, 0, 3, 3, 3, 5, 5, 4, 5, 5, 3, 5,
+	0, 5, 5, 0, 4, 4, 2, 8, 8, 0, 5, 0, 3, 3, 4, 4,
+	2, 8, 0, 3, 3, 4, 4, 2, 4, 0, 5, 0, 3, 3, 3, 4,
+	4, 7, 4, 0, 8, 8, 3, 3, 3, 4, 4, 2, 4, 0, 3, 0,
+	3, 3, 4, 4, 7, 4, 4, 5, 2, 3, 3, 3, 3, 4, 4, 2,
+	8, 8, 0, 5, 3, 3, 4, 4, 2, 8, 3, 3, 4, 4, 4, 10,
+	2, 3, 0, 8, 3, 3, 5, 4, 0, 5, 5, 0, 5, 5, 0, 3,
+	4, 4, 7, 5, 4, 0, 5, 3, 3, 3, 4, 4, 7, 5, 0, 5,
+	3, 3, 4, 4, 7, 5, 4, 0, 5, 3, 0, 3, 3, 4, 4, 7,
+	5, 0, 5, 0, 3, 3, 4, 4, 10, 8, 3, 3, 4, 4, 10, 8,
+	0, 3, 3, 4, 4, 10, 0, 8, 8, 3, 3, 4, 4, 10, 4, 8,
+	0, 3, 8, 3, 3, 4, 4, 10, 0, 8, 8, 0, 3, 3, 4, 4,
+	10, 4, 0, 5, 0, 3, 3, 3, 4, 4, 7, 0, 5, 5, 3, 3,
+	4, 4, 7, 0, 5, 5, 0, 3, 3, 4, 0, 8, 0, 5, 5, 3,
+	0, 4, 4, 7, 4, 0, 5, 3, 3, 3, 4, 4, 10, 0, 8, 8,
+	0, 8, 3, 3, 4, 4, 2, 4, 0, 8, 3, 3, 3, 4, 4, 7,
+	0, 5, 3, 3, 4, 4, 7, 4, 5, 0, 3, 3, 3, 4, 4, 10,
+	0, 5, 5, 0, 3, 3, 4, 4, 7, 4, 0, 5, 3, 0, 3, 3,
+	5, 4, 4, 5, 5, 3, 5, 0, 5, 0, 3, 4, 4, 2, 4, 0,
+	3, 8, 3, 3, 4, 4, 7, 0, 5, 0, 3, 3, 4, 4, 7, 4,
+	5, 0, 3, 0, 3, 3, 4, 4, 2, 5, 5, 4, 0, 5, 3, 3,
+	3, 4, 4, 2, 5, 5, 0, 5, 3, 3, 5, 4, 4, 0, 5, 5,
+	3, 5, 0, 5, 0, 3, 4, 4, 2, 5, 5, 0, 5, 0, 3, 3,
+	4, 4, 2, 8, 8, 3, 3, 4, 4, 2, 8, 8, 0, 3, 3, 4,
+	4, 7, 5, 3, 3, 4, 4, 10, 8, 0, 8, 3, 3, 4, 4, 7,
+	5, 0, 3, 3, 4, 4, 10, 8, 0, 8, 0, 3, 3, 4, 4, 7,
+	5, 0, 4, 0, 3, 3, 3, 4, 4, 10, 4, 8, 8, 0, 3, 3,
+	3, 4, 0, 5, 3, 0, 4, 4, 10, 8, 0, 8, 8, 3, 3, 4,
+	4, 7, 4, 0, 3, 3, 3, 4, 4, 10, 0, 5, 0, 3, 3, 4,
+	4, 4, 2, 7, 3, 5, 3, 3, 4, 4, 2, 4, 0, 8, 8, 0,
+	3, 3, 3, 4, 4, 7, 0, 3, 3, 4, 4, 10, 8, 0, 8, 8,
+	0, 3, 3, 4, 4, 7, 4, 0, 3, 0, 3, 3, 4, 4, 10, 0,
+	5, 3, 3, 4, 4, 4, 2, 7, 3, 5, 0, 3, 3, 5, 4, 4,
+	5, 0, 5, 5, 3, 5, 0, 3, 4, 4, 7, 0, 4, 0, 3, 3,
+	3, 4, 4, 10, 4, 5, 0, 3, 0, 3, 3, 4, 4, 7, 0, 4,
+	0, 3, 0, 3, 3, 4, 4, 10, 4, 5, 0, 3, 3, 3, 4, 4,
+	10, 0, 8, 0, 5, 3, 3, 4, 4, 10, 0, 8, 0, 5, 0, 3,
+	3, 4, 4, 2, 5, 5, 3, 3, 4, 4, 2, 8, 8, 0, 8, 3,
+	3, 4, 4, 2, 5, 5, 0, 3, 3, 4, 4, 2, 8, 8, 0, 8,
+	0, 3, 3, 4, 4, 4, 2, 10, 10, 3, 5, 3, 3, 4, 4, 4,
+	2, 10, 10, 3, 5, 0, 3, 3, 4, 0, 3, 0, 8, 8, 0, 5,
+	5, 4, 0, 3, 0, 4, 4, 4, 7, 0, 8, 3, 3, 3, 4, 4,
+	4, 8, 2, 3, 3, 3, 0, 4, 4, 4, 0, 7, 3, 3, 3, 4,
+	4, 4, 7, 0, 8, 8, 0, 3, 3, 3, 4, 5, 4, 2, 8, 3,
+	3, 5, 5, 4, 0, 5, 5, 0, 5, 5, 3, 4, 0, 4, 10, 8,
+	0, 5, 0, 3, 3, 4, 0, 4, 10, 0, 3, 3, 4, 4, 4, 0,
+	7, 0, 3, 3, 3, 4, 5, 4, 7, 0, 5, 5, 0, 3, 3, 4,
+	4, 4, 0, 7, 0, 8, 3, 3, 3, 4, 4, 4, 2, 10, 2, 3,
+	3, 3, 4, 5, 4, 2, 5, 5, 0, 5, 0, 3, 3, 4, 4, 4,
+	2, 8, 3, 3, 3, 0, 4, 4, 4, 10, 10, 3, 3, 3, 4, 4,
+	4, 10, 10, 0, 3, 3, 3, 4, 4, 4, 7, 3, 3, 3, 4, 4,
+	4, 8, 0, 7, 0, 3, 3, 3, 4, 4, 4, 7, 0, 3, 3, 3,
+	4, 4, 4, 8, 0, 7, 3, 3, 3, 4, 4, 4, 0, 10, 10, 3,
+	3, 3, 4, 4, 4, 0, 10, 10, 0, 3, 3, 3, 4, 4, 0, 3,
+	0, 3, 0, 5, 5, 5, 4, 5, 0, 5, 5, 3, 4, 4, 7, 4,
+	2, 10, 3, 3, 3, 4, 4, 2, 4, 10, 0, 3, 3, 3, 0, 4,
+	4, 4, 4, 7, 3, 3, 3, 3, 4, 4, 4, 4, 7, 0, 3, 3,
+	3, 3, 8, 8, 8, 4, 5, 5, 3, 8, 8, 8, 4, 0, 5, 5,
+	3, 8, 8, 0, 5, 8, 8, 8, 0, 8, 0, 5, 5, 8, 8, 8,
+	0, 5, 5, 4, 4, 7, 0, 4, 2, 10, 3, 3, 3, 4, 4, 5,
+	5, 4, 7, 0, 3, 3, 3, 5, 5, 5, 0, 5, 5, 0, 5, 5,
+	5, 5, 0, 5, 5, 5, 4, 4, 8, 0, 3, 3, 8, 8, 4, 4,
+	4, 8, 0, 3, 3, 3, 4, 4, 0, 5, 0, 3, 0, 3, 0, 4,
+	4, 4, 8, 8, 0, 3, 3, 3, 8, 5, 5, 5, 4, 5, 0, 5,
+	3, 5, 5, 5, 5, 4, 5, 5, 3, 5, 4, 4, 4, 0, 8, 3,
+	3, 3, 8, 5, 5, 5, 4, 0, 5, 5, 3, 5, 4, 5, 0, 4,
+	2, 8, 3, 3, 4, 4, 4, 4, 0, 7, 3, 0, 3, 3, 3, 4,
+	5, 5, 4, 7, 0, 5, 0, 3, 3, 4, 4, 0, 8, 0, 3, 0,
+	3, 0, 4, 4, 4, 4, 7, 3, 0, 3, 3, 3, 4, 5, 5, 4,
+	2, 5, 5, 0, 3, 3, 5, 5, 0, 5, 5, 4, 5, 5, 3, 5,
+	5, 0, 5, 5, 4, 0, 5, 5, 3, 5, 5, 0, 5, 5, 5, 0,
+	5, 4, 4, 0, 3, 3, 8, 4, 4, 4, 8, 0, 3, 0, 3, 3,
+	8, 5, 5, 0, 5, 5, 0, 5, 5, 8, 4, 4, 8, 0, 3, 8,
+	3, 5, 4, 8, 0, 3, 8, 8, 0, 5, 4, 8, 8, 4, 10, 0,
+	5, 0, 3, 3, 4, 4, 4, 0, 3, 0, 3, 3, 8, 4, 8, 0,
+	3, 8, 8, 4, 4, 8, 0, 3, 3, 4, 4, 8, 0, 8, 3, 3,
+	8, 4, 4, 8, 4, 8, 0, 3, 3, 3, 8, 4, 4, 10, 8, 4,
+	2, 10, 3, 3, 3, 8, 4, 4, 4, 0, 5, 0, 3, 3, 3, 4,
+	4, 4, 0, 3, 8, 3, 3, 8, 4, 4, 5, 0, 5, 5, 0, 3,
+	0, 3, 0, 4, 0, 8, 0, 5, 5, 0, 3, 0, 4, 4, 5, 4,
+	0, 7, 3, 3, 3, 4, 4, 8, 0, 8, 8, 0, 3, 3, 8, 4,
+	4, 2, 4, 2, 10, 3, 3, 3, 4, 4, 5, 4, 7, 3, 3, 3,
+	4, 4, 5, 4, 7, 0, 3, 3, 3, 5, 5, 4, 5, 4, 7, 3,
+	5, 5, 3, 4, 4, 5, 4, 4, 7, 3, 3, 3, 3, 5, 5, 4,
+	5, 5, 3, 5, 0, 5, 5, 5, 4, 5, 5, 3, 5, 5, 4, 4,
+	0, 8, 0, 3, 3, 8, 5, 5, 4, 5, 0, 5, 3, 5, 5, 4,
+	5, 0, 5, 5, 4, 2, 5, 0, 3, 3, 4, 5, 0, 5, 5, 4,
+	7, 0, 3, 3, 5, 5, 4, 0, 5, 5, 3, 5, 0, 5, 5, 5,
+	4, 0, 5, 5, 3, 5, 5, 4, 4, 0, 8, 3, 3, 8, 8, 4,
+	4, 4, 0, 8, 3, 3, 3, 4, 8, 0, 8, 0, 3, 8, 4, 4,
+	8, 8, 0, 3, 3, 8, 4, 4, 5, 5, 0, 3, 0, 3, 0, 8,
+	4, 4, 8, 0, 8, 0, 3, 3, 4, 4, 5, 5, 0, 5, 0, 3,
+	3, 8, 8, 4, 4, 4, 8, 8, 0, 3, 3, 3, 4, 0, 5, 0,
+	3, 0, 4, 4, 8, 8, 0, 8, 3, 3, 8, 4, 4, 5, 5, 0,
+	3, 3, 8, 4, 4, 8, 0, 5, 0, 3, 0, 3, 0, 4, 4, 2,
+	4, 2, 10, 8, 3, 3, 3, 4, 4, 2, 4, 2, 10, 8, 0, 3,
+	3, 3, 4, 4, 5, 0, 3, 0, 3, 0, 4, 4, 7, 5, 4, 2,
+	10, 3, 3, 3, 8, 8, 4, 5, 4, 0, 5, 3, 3, 4, 0, 8,
+	0, 5, 3, 0, 4, 4, 0, 4, 0, 8, 3, 3, 3, 8, 5, 5,
+	4, 5, 0, 5, 5, 3, 5, 4, 4, 5, 0, 5, 0, 3, 3, 8,
+	4, 5, 4, 5, 4, 7, 3, 5, 0, 3, 3, 5, 5, 4, 0, 5,
+	5, 0, 5, 3, 5, 8, 4, 4, 4, 5, 0, 3, 3, 3, 4, 0,
+	4, 10, 0, 3, 8, 3, 5, 8, 4, 4, 0, 8, 0, 5, 0, 3,
+	3, 4, 4, 0, 8, 8, 3, 3, 8, 4, 4, 0, 8, 8, 0, 3,
+	3, 8, 4, 4, 0, 5, 5, 0, 3, 0, 3, 0, 8, 4, 4, 4,
+	0, 8, 8, 3, 3, 3, 4, 4, 4, 2, 8, 3, 8, 3, 5, 3,
+	0, 8, 4, 4, 4, 0, 8, 8, 0, 3, 3, 3, 4, 0, 4, 2,
+	3, 3, 4, 4, 8, 8, 0, 8, 3, 8, 3, 8, 4, 4, 4, 7,
+	0, 3, 8, 3, 3, 4, 4, 4, 8, 2, 3, 2, 3, 3, 4, 4,
+	4, 0, 7, 3, 0, 3, 3, 4, 5, 4, 4, 2, 10, 10, 0, 3,
+	3, 3, 4, 5, 4, 2, 8, 0, 3, 3, 5, 5, 4, 5, 4, 0,
+	5, 5, 3, 0, 3, 4, 0, 8, 8, 0, 5, 0, 3, 0, 4, 0,
+	8, 0, 3, 0, 4, 4, 4, 8, 2, 3, 10, 3, 3, 5, 5, 4,
+	5, 0, 5, 5, 0, 3, 4, 5, 4, 2, 4, 0, 8, 3, 3, 3,
+	4, 4, 4, 2, 10, 2, 3, 0, 3, 3, 5, 5, 4, 0, 5, 5,
+	0, 5, 0, 3, 4, 5, 4, 2, 8, 8, 3, 3, 4, 0, 4, 10,
+	0, 8, 3, 3, 4, 4, 4, 10, 10, 0, 3, 0, 3, 3, 4, 4,
+	4, 7, 3, 0, 3, 3, 4, 4, 4, 7, 4, 2, 3, 3, 3, 3,
+	4, 4, 4, 7, 0, 3, 0, 3, 3, 4, 0, 4, 2, 8, 0, 5,
+	3, 3, 4, 4, 4, 2, 8, 3, 10, 3, 3, 5, 5, 4, 4, 0,
+	5, 5, 3, 5, 0, 3, 4, 0, 4, 0, 3, 0, 3, 0, 5, 0,
+	5, 5, 4, 5, 0, 5, 5, 3, 4, 4, 5, 4, 2, 3, 10, 3,
+	3, 4, 4, 2, 4, 10, 0, 3, 2, 3, 3, 4, 4, 4, 4, 7,
+	3, 3, 0, 3, 3, 4, 4, 4, 4, 7, 2, 3, 3, 3, 3, 5,
+	5, 4, 0, 4, 10, 3, 8, 3, 5, 0, 5, 5, 5, 4, 0, 5,
+	5, 3, 4, 0, 3, 8, 8, 0, 5, 4, 0, 3, 8, 4, 4, 4,
+	8, 2, 3, 3, 3, 8, 5, 0, 5, 5, 5, 0, 5, 5, 4, 5,
+	4, 2, 4, 2, 10, 3, 3, 3, 4, 5, 4, 5, 4, 7, 0, 3,
+	3, 3, 5, 0, 5, 5, 0, 5, 5, 0, 5, 4, 4, 4, 2, 3,
+	3, 3, 8, 4, 4, 8, 0, 3, 0, 3, 8, 8, 4, 4, 4, 8,
+	0, 3, 0, 3, 3, 4, 0, 4, 0, 5, 0, 3, 0, 3, 0, 4,
+	4, 4, 8, 8, 2, 3, 3, 3, 8, 4, 4, 4, 2, 8, 0, 3,
+	3, 3, 8, 5, 0, 5, 5, 4, 5, 5, 3, 5, 4, 4, 4, 2,
+	8, 3, 3, 3, 8, 5, 0, 5, 5, 4, 0, 5, 5, 3, 5, 4,
+	5, 0, 4, 2, 8, 0, 3, 3, 5, 5, 5, 4, 4, 0, 5, 5,
+	3, 0, 3, 5, 5, 5, 4, 5, 0, 5, 0, 3, 5, 5, 5, 4,
+	5, 5, 0, 3, 4, 4, 2, 4, 10, 0, 3, 10, 3, 3, 5, 5,
+	5, 4, 0, 5, 5, 0, 3, 5, 5, 5, 4, 4, 7, 5, 3, 0,
+	3, 5, 5, 5, 4, 4, 2, 5, 5, 3, 0, 3, 5, 5, 5, 4,
+	5, 4, 7, 3, 0, 3, 4, 4, 0, 3, 0, 3, 8, 4, 4, 2,
+	4, 10, 0, 3, 3, 3, 8, 4, 4, 5, 4, 2, 8, 3, 3, 3,
+	8, 8, 4, 8, 0, 8, 3, 5, 8, 0, 8, 8, 0, 5, 8, 8,
+	4, 8, 0, 5, 0, 3, 8, 4, 8, 8, 0, 5, 0, 3, 8, 0,
+	8, 8, 4, 8, 0, 3, 4, 4, 8, 0, 3, 8, 3, 8, 8, 0,
+	8, 8, 0, 8, 0, 5, 5, 4, 4, 8, 0, 3, 8, 8, 0, 3,
+	0, 8, 4, 4, 4, 8, 0, 3, 8, 3, 3, 4, 5, 5, 0, 5,
+	5, 3, 0, 4, 5, 5, 0, 5, 5, 0, 3, 0, 4, 4, 8, 0,
+	8, 3, 8, 3, 8, 4, 4, 5, 4, 0, 7, 3, 0, 3, 3, 5,
+	5, 4, 4, 7, 3, 5, 0, 5, 0, 3, 4, 5, 0, 4, 2, 8,
+	8, 3, 3, 4, 4, 5, 4, 7, 3, 0, 3, 3, 4, 4, 5, 4,
+	7, 0, 3, 0, 3, 3, 4, 4, 8, 0, 8, 3, 8, 8, 0, 3,
+	0, 4, 5, 5, 4, 4, 7, 0, 3, 3, 3, 4, 0, 8, 8, 4,
+	2, 5, 5, 0, 3, 3, 4, 4, 0, 4, 2, 3, 3, 3, 8, 4,
+	4, 0, 8, 0, 3, 0, 3, 8, 8, 4, 4, 4, 0, 8, 0, 3,
+	0, 3, 3, 5, 5, 0, 5, 5, 4, 0, 5, 0, 3, 4, 5, 0,
+	5, 5, 0, 5, 3, 0, 5, 5, 0, 5, 5, 4, 4, 7, 3, 0,
+	3, 4, 5, 0, 5, 5, 0, 5, 0, 3, 0, 4, 4, 0, 3, 8,
+	3, 8, 4, 4, 0, 3, 8, 8, 0, 3, 0, 4, 8, 0, 8, 3,
+	8, 4, 8, 4, 8, 0, 3, 3, 8, 4, 8, 0, 8, 8, 0, 3,
+	0, 8, 4, 4, 8, 0, 8, 3, 3, 4, 5, 4, 0, 5, 3, 5,
+	5, 3, 0, 8, 4, 4, 8, 4, 8, 0, 3, 3, 3, 4, 0, 5,
+	0, 4, 2, 3, 3, 4, 4, 8, 8, 0, 3, 8, 3, 8, 4, 4,
+	5, 4, 2, 3, 2, 3, 3, 4, 8, 4, 0, 5, 0, 3, 0, 3,
+	0, 4, 4, 2, 4, 2, 10, 3, 8, 3, 3, 5, 5, 4, 4, 2,
+	5, 5, 3, 5, 0, 3, 4, 4, 5, 0, 5, 3, 0, 3, 8, 4,
+	4, 5, 5, 4, 2, 3, 10, 3, 3, 8, 8, 4, 5, 4, 0, 5,
+	0, 3, 3, 8, 4, 4, 0, 5, 0, 3, 3, 4, 4, 0, 4, 2,
+	8, 3, 3, 3, 8, 8, 4, 4, 4, 5, 4, 2, 3, 3, 3, 3,
+	4, 4, 0, 8, 0, 3, 8, 3, 8, 4, 5, 4, 5, 0, 5, 3,
+	5, 3, 0, 4, 4, 0, 8, 0, 3, 8, 8, 0, 3, 0, 8, 4,
+	4, 4, 5, 0, 3, 0, 3, 3, 4, 0, 4, 10, 3, 8, 3, 5,
+	8, 4, 4, 0, 8, 0, 5, 3, 3, 4, 4, 0, 8, 3, 8, 3,
+	8, 4, 4, 0, 8, 8, 0, 3, 0, 3, 8, 4, 4, 0, 8, 3,
+	8, 8, 0, 3, 0, 8, 4, 4, 4, 0, 8, 3, 8, 3, 3, 4,
+	5, 4, 0, 5, 5, 3, 5, 3, 0, 4, 5, 4, 0, 5, 5, 3,
+	5, 0, 3, 0, 0, 8, 0, 8, 0, 5, 5, 5, 0, 0, 8, 8,
+	4, 0, 5, 5, 3, 5, 0, 4, 5, 4, 4, 0, 10, 2, 3, 3,
+	3, 4, 0, 4, 2, 8, 0, 3, 3, 4, 4, 4, 2, 8, 3, 10,
+	8, 3, 3, 4, 5, 4, 4, 2, 10, 10, 3, 3, 3, 4, 0, 4,
+	2, 4, 0, 3, 0, 3, 3, 4, 4, 4, 7, 4, 2, 3, 8, 3,
+	3, 3, 4, 0, 4, 2, 8, 8, 0, 5, 3, 3, 4, 0, 4, 2,
+	8, 3, 3, 4, 4, 4, 8, 2, 3, 2, 8, 3, 3, 4, 4, 4,
+	7, 0, 3, 8, 8, 3, 3, 4, 8, 4, 5, 0, 5, 3, 5, 3,
+	0, 4, 5, 4, 7, 0, 5, 3, 3, 4, 5, 4, 7, 4, 0, 5,
+	3, 0, 3, 3, 4, 5, 4, 7, 0, 5, 0, 3, 3, 4, 0, 4,
+	10, 8, 3, 3, 4, 0, 4, 10, 8, 0, 3, 3, 4, 8, 0, 5,
+	5, 0, 5, 3, 0, 4, 5, 4, 4, 2, 7, 3, 5, 3, 3, 4,
+	0, 4, 10, 0, 8, 8, 0, 3, 3, 4, 5, 4, 4, 2, 7, 3,
+	5, 0, 3, 3, 4, 5, 4, 2, 5, 5, 3, 3, 4, 5, 4, 2,
+	5, 5, 0, 3, 3, 4, 0, 5, 0, 4, 2, 8, 3, 3, 4, 4,
+	4, 4, 7, 2, 3, 8, 3, 3, 3, 4, 5, 4, 4, 2, 10, 2,
+	3, 3, 3, 4, 5, 4, 4, 10, 10, 3, 3, 3, 4, 4, 4, 2,
+	8, 3, 8, 3, 3, 8, 4, 5, 4, 4, 0, 10, 10, 3, 3, 3,
+	5, 5, 4, 0, 4, 10, 0, 3, 8, 3, 4, 5, 4, 4, 4, 7,
+	0, 3, 3, 3, 3, 5, 4, 5, 5, 3, 5, 5, 0, 5, 4, 0,
+	4, 0, 3, 3, 8, 4, 4, 4, 8, 2, 3, 0, 3, 3, 8, 5,
+	4, 5, 5, 3, 5, 0, 5, 5, 4, 5, 4, 5, 4, 0, 7, 3,
+	3, 3, 4, 5, 4, 5, 4, 7, 3, 3, 3, 5, 4, 5, 0, 5,
+	3, 5, 5, 0, 5, 4, 4, 4, 2, 3, 0, 3, 3, 8, 4, 0,
+	8, 0, 3, 8, 8, 4, 4, 0, 8, 0, 3, 3, 4, 0, 4, 8,
+	0, 8, 3, 3, 8, 4, 5, 4, 2, 4, 2, 10, 8, 3, 3, 3,
+	4, 0, 4, 10, 8, 4, 2, 10, 3, 3, 3, 5, 4, 5, 4, 7,
+	3, 5, 5, 3, 5, 4, 4, 4, 2, 3, 8, 3, 3, 8, 4, 5,
+	4, 0, 5, 5, 0, 3, 0, 3, 0, 4, 0, 5, 0, 4, 2, 8,
+	0, 3, 3, 4, 4, 4, 4, 7, 2, 3, 3, 8, 3, 3, 5, 0,
+	5, 5, 4, 5, 0, 5, 0, 3, 5, 0, 5, 5, 4, 5, 5, 0,
+	3, 4, 4, 4, 2, 8, 3, 3, 8, 3, 8, 5, 0, 5, 5, 4,
+	0, 5, 5, 0, 3, 5, 5, 4, 4, 4, 10, 3, 10, 3, 0, 3,
+	4, 5, 4, 4, 4, 7, 2, 3, 3, 3, 3, 5, 4, 0, 5, 5,
+	3, 5, 5, 0, 5, 4, 0, 4, 0, 3, 0, 3, 8, 4, 4, 4,
+	8, 2, 3, 0, 3, 0, 3, 8, 4, 5, 4, 4, 2, 8, 3, 3,
+	3, 8, 8, 4, 4, 0, 8, 3, 8, 3, 5, 4, 0, 8, 3, 8,
+	8, 0, 5, 4, 0, 8, 8, 4, 10, 0, 5, 3, 3, 4, 0, 8,
+	8, 8, 0, 5, 0, 3, 0, 4, 0, 8, 3, 8, 4, 0, 8, 8,
+	0, 3, 0, 4, 4, 8, 0, 3, 0, 8, 3, 8, 4, 0, 5, 5,
+	4, 0, 5, 3, 5, 3, 0, 4, 4, 8, 0, 3, 0, 8, 8, 0,
+	3, 0, 8, 4, 4, 4, 8, 0, 3, 0, 8, 3, 3, 4, 0, 5,
+	5, 0, 5, 5, 3, 0, 4, 0, 5, 5, 0, 5, 5, 0, 3, 0,
+	4, 8, 4, 5, 5, 3, 5, 3, 0, 4, 5, 5, 4, 2, 5, 3,
+	3, 4, 4, 8, 0, 3, 8, 8, 0, 3, 8, 4, 5, 5, 4, 2,
+	5, 0, 3, 3, 4, 5, 5, 0, 5, 3, 0, 4, 5, 5, 4, 7,
+	0, 3, 3, 4, 8, 4, 5, 5, 3, 5, 0, 3, 0, 4, 5, 5,
+	4, 4, 7, 3, 3, 3, 8, 8, 4, 4, 8, 0, 8, 3, 5, 0,
+	3, 4, 4, 0, 4, 2, 3, 0, 3, 3, 8, 4, 5, 5, 0, 5,
+	0, 3, 0, 8, 4, 4, 5, 5, 0, 5, 3, 3, 4, 5, 5, 4,
+	4, 0, 7, 3, 0, 3, 3, 4, 5, 5, 4, 4, 7, 3, 0, 3,
+	3, 8, 8, 4, 8, 4, 8, 0, 5, 0, 3, 0, 3, 4, 4, 0,
+	4, 2, 3, 0, 3, 0, 3, 8, 4, 4, 0, 3, 0, 8, 3, 8,
+	4, 4, 0, 3, 0, 8, 8, 0, 3, 0, 8, 0, 8, 0, 8, 4,
+	8, 8, 0, 3, 8, 4, 8, 8, 8, 0, 3, 0, 8, 4, 8, 0,
+	8, 0, 3, 4, 8, 8, 4, 10, 0, 3, 3, 8, 4, 4, 8, 8,
+	0, 3, 3, 4, 8, 0, 8, 8, 3, 8, 4, 8, 4, 8, 0, 3,
+	8, 3, 8, 4, 8, 0, 8, 8, 0, 3, 8, 4, 8, 4, 8, 0,
+	8, 3, 3, 8, 4, 5, 4, 0, 5, 3, 5, 3, 0, 4, 5, 4,
+	4, 7, 3, 5, 0, 3, 3, 4, 8, 0, 8, 8, 8, 0, 3, 0,
+	4, 8, 4, 8, 0, 3, 8, 8, 0, 3, 0, 4, 8, 8, 4, 2,
+	8, 8, 3, 3, 8, 4, 4, 8, 0, 8, 8, 3, 3, 4, 5, 4,
+	0, 5, 3, 5, 0, 3, 0, 8, 4, 4, 8, 4, 8, 0, 3, 8,
+	3, 3, 4, 8, 0, 8, 8, 4, 10, 0, 3, 3, 8, 4, 4, 8,
+	8, 4, 2, 10, 3, 3, 3, 4, 8, 8, 4, 2, 8, 8, 0, 3,
+	3, 8, 4, 4, 8, 0, 8, 8, 0, 3, 3, 4, 0, 4, 2, 8,
+	3, 8, 3, 5, 4, 0, 4, 0, 8, 8, 3, 5, 0, 3, 0, 4,
+	5, 0, 5, 5, 3, 0, 4, 5, 0, 5, 5, 4, 2, 3, 3, 4,
+	5, 0, 5, 5, 0, 3, 0, 8, 4, 4, 5, 0, 5, 5, 3, 3,
+	4, 5, 0, 5, 5, 0, 4, 2, 3, 3, 8, 4, 4, 5, 0, 5,
+	5, 0, 3, 3, 0, 8, 0, 5, 5, 0, 8, 8, 4, 5, 0, 5,
+	3, 5, 0, 4, 8, 0, 8, 8, 0, 8, 3, 8, 4, 5, 4, 4,
+	2, 7, 0, 3, 3, 3, 4, 5, 4, 2, 5, 3, 3, 4, 5, 4,
+	4, 5, 0, 3, 3, 3, 0, 4, 8, 0, 5, 5, 4, 2, 3, 3,
+	4, 5, 4, 4, 2, 7, 3, 0, 3, 3, 4, 8, 0, 8, 8, 0,
+	8, 0, 3, 8, 4, 8, 0, 8, 0, 5, 5, 0, 3, 0, 4, 5,
+	4, 2, 5, 0, 3, 3, 4, 5, 4, 4, 5, 0, 3, 2, 3, 3,
+	4, 4, 0, 8, 0, 5, 3, 5, 5, 3, 0, 4, 4, 4, 7, 3,
+	5, 0, 5, 3, 3, 4, 8, 8, 4, 0, 8, 8, 0, 3, 3, 8,
+	5, 4, 4, 2, 5, 5, 3, 5, 5, 0, 3, 4, 0, 4, 2, 8,
+	8, 3, 3, 4, 0, 4, 2, 8, 8, 0, 3, 3, 4, 5, 0, 5,
+	3, 0, 4, 5, 4, 7, 4, 0, 3, 3, 3, 4, 5, 4, 7, 0,
+	3, 3, 4, 8, 4, 5, 4, 7, 3, 3, 3, 4, 5, 4, 7, 0,
+	4, 0, 3, 3, 3, 4, 8, 4, 5, 4, 7, 0, 3, 3, 3, 4,
+	8, 0, 5, 5, 0, 3, 0, 4, 5, 4, 4, 0, 7, 3, 3, 3,
+	4, 8, 0, 8, 8, 0, 8, 8, 0, 3, 0, 4, 5, 4, 4, 0,
+	7, 0, 3, 3, 3, 4, 5, 4, 4, 7, 3, 3, 3, 4, 5, 4,
+	4, 7, 0, 3, 3, 3, 4, 8, 0, 8, 8, 4, 10, 8, 3, 3,
+	4, 5, 4, 4, 4, 7, 3, 3, 3, 3, 0, 8, 8, 4, 0, 5,
+	5, 3, 0, 8, 0, 8, 0, 5, 5, 4, 0, 4, 0, 8, 0, 3,
+	3, 8, 5, 4, 5, 5, 0, 5, 3, 5, 5, 4, 8, 0, 8, 8,
+	4, 10, 0, 8, 3, 3, 4, 4, 5, 5, 3, 5, 4, 7, 0, 3,
+	3, 5, 4, 5, 0, 5, 5, 3, 5, 0, 5, 5, 4, 5, 0, 5,
+	5, 3, 5, 5, 4, 0, 4, 0, 8, 3, 3, 8, 8, 4, 4, 0,
+	4, 0, 8, 3, 3, 3, 4, 5, 0, 5, 0, 3, 0, 4, 0, 4,
+	8, 8, 0, 3, 3, 8, 4, 5, 4, 5, 0, 3, 0, 3, 0, 8,
+	4, 4, 5, 0, 5, 3, 3, 4, 5, 4, 5, 0, 5, 0, 3, 3,
+	8, 8, 4, 4, 5, 4, 5, 0, 3, 3, 3, 4, 8, 0, 5, 5,
+	0, 4, 2, 3, 3, 4, 5, 4, 4, 0, 7, 3, 0, 3, 3, 5,
+	4, 5, 4, 7, 3, 5, 0, 5, 0, 3, 5, 4, 5, 4, 7, 3,
+	5, 5, 0, 3, 4, 5, 4, 4, 7, 3, 0, 3, 3, 4, 5, 4,
+	4, 7, 0, 3, 0, 3, 3, 4, 8, 0, 8, 8, 4, 10, 8, 0,
+	3, 3, 4, 5, 4, 4, 4, 7, 3, 3, 0, 3, 3, 4, 8, 8,
+	4, 2, 5, 5, 0, 3, 3, 4, 4, 2, 3, 8, 8, 3, 5, 5,
+	4, 0, 4, 0, 8, 0, 3, 0, 3, 8, 5, 4, 0, 5, 5, 0,
+	5, 3, 5, 5, 5, 4, 5, 5, 3, 5, 4, 0, 5, 0, 3, 4,
+	4, 5, 5, 3, 5, 0, 5, 3, 0, 0, 8, 8, 4, 8, 4, 0,
+	5, 5, 3, 0, 3, 4, 4, 5, 5, 3, 5, 0, 5, 0, 3, 0,
+	4, 0, 4, 0, 3, 8, 3, 8, 4, 0, 4, 0, 3, 8, 8, 0,
+	3, 0, 4, 0, 8, 0, 8, 3, 8, 4, 8, 4, 0, 8, 0, 3,
+	3, 8, 4, 0, 8, 0, 8, 8, 0, 3, 0, 8, 4, 4, 5, 0,
+	5, 0, 3, 3, 4, 4, 5, 0, 5, 3, 5, 5, 3, 0, 4, 4,
+	5, 0, 5, 3, 5, 5, 0, 3, 0, 4, 8, 4, 0, 5, 5, 3,
+	5, 3, 0, 4, 0, 5, 5, 4, 2, 5, 3, 3, 4, 4, 8, 0,
+	3, 0, 8, 8, 0, 3, 8, 4, 0, 5, 5, 4, 2, 5, 0, 3,
+	3, 4, 0, 5, 5, 0, 5, 3, 0, 4, 0, 5, 5, 4, 7, 0,
+	3, 3, 4, 8, 4, 0, 5, 5, 3, 5, 0, 3, 0, 4, 0, 5,
+	5, 4, 4, 7, 3, 3, 3, 5, 4, 4, 5, 5, 3, 5, 3, 5,
+	0, 5, 5, 4, 4, 5, 5, 3, 5, 3, 5, 5, 4, 0, 5, 5,
+	0, 5, 0, 3, 0, 8, 4, 4, 0, 5, 5, 0, 5, 3, 3, 5,
+	4, 0, 5, 5, 3, 5, 4, 0, 5, 0, 3, 4, 4, 0, 5, 5,
+	3, 5, 0, 5, 3, 0, 4, 5, 5, 4, 4, 4, 7, 2, 3, 3,
+	3, 3, 5, 4, 4, 0, 5, 5, 3, 5, 3, 5, 5, 4, 0, 4,
+	0, 3, 0, 8, 3, 8, 4, 0, 4, 0, 3, 0, 8, 8, 0, 3,
+	0, 4, 0, 8, 8, 3, 8, 4, 0, 8, 8, 0, 3, 8, 4, 0,
+	8, 8, 8, 0, 3, 0, 8, 4, 4, 0, 8, 8, 3, 3, 4, 0,
+	8, 8, 4, 10, 0, 3, 3, 8, 4, 4, 0, 8, 8, 0, 3, 3,
+	4, 5, 5, 3, 0, 4, 8, 8, 0, 8, 3, 8, 4, 5, 5, 4,
+	2, 3, 3, 4, 8, 8, 0, 8, 0, 3, 8, 4, 8, 8, 4, 8,
+	0, 3, 3, 8, 4, 8, 4, 8, 8, 0, 3, 3, 8, 4, 5, 5,
+	0, 3, 0, 4, 8, 8, 0, 8, 8, 0, 3, 0, 4, 8, 8, 4,
+	10, 8, 3, 3, 8, 4, 4, 5, 5, 3, 3, 4, 8, 8, 4, 10,
+	0, 8, 3, 3, 8, 4, 4, 8, 8, 0, 8, 3, 3, 4, 5, 5,
+	0, 4, 2, 3, 3, 4, 8, 4, 5, 5, 0, 3, 0, 3, 0, 4,
+	8, 8, 4, 10, 8, 0, 3, 3, 8, 4, 4, 5, 5, 0, 3, 3,
+	4, 8, 8, 4, 10, 0, 8, 0, 3, 3, 8, 4, 4, 8, 8, 0,
+	8, 0, 3, 3, 4, 4, 0, 5, 3, 5, 5, 3, 0, 4, 4, 0,
+	3, 0, 8, 8, 0, 3, 8, 4, 4, 0, 5, 3, 5, 5, 0, 3,
+	0, 8, 4, 4, 5, 5, 0, 4, 0, 3, 3, 3, 8, 4, 8, 4,
+	4, 10, 8, 0, 3, 3, 3, 8, 4, 4, 8, 4, 8, 8, 0, 3,
+	3, 3, 0, 5, 0, 8, 8, 0, 5, 5, 0, 5, 0, 4, 5, 4,
+	7, 0, 8, 3, 3, 4, 0, 4, 10, 0, 5, 0, 3, 3, 4, 4,
+	4, 0, 7, 3, 5, 3, 3, 4, 8, 4, 8, 8, 0, 3, 8, 3,
+	8, 4, 5, 4, 2, 3, 3, 4, 8, 8, 0, 8, 8, 0, 3, 8,
+	4, 5, 4, 7, 0, 8, 0, 3, 3, 4, 8, 0, 5, 0, 3, 0,
+	4, 4, 4, 0, 7, 3, 5, 0, 3, 3, 4, 8, 4, 8, 8, 0,
+	8, 3, 3, 8, 4, 5, 4, 2, 4, 0, 3, 3, 3, 4, 4, 4,
+	2, 8, 3, 7, 0, 3, 3, 4, 5, 4, 2, 4, 0, 3, 0, 3,
+	3, 4, 4, 4, 2, 8, 3, 7, 3, 3, 4, 4, 4, 10, 10, 3,
+	5, 3, 3, 4, 4, 4, 10, 10, 3, 5, 0, 3, 3, 4, 4, 0,
+	5, 3, 5, 3, 0, 4, 0, 4, 2, 8, 8, 0, 8, 3, 3, 4,
+	4, 4, 7, 3, 5, 0, 3, 3, 4, 4, 4, 8, 0, 7, 3, 5,
+	3, 3, 4, 4, 4, 0, 10, 10, 3, 5, 3, 3, 4, 4, 4, 0,
+	10, 10, 3, 5, 0, 3, 3, 4, 5, 0, 3, 0, 4, 8, 8, 0,
+	8, 8, 8, 0, 3, 0, 4, 5, 5, 4, 2, 8, 3, 3, 4, 4,
+	2, 4, 10, 3, 7, 0, 3, 3, 4, 4, 4, 4, 7, 3, 3, 5,
+	3, 3, 4, 4, 4, 4, 7, 2, 3, 5, 3, 3, 3, 4, 5, 4,
+	0, 3, 0, 3, 0, 4, 5, 4, 7, 4, 2, 10, 3, 3, 3, 8,
+	8, 4, 5, 0, 5, 3, 0, 8, 0, 5, 4, 8, 8, 4, 10, 0,
+	8, 8, 3, 3, 0, 8, 8, 8, 0, 5, 5, 0, 5, 4, 5, 5,
+	0, 4, 2, 8, 3, 3, 4, 8, 8, 8, 4, 7, 0, 5, 0, 3,
+	3, 4, 8, 8, 4, 10, 8, 0, 8, 3, 3, 8, 4, 4, 5, 4,
+	0, 3, 3, 3, 4, 4, 10, 0, 3, 8, 3, 5, 8, 4, 4, 8,
+	0, 5, 0, 3, 3, 4, 4, 0, 5, 3, 5, 0, 3, 0, 4, 0,
+	4, 0, 8, 8, 0, 3, 3, 8, 4, 0, 4, 0, 5, 5, 0, 3,
+	0, 3, 0, 4, 4, 0, 8, 0, 5, 3, 5, 3, 0, 4, 4, 4,
+	0, 8, 3, 8, 3, 5, 3, 0, 5, 4, 5, 4, 0, 5, 5, 3,
+	5, 3, 5, 4, 5, 0, 4, 2, 3, 3, 4, 5, 4, 4, 7, 0,
+	3, 8, 3, 3, 4, 5, 5, 4, 2, 8, 0, 3, 3, 4, 8, 4,
+	5, 0, 3, 0, 3, 0, 4, 4, 4, 4, 7, 3, 3, 5, 0, 3,
+	3, 5, 4, 5, 4, 2, 5, 5, 3, 5, 0, 3, 4, 5, 0, 4,
+	0, 3, 0, 3, 0, 4, 5, 4, 5, 4, 2, 3, 10, 3, 3, 8,
+	8, 4, 5, 4, 5, 0, 3, 3, 8, 4, 4, 5, 0, 3, 3, 4,
+	8, 8, 4, 10, 0, 8, 8, 0, 3, 3, 5, 4, 0, 5, 5, 0,
+	5, 5, 3, 5, 4, 5, 5, 0, 4, 2, 8, 0, 3, 3, 4, 4,
+	5, 5, 0, 5, 3, 5, 3, 0, 8, 8, 4, 8, 4, 5, 0, 5,
+	3, 0, 3, 8, 4, 4, 5, 4, 0, 3, 0, 3, 3, 0, 4, 8,
+	0, 8, 3, 5, 8, 4, 0, 8, 0, 5, 0, 3, 4, 0, 4, 0,
+	8, 3, 8, 3, 8, 4, 0, 4, 0, 8, 8, 0, 3, 0, 3, 8,
+	4, 0, 4, 0, 8, 3, 8, 8, 0, 3, 0, 8, 4, 4, 4, 0,
+	5, 3, 5, 0, 3, 3, 4, 4, 5, 0, 5, 5, 3, 5, 3, 0,
+	4, 4, 5, 0, 5, 5, 3, 5, 0, 3, 0, 4, 0, 8, 0, 8,
+	8, 3, 8, 4, 4, 5, 4, 0, 7, 3, 5, 3, 3, 4, 0, 8,
+	0, 8, 8, 0, 3, 8, 4, 4, 2, 4, 2, 10, 3, 5, 3, 3,
+	4, 4, 5, 0, 5, 3, 5, 3, 0, 4, 4, 5, 4, 7, 3, 5,
+	0, 3, 3, 4, 0, 8, 0, 8, 8, 8, 0, 3, 0, 4, 5, 5,
+	4, 4, 2, 10, 2, 3, 3, 3, 4, 0, 8, 8, 4, 2, 8, 8,
+	3, 3, 8, 4, 4, 5, 0, 4, 0, 3, 3, 3, 4, 4, 2, 8,
+	0, 3, 8, 3, 5, 8, 4, 4, 8, 4, 5, 0, 3, 0, 3, 3,
+	4, 5, 0, 5, 0, 4, 2, 8, 0, 3, 3, 4, 4, 0, 5, 5,
+	0, 5, 3, 5, 3, 0, 4, 0, 8, 8, 4, 2, 8, 8, 0, 3,
+	3, 8, 4, 4, 5, 0, 4, 0, 3, 0, 3, 3, 4, 4, 2, 8,
+	3, 8, 3, 5, 4, 4, 0, 8, 8, 3, 5, 0, 3, 0, 4, 4,
+	5, 5, 3, 5, 3, 0, 4, 4, 10, 8, 0, 3, 8, 3, 5, 4,
+	4, 5, 5, 3, 5, 0, 3, 0, 8, 4, 4, 8, 0, 8, 0, 5,
+	3, 3, 4, 8, 8, 4, 2, 8, 0, 5, 0, 3, 3, 8, 4, 4,
+	8, 0, 8, 0, 5, 0, 3, 3, 4, 0, 5, 5, 3, 0, 4, 0,
+	8, 8, 0, 8, 3, 8, 4, 0, 5, 5, 4, 2, 3, 3, 4, 0,
+	8, 8, 0, 8, 0, 3, 8, 4, 0, 8, 8, 4, 8, 0, 3, 3,
+	8, 4, 8, 4, 0, 8, 8, 0, 3, 3, 8, 4, 0, 5, 5, 0,
+	3, 0, 4, 0, 8, 8, 0, 8, 8, 0, 3, 0, 4, 0, 8, 8,
+	4, 10, 8, 3, 3, 8, 4, 4, 0, 5, 5, 3, 3, 4, 0, 8,
+	8, 4, 10, 0, 8, 3, 3, 8, 4, 4, 0, 8, 8, 0, 8, 3,
+	3, 4, 0, 5, 5, 0, 4, 2, 3, 3, 4, 8, 4, 0, 5, 5,
+	0, 3, 0, 3, 0, 4, 0, 8, 8, 4, 10, 8, 0, 3, 3, 8,
+	4, 4, 0, 5, 5, 0, 3, 3, 4, 4, 4, 10, 3, 8, 3, 5,
+	3, 5, 8, 4, 4, 0, 8, 8, 0, 8, 0, 3, 3, 4, 4, 0,
+	5, 5, 3, 5, 3, 0, 4, 4, 2, 8, 8, 0, 3, 8, 3, 5,
+	4, 4, 0, 5, 5, 3, 5, 0, 3, 0, 8, 4, 4, 4, 0, 8,
+	8, 3, 5, 3, 3, 4, 4, 4, 0, 10, 3, 8, 3, 5, 3, 5,
+	8, 4, 4, 4, 0, 8, 8, 3, 5, 0, 3, 3, 0, 4, 0, 3,
+	8, 8, 0, 5, 5, 0, 4, 0, 3, 4, 4, 4, 5, 0, 10, 3,
+	3, 3, 4, 4, 4, 10, 0, 3, 3, 3, 4, 4, 4, 2, 7, 3,
+	3, 0, 3, 4, 4, 4, 4, 0, 10, 3, 3, 0, 3, 3, 5, 4,
+	4, 0, 8, 3, 3, 4, 8, 8, 0, 8, 8, 0, 3, 8, 8, 4,
+	4, 10, 8, 0, 5, 0, 3, 0, 3, 4, 4, 10, 0, 3, 0, 3,
+	4, 4, 4, 2, 7, 2, 3, 3, 3, 5, 4, 4, 5, 0, 5, 5,
+	0, 3, 3, 4, 4, 2, 8, 0, 5, 5, 3, 0, 3, 4, 4, 4,
+	0, 10, 0, 3, 3, 3, 5, 4, 4, 0, 5, 5, 0, 5, 0, 3,
+	3, 4, 4, 4, 0, 10, 3, 3, 3, 4, 4, 4, 10, 8, 3, 3,
+	3, 4, 4, 4, 10, 8, 0, 3, 3, 3, 4, 4, 2, 5, 3, 0,
+	3, 4, 4, 4, 10, 0, 5, 0, 3, 3, 3, 4, 4, 4, 7, 2,
+	3, 3, 3, 0, 4, 4, 4, 10, 0, 5, 3, 3, 3, 4, 4, 4,
+	0, 10, 8, 3, 3, 3, 4, 4, 4, 0, 10, 8, 0, 3, 3, 3,
+	4, 4, 2, 3, 0, 3, 5, 4, 5, 4, 5, 0, 5, 5, 3, 3,
+	4, 4, 7, 4, 2, 8, 3, 3, 3, 4, 4, 0, 4, 10, 0, 3,
+	3, 3, 4, 4, 2, 4, 2, 5, 3, 3, 3, 4, 4, 4, 4, 2,
+	10, 3, 3, 0, 3, 3, 8, 8, 8, 4, 5, 5, 0, 3, 0, 8,
+	8, 8, 4, 0, 5, 5, 0, 3, 0, 0, 8, 8, 0, 5, 0, 0,
+	8, 0, 0, 8, 8, 0, 8, 0, 5, 5, 0, 0, 8, 8, 8, 0,
+	5, 5, 0, 4, 4, 7, 0, 4, 2, 8, 3, 3, 3, 4, 4, 7,
+	5, 4, 5, 2, 3, 3, 3, 5, 4, 5, 0, 5, 5, 0, 5, 3,
+	4, 4, 7, 0, 8, 3, 8, 3, 4, 4, 10, 0, 3, 8, 3, 4,
+	4, 8, 4, 10, 0, 3, 3, 3, 4, 4, 2, 5, 0, 3, 0, 3,
+	4, 4, 4, 10, 8, 2, 3, 3, 8, 3, 4, 4, 4, 5, 0, 3,
+	2, 3, 0, 3, 4, 4, 2, 8, 0, 5, 3, 0, 3, 4, 4, 4,
+	0, 8, 3, 10, 3, 0, 3, 5, 4, 5, 4, 0, 5, 5, 3, 5,
+	3, 4, 4, 2, 4, 2, 3, 3, 3, 4, 4, 4, 4, 5, 2, 3,
+	10, 3, 3, 3, 5, 4, 5, 4, 5, 0, 5, 0, 3, 3, 4, 4,
+	2, 8, 0, 3, 0, 3, 4, 4, 2, 4, 2, 5, 0, 3, 3, 3,
+	5, 4, 5, 4, 0, 5, 5, 0, 3, 3, 4, 4, 2, 4, 0, 3,
+	0, 3, 0, 3, 4, 4, 4, 5, 4, 2, 3, 10, 3, 3, 3, 4,
+	4, 2, 3, 8, 8, 0, 5, 3, 4, 4, 2, 3, 8, 3, 4, 4,
+	4, 10, 2, 3, 0, 3, 8, 3, 5, 4, 0, 5, 5, 0, 5, 5,
+	3, 5, 4, 5, 5, 4, 0, 5, 0, 3, 3, 4, 4, 7, 5, 0,
+	5, 3, 0, 3, 5, 4, 5, 5, 0, 4, 0, 5, 0, 3, 3, 4,
+	4, 7, 0, 8, 0, 3, 8, 3, 0, 4, 8, 0, 8, 3, 4, 4,
+	10, 8, 0, 3, 0, 3, 4, 4, 10, 0, 8, 3, 8, 3, 4, 4,
+	10, 4, 8, 0, 3, 3, 8, 3, 4, 4, 10, 0, 8, 8, 0, 3,
+	0, 3, 4, 4, 10, 4, 2, 5, 0, 3, 3, 3, 4, 4, 7, 0,
+	5, 5, 3, 0, 3, 4, 4, 7, 0, 5, 5, 0, 3, 0, 3, 4,
+	4, 10, 0, 5, 5, 3, 0, 3, 4, 4, 7, 4, 2, 5, 3, 3,
+	3, 4, 4, 10, 0, 8, 8, 0, 3, 8, 3, 4, 4, 2, 4, 2,
+	8, 3, 3, 3, 4, 4, 7, 0, 5, 3, 0, 3, 4, 4, 7, 4,
+	5, 2, 3, 3, 3, 4, 4, 10, 0, 5, 5, 0, 3, 0, 3, 4,
+	4, 7, 0, 4, 2, 5, 3, 3, 3, 5, 4, 4, 5, 5, 3, 5,
+	0, 5, 3, 4, 4, 2, 4, 0, 3, 3, 8, 3, 4, 4, 2, 8,
+	0, 3, 8, 3, 4, 4, 10, 4, 2, 8, 0, 3, 3, 3, 5, 4,
+	0, 5, 5, 4, 0, 5, 0, 3, 3, 4, 4, 2, 5, 5, 0, 5,
+	3, 0, 3, 5, 4, 4, 0, 5, 5, 3, 5, 0, 5, 3, 4, 4,
+	2, 4, 0, 3, 0, 3, 8, 3, 4, 4, 2, 8, 3, 8, 3, 4,
+	4, 2, 8, 8, 0, 3, 0, 3, 4, 4, 7, 5, 3, 0, 3, 4,
+	4, 10, 8, 0, 3, 8, 3, 4, 4, 7, 5, 0, 3, 0, 3, 4,
+	4, 8, 4, 10, 8, 3, 3, 3, 4, 4, 8, 8, 4, 10, 0, 3,
+	3, 3, 4, 4, 8, 4, 10, 8, 0, 3, 3, 3, 4, 4, 7, 3,
+	0, 3, 4, 4, 10, 8, 0, 8, 3, 8, 3, 4, 4, 7, 4, 2,
+	3, 3, 3, 4, 4, 10, 0, 5, 0, 3, 0, 3, 4, 4, 4, 2,
+	7, 3, 5, 3, 0, 3, 4, 4, 2, 4, 2, 8, 8, 0, 3, 3,
+	3, 4, 4, 7, 0, 3, 0, 3, 4, 4, 7, 5, 4, 2, 8, 3,
+	3, 3, 4, 4, 7, 4, 0, 3, 0, 3, 0, 3, 0, 4, 0, 8,
+	0, 5, 3, 4, 4, 2, 4, 0, 8, 3, 3, 8, 3, 5, 4, 4,
+	5, 0, 5, 5, 3, 5, 3, 4, 4, 7, 0, 4, 2, 3, 3, 3,
+	4, 4, 10, 4, 5, 0, 3, 0, 3, 0, 3, 4, 4, 7, 0, 4,
+	0, 3, 0, 3, 0, 3, 8, 4, 4, 4, 7, 0, 3, 3, 3, 4,
+	4, 4, 10, 3, 8, 3, 5, 3, 4, 4, 8, 4, 10, 0, 5, 3,
+	3, 3, 4, 4, 2, 5, 5, 3, 0, 3, 4, 4, 2, 8, 8, 0,
+	3, 8, 3, 4, 4, 2, 5, 5, 0, 3, 0, 3, 4, 4, 10, 4,
+	2, 8, 8, 3, 3, 3, 4, 4, 4, 0, 10, 3, 8, 3, 5, 3,
+	4, 4, 10, 4, 2, 8, 8, 0, 3, 3, 3, 0, 4, 0, 3, 0,
+	8, 8, 0, 5, 5, 0, 4, 0, 3, 0, 4, 4, 4, 7, 2, 8,
+	3, 3, 3, 4, 4, 4, 10, 0, 3, 3, 3, 0, 4, 4, 4, 0,
+	7, 3, 3, 0, 3, 4, 4, 4, 4, 0, 10, 3, 3, 2, 3, 3,
+	5, 4, 4, 2, 8, 3, 3, 4, 8, 8, 0, 8, 8, 0, 3, 8,
+	8, 0, 5, 4, 4, 7, 5, 0, 5, 0, 3, 3, 4, 4, 10, 0,
+	3, 0, 3, 0, 4, 4, 4, 0, 7, 2, 3, 3, 3, 5, 4, 4,
+	7, 0, 5, 5, 0, 3, 3, 4, 4, 4, 0, 7, 2, 8, 3, 3,
+	3, 4, 4, 4, 2, 10, 0, 3, 3, 3, 5, 4, 4, 2, 5, 5,
+	0, 5, 0, 3, 3, 4, 4, 4, 2, 10, 3, 3, 3, 4, 4, 4,
+	10, 8, 3, 3, 3, 0, 4, 4, 4, 10, 10, 2, 3, 3, 3, 4,
+	4, 2, 5, 3, 0, 3, 0, 4, 4, 4, 10, 2, 7, 0, 3, 3,
+	3, 4, 4, 4, 7, 2, 3, 3, 3, 4, 4, 4, 10, 2, 7, 3,
+	3, 3, 4, 4, 4, 2, 10, 8, 3, 3, 3, 4, 4, 4, 2, 10,
+	8, 0, 3, 3, 3, 4, 4, 2, 3, 0, 3, 0, 5, 5, 5, 4,
+	5, 0, 5, 5, 0, 3, 4, 4, 5, 4, 2, 10, 3, 3, 3, 4,
+	4, 0, 4, 10, 0, 3, 3, 3, 0, 4, 4, 2, 4, 0, 7, 3,
+	3, 3, 4, 4, 4, 4, 7, 0, 3, 3, 3, 0, 3, 8, 8, 8,
+	4, 5, 5, 0, 3, 8, 8, 8, 4, 0, 5, 5, 0, 3, 0, 8,
+	8, 0, 5, 0, 8, 0, 8, 8, 0, 8, 0, 5, 5, 0, 8, 8,
+	8, 0, 5, 5, 4, 4, 5, 0, 4, 2, 10, 3, 3, 3, 4, 4,
+	7, 5, 4, 7, 0, 3, 3, 3, 0, 5, 5, 5, 0, 5, 5, 0,
+	5, 4, 4, 7, 0, 8, 3, 3, 8, 4, 4, 10, 0, 3, 3, 8,
+	4, 8, 4, 4, 10, 0, 3, 3, 3, 4, 4, 2, 5, 0, 3, 0,
+	3, 0, 4, 4, 4, 10, 8, 2, 3, 3, 3, 8, 4, 4, 4, 0,
+	10, 2, 3, 3, 3, 8, 8, 4, 4, 4, 2, 5, 3, 3, 3, 4,
+	4, 4, 0, 8, 3, 3, 3, 0, 8, 0, 5, 5, 5, 4, 0, 5,
+	5, 3, 5, 5, 4, 0, 4, 2, 8, 3, 3, 4, 4, 4, 4, 0,
+	7, 3, 2, 3, 3, 3, 5, 4, 5, 4, 7, 0, 5, 0, 3, 3,
+	4, 4, 2, 8, 0, 3, 0, 3, 0, 4, 4, 2, 4, 0, 7, 0,
+	3, 3, 3, 5, 4, 5, 4, 2, 5, 5, 0, 3, 3, 5, 5, 0,
+	5, 5, 4, 5, 5, 0, 3, 5, 5, 0, 5, 5, 4, 0, 5, 5,
+	0, 3, 4, 4, 2, 3, 3, 8, 8, 0, 5, 4, 4, 2, 3, 3,
+	8, 4, 4, 4, 10, 2, 3, 0, 3, 3, 8, 0, 5, 5, 0, 5,
+	5, 0, 5, 5, 5, 4, 5, 5, 4, 2, 5, 0, 3, 3, 5, 4,
+	5, 5, 4, 7, 0, 3, 3, 4, 8, 8, 4, 10, 0, 5, 0, 3,
+	0, 3, 4, 4, 7, 0, 8, 0, 3, 3, 8, 4, 8, 0, 3, 0,
+	8, 8, 4, 4, 8, 0, 3, 0, 3, 4, 4, 10, 0, 8, 3, 3,
+	8, 4, 4, 10, 4, 8, 0, 3, 3, 3, 8, 4, 4, 8, 8, 4,
+	2, 10, 3, 3, 3, 8, 4, 4, 4, 2, 5, 0, 3, 3, 3, 4,
+	4, 7, 0, 8, 8, 3, 3, 8, 4, 4, 7, 0, 5, 5, 0, 3,
+	0, 3, 0, 4, 4, 10, 0, 8, 8, 3, 3, 8, 4, 4, 7, 4,
+	0, 7, 3, 3, 3, 4, 4, 10, 0, 8, 8, 0, 3, 3, 8, 4,
+	4, 0, 4, 2, 10, 3, 3, 3, 4, 4, 7, 4, 7, 3, 3, 3,
+	4, 4, 7, 4, 7, 0, 3, 3, 3, 4, 4, 10, 0, 5, 5, 0,
+	3, 0, 3, 0, 4, 4, 7, 4, 4, 7, 3, 3, 3, 3, 0, 5,
+	5, 4, 5, 5, 3, 5, 0, 5, 4, 4, 2, 4, 0, 3, 3, 3,
+	8, 4, 4, 2, 8, 0, 3, 3, 8, 8, 4, 4, 4, 2, 8, 0,
+	3, 3, 3, 5, 4, 0, 5, 5, 4, 2, 5, 0, 3, 3, 5, 4,
+	0, 5, 5, 4, 7, 0, 3, 3, 0, 5, 5, 4, 0, 5, 5, 3,
+	5, 0, 5, 4, 4, 2, 4, 0, 3, 0, 3, 3, 8, 4, 4, 2,
+	8, 3, 3, 8, 8, 4, 4, 4, 2, 8, 3, 3, 3, 4, 4, 10,
+	8, 3, 3, 8, 4, 4, 10, 8, 0, 3, 3, 8, 4, 4, 7, 5,
+	0, 3, 0, 3, 0, 4, 8, 4, 4, 10, 8, 3, 3, 3, 4, 4,
+	7, 5, 0, 5, 0, 3, 3, 8, 4, 8, 4, 4, 10, 8, 0, 3,
+	3, 3, 4, 4, 7, 3, 0, 3, 0, 4, 4, 10, 8, 0, 8, 3,
+	3, 8, 4, 4, 7, 5, 0, 3, 3, 8, 4, 4, 10, 0, 5, 0,
+	3, 0, 3, 0, 4, 4, 0, 4, 2, 10, 8, 3, 3, 3, 4, 4,
+	0, 4, 2, 10, 8, 0, 3, 3, 3, 4, 4, 7, 0, 3, 0, 3,
+	0, 4, 4, 5, 5, 4, 2, 10, 3, 3, 3, 8, 8, 4, 5, 4,
+	0, 5, 3, 0, 3, 0, 4, 0, 8, 0, 5, 3, 0, 4, 4, 2,
+	4, 0, 8, 3, 3, 3, 8, 0, 5, 5, 4, 5, 0, 5, 5, 3,
+	5, 4, 4, 7, 0, 5, 0, 3, 3, 8, 5, 4, 4, 5, 4, 7,
+	3, 5, 0, 3, 3, 4, 4, 10, 8, 4, 10, 10, 0, 3, 3, 3,
+	4, 4, 10, 4, 7, 0, 3, 3, 3, 4, 4, 4, 10, 3, 8, 3,
+	5, 3, 0, 4, 8, 4, 4, 10, 0, 5, 3, 3, 3, 4, 4, 2,
+	8, 8, 3, 3, 8, 4, 4, 2, 8, 8, 0, 3, 3, 8, 4, 4,
+	2, 5, 5, 0, 3, 0, 3, 0, 8, 4, 4, 4, 2, 8, 8, 3,
+	3, 3, 4, 4, 4, 2, 10, 3, 3, 8, 3, 5, 8, 4, 4, 4,
+	2, 8, 8, 0, 3, 3, 3, 4, 0, 4, 2, 3, 0, 3, 5, 5,
+	4, 4, 5, 0, 5, 5, 3, 3, 4, 5, 4, 4, 0, 10, 3, 3,
+	3, 4, 4, 4, 8, 2, 3, 2, 3, 0, 3, 4, 4, 4, 0, 7,
+	3, 0, 3, 0, 3, 4, 5, 4, 4, 0, 10, 8, 0, 3, 3, 3,
+	4, 5, 4, 2, 8, 0, 3, 0, 3, 5, 5, 4, 5, 4, 0, 5,
+	5, 3, 3, 5, 5, 4, 5, 5, 0, 5, 3, 4, 0, 3, 0, 8,
+	0, 4, 4, 4, 8, 2, 3, 10, 3, 0, 3, 5, 5, 4, 5, 0,
+	5, 5, 3, 4, 5, 4, 2, 4, 2, 8, 3, 3, 3, 4, 5, 4,
+	7, 4, 5, 2, 3, 3, 3, 5, 5, 4, 0, 5, 5, 0, 5, 3,
+	4, 5, 4, 2, 8, 3, 8, 3, 4, 0, 4, 10, 0, 3, 8, 3,
+	4, 0, 4, 8, 4, 10, 0, 3, 3, 3, 4, 4, 4, 7, 3, 0,
+	3, 0, 3, 4, 4, 4, 10, 10, 0, 3, 3, 8, 3, 4, 4, 4,
+	7, 0, 3, 0, 3, 0, 3, 5, 5, 4, 4, 5, 5, 3, 5, 3,
+	4, 4, 4, 2, 8, 3, 10, 3, 0, 3, 5, 5, 4, 4, 0, 5,
+	5, 3, 5, 3, 4, 0, 4, 2, 3, 0, 3, 0, 5, 5, 4, 4,
+	7, 0, 5, 5, 3, 3, 4, 5, 4, 4, 2, 10, 3, 3, 3, 4,
+	5, 4, 4, 10, 10, 2, 3, 3, 3, 4, 4, 4, 6, 4, 7, 3,
+	3, 3, 3, 4, 4, 4, 4, 7, 2, 3, 3, 3, 0, 3, 5, 5,
+	4, 0, 4, 10, 8, 3, 3, 5, 5, 4, 5, 4, 2, 5, 5, 3,
+	3, 4, 0, 3, 0, 8, 8, 0, 5, 4, 0, 3, 0, 8, 4, 4,
+	4, 8, 2, 3, 3, 3, 0, 8, 5, 5, 4, 5, 0, 5, 5, 3,
+	0, 4, 5, 4, 0, 4, 2, 10, 3, 3, 3, 4, 5, 4, 7, 4,
+	7, 0, 3, 3, 3, 5, 5, 4, 0, 5, 5, 0, 5, 3, 0, 4,
+	5, 4, 2, 8, 3, 3, 8, 4, 0, 4, 10, 0, 3, 3, 8, 4,
+	8, 4, 0, 4, 10, 0, 3, 3, 3, 4, 4, 4, 10, 10, 3, 3,
+	3, 8, 4, 4, 4, 10, 10, 0, 3, 3, 3, 8, 4, 4, 4, 2,
+	10, 2, 3, 3, 3, 8, 5, 5, 4, 4, 5, 5, 3, 5, 3, 0,
+	4, 4, 4, 2, 8, 3, 3, 3, 0, 8, 5, 5, 4, 4, 0, 5,
+	5, 3, 5, 3, 0, 5, 5, 5, 4, 4, 5, 5, 3, 3, 5, 5,
+	5, 4, 4, 0, 5, 5, 3, 3, 5, 5, 5, 4, 5, 0, 5, 3,
+	5, 5, 5, 4, 5, 5, 3, 8, 4, 8, 8, 8, 3, 5, 0, 5,
+	5, 5, 5, 4, 0, 5, 5, 3, 5, 5, 5, 4, 4, 7, 5, 3,
+	3, 5, 5, 5, 4, 4, 2, 5, 5, 3, 3, 5, 5, 5, 4, 5,
+	0, 5, 3, 0, 5, 5, 5, 4, 5, 5, 3, 0, 8, 4, 8, 8,
+	8, 3, 5, 0, 5, 0, 5, 5, 5, 4, 0, 5, 5, 3, 0, 8,
+	8, 0, 8, 0, 5, 8, 8, 8, 0, 5, 8, 8, 0, 8, 0, 5,
+	0, 8, 8, 8, 0, 5, 0, 8, 8, 8, 8, 0, 4, 4, 8, 0,
+	3, 3, 8, 8, 5, 5, 5, 4, 0, 5, 3, 5, 4, 4, 8, 0,
+	3, 3, 8, 8, 0, 5, 5, 5, 4, 0, 5, 3, 5, 0, 5, 5,
+	5, 0, 5, 5, 5, 5, 5, 0, 5, 5, 0, 4, 4, 8, 0, 8,
+	3, 3, 8, 8, 4, 8, 0, 3, 8, 8, 0, 8, 0, 5, 5, 5,
+	4, 4, 7, 3, 5, 0, 5, 3, 4, 5, 0, 4, 2, 8, 3, 8,
+	3, 4, 8, 0, 3, 8, 8, 8, 0, 5, 5, 5, 4, 4, 2, 5,
+	3, 5, 5, 3, 4, 4, 8, 0, 8, 3, 3, 8, 8, 0, 4, 5,
+	5, 4, 4, 7, 2, 3, 3, 3, 5, 5, 4, 4, 7, 3, 5, 0,
+	5, 3, 0, 4, 5, 0, 4, 2, 8, 3, 3, 8, 4, 8, 0, 3,
+	8, 8, 8, 0, 5, 0, 5, 5, 4, 4, 2, 5, 3, 5, 5, 3,
+	0, 5, 5, 0, 5, 5, 4, 0, 5, 3, 5, 5, 0, 5, 5, 0,
+	5, 5, 5, 0, 5, 5, 4, 0, 5, 3, 0, 5, 5, 0, 5, 5,
+	0, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 5, 5, 0,
+	4, 8, 0, 3, 8, 8, 8, 4, 4, 8, 0, 3, 3, 8, 4, 8,
+	0, 3, 8, 8, 0, 8, 4, 4, 8, 0, 3, 8, 3, 5, 5, 4,
+	0, 5, 3, 5, 5, 5, 5, 4, 0, 5, 3, 5, 5, 0, 4, 8,
+	0, 8, 0, 3, 8, 8, 4, 4, 8, 8, 0, 3, 3, 8, 8, 4,
+	4, 5, 4, 2, 3, 2, 3, 0, 3, 5, 5, 4, 4, 7, 5, 3,
+	5, 3, 4, 4, 2, 4, 2, 10, 3, 3, 8, 3, 5, 5, 4, 4,
+	2, 5, 5, 3, 5, 3, 4, 8, 0, 8, 0, 3, 8, 8, 0, 4,
+	4, 8, 8, 0, 3, 3, 8, 8, 0, 4, 8, 8, 4, 2, 8, 0,
+	3, 8, 3, 8, 4, 4, 0, 5, 0, 3, 0, 3, 4, 4, 2, 4,
+	2, 10, 3, 3, 3, 8, 5, 5, 4, 4, 2, 5, 5, 3, 5, 3,
+	0, 4, 4, 0, 8, 0, 3, 3, 8, 8, 5, 5, 4, 5, 0, 5,
+	3, 5, 4, 4, 0, 8, 0, 3, 3, 8, 8, 0, 5, 5, 4, 5,
+	0, 5, 3, 5, 0, 5, 5, 4, 5, 5, 3, 5, 5, 5, 4, 5,
+	5, 3, 5, 0, 4, 4, 0, 8, 3, 3, 8, 8, 8, 4, 4, 4,
+	0, 8, 3, 3, 3, 8, 4, 4, 0, 8, 3, 3, 8, 8, 0, 8,
+	4, 4, 4, 0, 8, 3, 3, 8, 3, 5, 5, 4, 0, 5, 5, 3,
+	5, 5, 5, 4, 0, 5, 5, 3, 5, 0, 4, 5, 4, 4, 10, 0,
+	3, 3, 3, 4, 4, 8, 8, 0, 3, 8, 3, 8, 8, 5, 5, 4,
+	4, 5, 0, 5, 0, 3, 3, 4, 0, 4, 2, 8, 0, 3, 0, 3,
+	4, 4, 4, 2, 8, 3, 10, 3, 8, 3, 5, 5, 4, 4, 0, 5,
+	5, 0, 3, 3, 4, 5, 4, 0, 4, 10, 0, 3, 3, 3, 5, 5,
+	4, 4, 4, 2, 8, 3, 8, 3, 3, 4, 0, 4, 2, 3, 8, 8,
+	0, 5, 3, 4, 0, 4, 2, 3, 8, 3, 4, 4, 4, 8, 2, 3,
+	2, 3, 8, 3, 4, 4, 4, 7, 0, 3, 8, 3, 8, 3, 5, 5,
+	4, 5, 4, 0, 5, 0, 3, 3, 4, 5, 4, 7, 0, 5, 3, 0,
+	3, 5, 5, 4, 5, 0, 4, 0, 5, 0, 3, 3, 4, 5, 4, 2,
+	8, 0, 3, 8, 3, 4, 0, 4, 10, 3, 8, 3, 4, 0, 4, 10,
+	8, 0, 3, 0, 3, 4, 0, 4, 10, 0, 8, 3, 8, 3, 4, 5,
+	4, 4, 2, 7, 3, 5, 3, 0, 3, 4, 0, 4, 10, 0, 8, 8,
+	0, 3, 0, 3, 8, 4, 4, 4, 4, 7, 3, 0, 3, 3, 3, 4,
+	5, 4, 2, 5, 5, 3, 0, 3, 4, 5, 4, 2, 5, 5, 0, 3,
+	0, 3, 5, 5, 4, 4, 10, 0, 8, 3, 3, 4, 4, 8, 8, 0,
+	3, 8, 3, 8, 8, 0, 5, 5, 4, 4, 7, 0, 5, 0, 3, 3,
+	5, 5, 4, 4, 7, 5, 0, 3, 3, 4, 4, 4, 2, 8, 3, 10,
+	3, 3, 8, 5, 5, 4, 4, 2, 5, 5, 0, 3, 3, 5, 5, 4,
+	0, 4, 10, 0, 8, 3, 3, 5, 4, 4, 7, 4, 2, 3, 10, 8,
+	3, 3, 4, 0, 4, 2, 3, 3, 8, 8, 0, 5, 4, 0, 4, 2,
+	3, 3, 8, 4, 4, 4, 8, 2, 3, 2, 3, 3, 8, 4, 4, 4,
+	7, 0, 3, 8, 3, 3, 8, 5, 5, 4, 5, 4, 2, 5, 0, 3,
+	3, 5, 5, 4, 5, 4, 7, 0, 3, 3, 5, 5, 4, 5, 4, 4,
+	7, 3, 0, 3, 3, 4, 5, 4, 2, 8, 0, 3, 3, 8, 4, 0,
+	8, 0, 3, 0, 8, 8, 4, 4, 0, 8, 0, 3, 0, 3, 4, 0,
+	4, 10, 0, 8, 3, 3, 8, 5, 5, 4, 4, 4, 7, 3, 5, 0,
+	3, 3, 4, 0, 4, 8, 8, 4, 2, 10, 3, 3, 3, 8, 4, 4,
+	0, 4, 2, 5, 0, 3, 3, 3, 4, 5, 4, 2, 8, 8, 3, 3,
+	8, 4, 5, 4, 2, 5, 5, 0, 3, 0, 3, 0, 5, 5, 4, 4,
+	4, 10, 3, 8, 3, 3, 5, 5, 4, 4, 4, 0, 10, 3, 8, 3,
+	3, 5, 0, 5, 5, 4, 5, 0, 5, 3, 5, 0, 5, 5, 4, 5,
+	5, 3, 4, 4, 4, 2, 8, 3, 3, 3, 8, 8, 5, 0, 5, 5,
+	4, 0, 5, 5, 3, 5, 5, 4, 4, 4, 10, 3, 10, 3, 3, 5,
+	5, 4, 4, 4, 2, 10, 3, 8, 3, 3, 5, 0, 5, 5, 4, 5,
+	0, 5, 3, 0, 5, 0, 5, 5, 4, 5, 5, 3, 0, 4, 4, 4,
+	2, 8, 3, 3, 3, 8, 8, 0, 5, 0, 5, 5, 4, 0, 5, 5,
+	3, 0, 5, 0, 5, 5, 5, 4, 0, 5, 3, 5, 0, 5, 5, 5,
+	0, 5, 5, 0, 5, 5, 5, 4, 0, 5, 3, 0, 5, 0, 5, 5,
+	5, 0, 5, 0, 4, 0, 3, 8, 8, 4, 0, 3, 8, 8, 0, 4,
+	4, 8, 0, 3, 0, 3, 8, 8, 5, 0, 5, 5, 4, 0, 5, 3,
+	5, 4, 4, 8, 0, 3, 0, 3, 8, 8, 0, 5, 0, 5, 5, 4,
+	0, 5, 3, 5, 0, 5, 0, 5, 5, 0, 5, 5, 5, 0, 5, 5,
+	0, 5, 5, 0, 8, 4, 8, 0, 8, 8, 3, 5, 8, 0, 8, 8,
+	0, 8, 0, 5, 8, 4, 8, 4, 8, 0, 3, 8, 3, 5, 4, 5,
+	5, 4, 2, 5, 0, 3, 0, 3, 8, 0, 8, 8, 8, 0, 5, 4,
+	5, 5, 4, 7, 0, 3, 0, 3, 8, 4, 8, 0, 8, 8, 3, 5,
+	0, 8, 0, 8, 8, 0, 8, 0, 5, 0, 8, 8, 4, 4, 8, 0,
+	8, 3, 5, 3, 8, 4, 8, 4, 8, 0, 8, 3, 5, 3, 8, 0,
+	8, 8, 8, 0, 5, 0, 8, 4, 8, 0, 8, 8, 0, 5, 3, 8,
+	8, 8, 4, 4, 8, 0, 5, 0, 3, 3, 5, 4, 0, 5, 3, 5,
+	5, 0, 5, 8, 8, 4, 8, 4, 8, 0, 5, 0, 3, 3, 5, 4,
+	0, 5, 3, 5, 5, 0, 5, 0, 4, 4, 0, 3, 0, 3, 8, 8,
+	4, 4, 0, 3, 0, 3, 8, 8, 0, 8, 0, 8, 8, 8, 4, 8,
+	0, 3, 8, 8, 0, 8, 8, 0, 8, 4, 8, 0, 8, 3, 8, 8,
+	4, 4, 8, 0, 3, 3, 8, 4, 8, 4, 8, 0, 3, 3, 4, 8,
+	0, 8, 3, 8, 8, 4, 8, 4, 8, 0, 3, 3, 8, 8, 4, 8,
+	0, 8, 8, 0, 3, 0, 8, 8, 4, 4, 8, 0, 8, 3, 3, 8,
+	4, 5, 4, 4, 7, 3, 5, 3, 0, 3, 4, 5, 4, 4, 7, 3,
+	5, 0, 3, 0, 3, 4, 8, 0, 8, 3, 8, 8, 0, 4, 8, 4,
+	8, 0, 3, 3, 8, 8, 0, 4, 8, 8, 4, 2, 8, 3, 8, 3,
+	8, 4, 4, 8, 0, 8, 3, 8, 3, 4, 5, 0, 4, 2, 8, 8,
+	3, 3, 8, 8, 4, 4, 8, 4, 8, 0, 3, 3, 8, 3, 4, 4,
+	0, 8, 0, 3, 0, 3, 8, 8, 5, 4, 4, 7, 3, 5, 0, 5,
+	3, 5, 4, 4, 0, 8, 0, 3, 0, 3, 8, 8, 0, 5, 4, 4,
+	7, 3, 5, 0, 5, 3, 5, 0, 4, 0, 4, 2, 3, 8, 8, 3,
+	5, 4, 0, 4, 2, 3, 8, 8, 3, 5, 0, 4, 4, 0, 3, 8,
+	3, 8, 8, 4, 5, 0, 5, 5, 4, 2, 3, 0, 3, 4, 4, 0,
+	3, 8, 3, 8, 8, 0, 8, 4, 4, 5, 0, 5, 5, 3, 0, 3,
+	5, 4, 4, 2, 5, 3, 5, 5, 3, 5, 5, 4, 4, 2, 5, 3,
+	5, 5, 3, 5, 0, 4, 8, 0, 8, 8, 3, 8, 8, 4, 5, 4,
+	4, 2, 7, 3, 3, 0, 3, 4, 8, 0, 8, 8, 0, 3, 8, 8,
+	4, 5, 4, 4, 2, 7, 2, 3, 3, 3, 4, 5, 4, 2, 5, 3,
+	0, 3, 4, 5, 4, 4, 7, 2, 3, 3, 3, 0, 4, 8, 0, 5,
+	5, 4, 2, 3, 0, 3, 4, 5, 4, 2, 4, 2, 5, 3, 3, 3,
+	0, 8, 8, 4, 0, 5, 5, 0, 3, 0, 0, 4, 0, 8, 8, 3,
+	5, 5, 0, 4, 5, 4, 2, 5, 0, 3, 0, 3, 8, 4, 4, 5,
+	4, 0, 7, 3, 3, 3, 4, 4, 4, 8, 2, 3, 2, 8, 3, 8,
+	3, 4, 4, 4, 7, 3, 5, 0, 5, 3, 0, 3, 5, 4, 4, 2,
+	5, 5, 3, 5, 0, 5, 3, 5, 4, 4, 2, 5, 5, 3, 5, 5,
+	3, 4, 0, 4, 2, 8, 3, 8, 3, 4, 0, 4, 2, 8, 8, 0,
+	3, 0, 3, 4, 5, 4, 7, 3, 0, 3, 4, 5, 4, 7, 4, 2,
+	3, 3, 3, 4, 5, 4, 7, 0, 3, 0, 3, 8, 4, 4, 5, 4,
+	7, 3, 3, 3, 4, 5, 4, 7, 0, 4, 2, 3, 3, 3, 8, 4,
+	4, 5, 4, 7, 0, 3, 3, 3, 4, 8, 0, 8, 8, 3, 8, 8,
+	0, 4, 5, 4, 4, 0, 7, 3, 3, 0, 3, 4, 8, 0, 8, 8,
+	0, 3, 8, 8, 0, 4, 5, 4, 4, 0, 7, 2, 3, 3, 3, 4,
+	5, 4, 2, 5, 3, 0, 3, 0, 4, 5, 4, 4, 7, 2, 3, 3,
+	3, 4, 8, 0, 8, 8, 4, 10, 3, 8, 3, 4, 5, 4, 2, 4,
+	0, 7, 3, 3, 3, 0, 8, 8, 4, 0, 5, 5, 0, 3, 0, 4,
+	0, 8, 8, 3, 5, 5, 4, 0, 4, 2, 8, 0, 3, 3, 8, 8,
+	4, 4, 5, 4, 2, 5, 3, 3, 3, 4, 8, 0, 8, 8, 4, 10,
+	0, 3, 8, 3, 5, 4, 4, 7, 3, 5, 4, 7, 0, 3, 3, 4,
+	8, 8, 4, 2, 8, 8, 0, 3, 8, 3, 5, 4, 4, 2, 5, 5,
+	3, 5, 5, 3, 0, 4, 0, 4, 2, 8, 3, 3, 8, 8, 4, 4,
+	0, 4, 2, 8, 3, 3, 3, 4, 5, 4, 7, 3, 0, 3, 0, 4,
+	0, 4, 10, 8, 0, 3, 3, 8, 4, 5, 4, 7, 0, 3, 0, 3,
+	0, 8, 4, 4, 5, 0, 5, 3, 0, 3, 4, 5, 4, 7, 0, 5,
+	0, 3, 3, 8, 8, 4, 4, 5, 4, 5, 2, 3, 3, 3, 4, 0,
+	4, 8, 0, 8, 3, 3, 8, 8, 4, 5, 4, 4, 0, 7, 3, 0,
+	3, 0, 3, 5, 4, 5, 4, 7, 3, 5, 0, 5, 3, 5, 4, 5,
+	4, 7, 3, 5, 5, 3, 4, 5, 4, 4, 7, 3, 0, 3, 0, 3,
+	5, 4, 5, 4, 2, 5, 3, 5, 5, 3, 4, 0, 4, 8, 0, 8,
+	3, 3, 8, 8, 0, 5, 5, 4, 4, 4, 7, 2, 3, 0, 3, 3,
+	5, 4, 5, 4, 7, 3, 5, 0, 5, 3, 0, 5, 4, 5, 4, 7,
+	3, 5, 5, 3, 0, 4, 5, 4, 4, 10, 10, 3, 3, 3, 8, 5,
+	4, 5, 4, 2, 5, 3, 5, 5, 3, 0, 5, 4, 5, 5, 3, 5,
+	4, 0, 5, 3, 5, 4, 5, 5, 3, 5, 0, 5, 5, 4, 5, 5,
+	3, 5, 4, 0, 5, 3, 0, 5, 4, 5, 5, 3, 5, 0, 5, 0,
+	5, 4, 5, 5, 3, 5, 5, 5, 4, 5, 5, 3, 5, 5, 0, 4,
+	0, 8, 0, 3, 8, 8, 8, 4, 4, 0, 8, 0, 3, 3, 8, 4,
+	0, 8, 0, 3, 8, 8, 0, 8, 4, 4, 0, 8, 0, 3, 8, 3,
+	5, 4, 5, 0, 5, 3, 5, 5, 5, 4, 5, 0, 5, 3, 5, 5,
+	0, 4, 4, 8, 0, 3, 0, 8, 3, 8, 8, 4, 0, 5, 5, 4,
+	2, 5, 3, 0, 3, 5, 0, 5, 5, 4, 0, 4, 0, 5, 0, 3,
+	3, 4, 0, 5, 5, 4, 2, 5, 0, 3, 0, 3, 4, 0, 5, 5,
+	4, 7, 3, 0, 3, 4, 0, 5, 5, 4, 7, 0, 3, 0, 3, 4,
+	4, 8, 0, 3, 0, 8, 3, 8, 8, 0, 5, 0, 5, 5, 4, 4,
+	7, 0, 3, 3, 5, 0, 5, 5, 4, 4, 4, 7, 3, 0, 3, 3,
+	4, 0, 5, 0, 4, 2, 8, 0, 3, 3, 8, 4, 0, 5, 5, 4,
+	7, 3, 0, 3, 0, 4, 0, 5, 5, 4, 7, 0, 3, 0, 3, 0,
+	5, 4, 0, 5, 5, 3, 5, 4, 0, 5, 3, 5, 4, 0, 5, 5,
+	3, 5, 0, 5, 5, 4, 0, 5, 5, 3, 5, 4, 0, 5, 3, 0,
+	5, 4, 0, 5, 5, 3, 5, 0, 5, 0, 5, 4, 0, 5, 5, 3,
+	5, 5, 5, 4, 0, 5, 5, 3, 5, 5, 0, 4, 0, 8, 3, 8,
+	8, 4, 0, 8, 8, 0, 3, 0, 8, 4, 0, 8, 3, 8, 8, 0,
+	8, 4, 4, 0, 8, 3, 8, 3, 4, 0, 8, 8, 4, 10, 0, 3,
+	0, 3, 8, 4, 4, 0, 8, 8, 0, 3, 0, 3, 8, 0, 8, 0,
+	8, 8, 4, 8, 8, 0, 3, 8, 8, 4, 5, 5, 4, 2, 3, 0,
+	3, 8, 4, 8, 0, 8, 0, 3, 8, 4, 8, 8, 4, 10, 0, 3,
+	3, 8, 8, 4, 4, 8, 8, 0, 3, 3, 8, 8, 0, 8, 0, 8,
+	8, 0, 4, 8, 8, 0, 3, 8, 8, 0, 8, 8, 4, 0, 8, 0,
+	8, 3, 8, 4, 4, 5, 5, 3, 0, 3, 4, 8, 8, 4, 10, 0,
+	3, 8, 3, 8, 4, 4, 8, 8, 0, 3, 8, 3, 4, 5, 5, 0,
+	4, 2, 3, 0, 3, 8, 4, 4, 5, 5, 0, 3, 0, 3, 0, 4,
+	5, 5, 0, 4, 2, 3, 0, 3, 0, 8, 4, 4, 5, 5, 0, 3,
+	0, 3, 5, 4, 4, 7, 5, 3, 5, 3, 5, 5, 4, 4, 7, 5,
+	3, 5, 3, 5, 0, 4, 4, 0, 3, 0, 8, 3, 8, 8, 4, 4,
+	0, 3, 0, 8, 8, 0, 3, 0, 8, 4, 4, 0, 3, 0, 8, 3,
+	8, 8, 0, 4, 8, 4, 8, 8, 4, 10, 0, 3, 3, 3, 5, 4,
+	4, 2, 5, 5, 3, 5, 3, 5, 5, 4, 4, 2, 5, 5, 3, 5,
+	3, 5, 0, 0, 5, 0, 4, 0, 3, 4, 8, 8, 0, 8, 3, 8,
+	8, 4, 5, 4, 7, 0, 3, 8, 3, 4, 8, 8, 0, 8, 0, 3,
+	8, 8, 4, 4, 4, 0, 7, 3, 5, 3, 0, 3, 4, 8, 4, 8,
+	8, 0, 3, 3, 8, 8, 4, 5, 4, 2, 3, 0, 3, 4, 5, 4,
+	7, 4, 2, 8, 3, 3, 3, 8, 8, 4, 5, 0, 5, 0, 3, 0,
+	8, 4, 0, 5, 0, 3, 0, 4, 4, 4, 10, 0, 3, 10, 3, 5,
+	3, 5, 4, 4, 7, 0, 5, 5, 3, 5, 3, 4, 5, 4, 2, 4,
+	2, 3, 3, 3, 4, 4, 4, 2, 8, 3, 7, 0, 3, 0, 3, 4,
+	8, 8, 4, 10, 8, 0, 3, 3, 8, 5, 4, 4, 2, 8, 8, 3,
+	5, 3, 4, 4, 4, 10, 3, 10, 3, 5, 3, 8, 4, 4, 8, 0,
+	5, 0, 3, 0, 3, 0, 4, 4, 4, 7, 3, 5, 3, 0, 3, 4,
+	0, 4, 2, 8, 8, 0, 3, 8, 3, 4, 4, 4, 7, 3, 5, 0,
+	3, 0, 3, 4, 4, 4, 8, 0, 7, 3, 5, 3, 0, 3, 4, 4,
+	4, 2, 10, 3, 8, 3, 5, 3, 4, 4, 4, 0, 10, 10, 3, 5,
+	0, 3, 0, 3, 0, 5, 0, 4, 0, 3, 0, 4, 8, 8, 0, 8,
+	3, 8, 8, 0, 4, 5, 5, 4, 2, 3, 8, 3, 4, 8, 8, 0,
+	8, 0, 3, 8, 8, 0, 4, 4, 4, 0, 7, 3, 5, 3, 0, 3,
+	0, 4, 8, 4, 8, 8, 0, 3, 3, 8, 8, 0, 4, 5, 4, 2,
+	3, 0, 3, 0, 4, 5, 4, 5, 4, 2, 10, 3, 3, 3, 8, 8,
+	4, 5, 0, 5, 0, 3, 8, 4, 0, 5, 0, 3, 4, 8, 8, 4,
+	10, 0, 8, 3, 8, 3, 8, 4, 4, 8, 8, 0, 8, 3, 8, 3,
+	4, 5, 5, 0, 4, 2, 3, 8, 3, 5, 4, 4, 7, 4, 7, 3,
+	5, 0, 3, 3, 4, 8, 8, 4, 10, 8, 0, 3, 8, 3, 8, 4,
+	4, 5, 4, 2, 3, 3, 3, 4, 4, 10, 0, 3, 0, 8, 3, 5,
+	8, 4, 4, 8, 0, 5, 0, 3, 0, 3, 4, 0, 4, 2, 8, 8,
+	3, 3, 8, 4, 0, 4, 2, 8, 8, 0, 3, 3, 8, 4, 4, 4,
+	7, 3, 5, 0, 3, 0, 3, 0, 8, 4, 4, 4, 0, 5, 3, 5,
+	3, 0, 3, 4, 4, 4, 0, 10, 3, 3, 8, 3, 5, 8, 4, 4,
+	0, 4, 2, 8, 8, 0, 3, 3, 3, 4, 5, 0, 4, 2, 3, 0,
+	3, 4, 5, 5, 4, 4, 0, 10, 3, 3, 3, 4, 5, 5, 4, 2,
+	8, 0, 3, 0, 3, 8, 4, 4, 5, 0, 3, 0, 3, 0, 4, 5,
+	5, 4, 2, 4, 2, 8, 3, 3, 3, 5, 4, 5, 4, 2, 5, 5,
+	3, 5, 3, 4, 5, 0, 4, 2, 3, 0, 3, 0, 4, 5, 5, 4,
+	4, 2, 10, 3, 3, 3, 8, 8, 4, 5, 4, 5, 0, 3, 0, 3,
+	8, 4, 4, 5, 0, 3, 0, 3, 4, 5, 5, 4, 0, 4, 2, 10,
+	3, 3, 3, 5, 4, 5, 4, 2, 5, 5, 3, 5, 3, 0, 8, 8,
+	8, 4, 4, 5, 0, 5, 3, 3, 5, 4, 5, 5, 0, 5, 3, 5,
+	8, 8, 4, 8, 4, 5, 0, 5, 3, 3, 5, 4, 5, 5, 0, 5,
+	3, 5, 0, 0, 8, 0, 8, 0, 5, 0, 8, 0, 8, 0, 5, 0,
+	4, 0, 4, 0, 8, 3, 3, 8, 8, 5, 4, 5, 4, 0, 5, 3,
+	5, 3, 5, 4, 0, 4, 0, 8, 3, 3, 8, 8, 0, 5, 4, 5,
+	4, 0, 5, 3, 5, 3, 5, 0, 5, 4, 5, 0, 5, 5, 3, 5,
+	5, 4, 5, 0, 5, 5, 3, 5, 0, 4, 0, 8, 0, 8, 3, 8,
+	8, 4, 8, 4, 0, 8, 0, 3, 3, 8, 8, 4, 0, 8, 0, 8,
+	8, 0, 3, 0, 8, 5, 4, 0, 4, 2, 8, 8, 3, 5, 3, 4,
+	4, 5, 4, 7, 3, 5, 3, 0, 3, 4, 4, 5, 4, 7, 3, 5,
+	0, 3, 0, 3, 4, 0, 8, 0, 8, 3, 8, 8, 0, 4, 8, 4,
+	0, 8, 0, 3, 3, 8, 8, 0, 4, 0, 8, 8, 4, 2, 8, 3,
+	8, 3, 8, 4, 4, 5, 0, 4, 2, 3, 3, 3, 4, 4, 2, 8,
+	0, 3, 0, 8, 3, 5, 4, 4, 5, 4, 7, 3, 5, 0, 3, 0,
+	3, 0, 5, 4, 0, 5, 5, 4, 2, 5, 3, 5, 3, 5, 4, 0,
+	5, 5, 0, 5, 3, 5, 5, 4, 0, 5, 5, 4, 2, 5, 3, 5,
+	3, 0, 5, 4, 0, 5, 5, 0, 5, 3, 5, 0, 4, 4, 2, 3,
+	8, 8, 3, 5, 4, 4, 2, 3, 8, 8, 3, 5, 0, 0, 4, 8,
+	0, 8, 8, 3, 5, 4, 4, 10, 8, 0, 3, 0, 8, 3, 5, 0,
+	4, 8, 0, 8, 8, 3, 5, 0, 8, 4, 0, 4, 8, 0, 8, 3,
+	5, 3, 5, 4, 4, 0, 5, 3, 5, 5, 3, 5, 5, 4, 4, 0,
+	5, 3, 5, 5, 3, 5, 0, 4, 0, 8, 8, 3, 8, 8, 4, 0,
+	8, 8, 0, 3, 8, 8, 4, 0, 5, 5, 4, 2, 3, 0, 3, 8,
+	4, 4, 0, 8, 8, 3, 3, 8, 4, 0, 8, 8, 4, 10, 0, 3,
+	3, 8, 8, 4, 4, 0, 8, 8, 0, 3, 3, 8, 4, 0, 8, 8,
+	3, 8, 8, 0, 4, 0, 8, 8, 0, 3, 8, 8, 0, 4, 0, 8,
+	8, 4, 10, 3, 8, 3, 8, 4, 4, 0, 5, 5, 3, 0, 3, 4,
+	0, 8, 8, 4, 10, 0, 3, 8, 3, 8, 4, 4, 0, 8, 8, 0,
+	3, 8, 3, 4, 0, 5, 5, 0, 4, 2, 3, 0, 3, 5, 4, 4,
+	5, 0, 5, 3, 5, 3, 5, 4, 0, 5, 5, 0, 4, 2, 3, 0,
+	3, 0, 8, 4, 4, 0, 5, 5, 0, 3, 0, 3, 5, 4, 4, 5,
+	5, 3, 5, 3, 5, 5, 4, 4, 5, 5, 3, 5, 3, 5, 0, 4,
+	4, 2, 8, 3, 8, 8, 3, 5, 4, 4, 2, 8, 8, 0, 3, 0,
+	8, 3, 5, 4, 4, 2, 8, 3, 8, 8, 3, 5, 0, 8, 4, 4,
+	4, 2, 8, 3, 8, 3, 5, 3, 5, 4, 4, 0, 5, 5, 3, 5,
+	3, 5, 5, 4, 4, 0, 5, 5, 3, 5, 3, 5, 0, 0, 4, 0,
+	4, 0, 3, 3, 4, 8, 8, 0, 8, 3, 8, 8, 8, 5, 4, 4,
+	4, 0, 8, 3, 3, 3, 4, 4, 4, 10, 0, 3, 0, 3, 3, 4,
+	4, 4, 2, 7, 1, 3, 0, 3, 3, 4, 4, 4, 4, 0, 10, 3,
+	3, 3, 3, 5, 4, 4, 0, 8, 0, 3, 3, 4, 4, 4, 0, 4,
+	10, 0, 3, 3, 3, 3, 0, 4, 0, 8, 8, 0, 5, 0, 3, 0,
+	4, 0, 8, 0, 3, 4, 4, 4, 10, 0, 3, 8, 3, 3, 5, 4,
+	4, 5, 0, 5, 5, 3, 3, 5, 4, 4, 0, 4, 0, 8, 3, 3,
+	3, 4, 4, 4, 0, 10, 0, 3, 0, 3, 3, 5, 4, 4, 0, 5,
+	5, 0, 5, 3, 3, 5, 4, 4, 0, 8, 8, 3, 3, 4, 4, 4,
+	10, 3, 8, 3, 3, 4, 4, 4, 10, 8, 0, 3, 0, 3, 3, 4,
+	4, 4, 5, 9, 3, 0, 3, 3, 4, 4, 4, 10, 8, 0, 3, 8,
+	3, 3, 4, 4, 4, 7, 2, 3, 2, 3, 3, 4, 4, 4, 10, 0,
+	5, 3, 0, 3, 3, 4, 4, 4, 0, 10, 3, 8, 3, 3, 4, 4,
+	4, 0, 10, 8, 0, 3, 0, 3, 3, 0, 4, 0, 4, 0, 3, 0,
+	3, 4, 8, 8, 0, 8, 3, 8, 8, 0, 8, 5, 4, 4, 4, 2,
+	8, 3, 3, 3, 4, 4, 4, 10, 0, 3, 0, 3, 0, 3, 4, 4,
+	2, 4, 2, 5, 3, 0, 3, 3, 4, 4, 4, 4, 2, 10, 3, 3,
+	3, 3, 5, 4, 4, 0, 8, 0, 3, 0, 3, 5, 4, 5, 5, 4,
+	0, 5, 5, 0, 3, 3, 0, 4, 0, 8, 8, 0, 5, 3, 0, 4,
+	0, 8, 3, 4, 4, 4, 10, 0, 3, 3, 8, 3, 4, 5, 5, 3,
+	5, 5, 0, 5, 5, 0, 5, 4, 4, 0, 4, 2, 8, 3, 3, 3,
+	5, 4, 4, 5, 4, 5, 2, 3, 3, 3, 4, 5, 5, 3, 5, 0,
+	5, 5, 0, 5, 0, 5, 4, 4, 0, 8, 3, 8, 3, 4, 4, 10,
+	0, 3, 0, 8, 3, 4, 4, 8, 4, 10, 0, 3, 0, 3, 3, 4,
+	4, 4, 10, 8, 3, 3, 8, 3, 4, 4, 4, 10, 8, 0, 3, 3,
+	8, 3, 4, 4, 4, 7, 2, 3, 2, 3, 0, 3, 4, 4, 10, 4,
+	2, 5, 3, 0, 3, 3, 4, 4, 4, 0, 10, 3, 3, 8, 3, 4,
+	4, 8, 4, 4, 0, 10, 3, 3, 3, 3, 4, 4, 2, 4, 2, 3,
+	0, 3, 3, 4, 4, 5, 4, 4, 0, 10, 3, 3, 3, 3, 5, 4,
+	5, 4, 5, 0, 5, 3, 3, 4, 4, 2, 3, 0, 8, 0, 3, 4,
+	4, 0, 4, 10, 0, 3, 8, 3, 3, 5, 4, 5, 4, 0, 5, 5,
+	3, 3, 4, 4, 2, 4, 2, 3, 0, 3, 0, 3, 4, 4, 5, 4,
+	4, 2, 10, 3, 3, 3, 3, 5, 4, 5, 4, 5, 0, 5, 3, 0,
+	3, 4, 4, 2, 3, 0, 8, 3, 4, 4, 0, 4, 10, 0, 3, 3,
+	8, 3, 5, 4, 5, 4, 0, 5, 5, 3, 0, 3, 8, 4, 0, 8,
+	0, 8, 3, 5, 0, 5, 4, 5, 5, 0, 5, 3, 0, 8, 8, 4,
+	8, 0, 5, 0, 3, 0, 5, 4, 5, 5, 0, 5, 0, 3, 0, 8,
+	0, 8, 0, 0, 4, 8, 8, 0, 3, 4, 4, 10, 0, 3, 8, 8,
+	3, 5, 4, 5, 4, 0, 5, 3, 5, 3, 4, 4, 10, 0, 3, 8,
+	8, 0, 3, 5, 4, 5, 4, 0, 5, 3, 5, 0, 3, 5, 4, 5,
+	0, 5, 5, 3, 5, 4, 5, 0, 5, 5, 0, 3, 4, 4, 10, 0,
+	8, 3, 8, 8, 3, 4, 4, 7, 4, 2, 5, 3, 0, 3, 3, 5,
+	4, 0, 4, 0, 5, 5, 0, 5, 3, 3, 4, 4, 2, 4, 2, 3,
+	8, 3, 3, 4, 4, 7, 4, 7, 3, 2, 3, 3, 4, 4, 7, 4,
+	5, 2, 3, 0, 3, 3, 4, 4, 10, 0, 8, 3, 8, 8, 0, 3,
+	5, 4, 5, 4, 4, 5, 2, 3, 3, 3, 4, 4, 10, 8, 4, 2,
+	8, 3, 8, 3, 3, 4, 4, 2, 4, 2, 3, 3, 8, 3, 4, 4,
+	2, 8, 0, 3, 0, 8, 3, 4, 4, 7, 4, 5, 2, 3, 0, 3,
+	0, 3, 5, 4, 0, 5, 5, 4, 0, 5, 3, 3, 5, 4, 0, 5,
+	5, 0, 5, 3, 5, 4, 0, 5, 5, 4, 0, 5, 3, 0, 3, 5,
+	4, 0, 5, 5, 0, 5, 0, 3, 4, 4, 2, 3, 8, 8, 3, 4,
+	4, 2, 3, 8, 8, 0, 3, 0, 4, 8, 0, 8, 8, 3, 4, 4,
+	10, 8, 0, 3, 0, 8, 3, 0, 4, 8, 0, 8, 8, 0, 3, 0,
+	4, 8, 4, 8, 0, 8, 3, 3, 5, 4, 4, 0, 5, 3, 5, 5,
+	3, 5, 4, 4, 0, 5, 3, 5, 5, 0, 3, 4, 4, 7, 5, 3,
+	0, 8, 3, 4, 4, 10, 8, 0, 3, 8, 8, 3, 4, 4, 7, 4,
+	2, 3, 0, 3, 3, 8, 4, 4, 4, 7, 3, 0, 3, 0, 3, 4,
+	4, 2, 4, 2, 8, 3, 8, 3, 3, 5, 4, 4, 4, 2, 8, 8,
+	3, 5, 3, 3, 4, 4, 7, 5, 3, 0, 8, 0, 3, 4, 4, 10,
+	8, 0, 3, 8, 8, 0, 3, 4, 4, 7, 4, 2, 3, 0, 3, 0,
+	3, 8, 4, 4, 4, 7, 3, 0, 3, 3, 4, 4, 2, 4, 2, 8,
+	3, 3, 8, 3, 8, 4, 4, 4, 7, 4, 2, 3, 3, 3, 3, 4,
+	4, 2, 8, 0, 3, 8, 8, 3, 5, 4, 4, 5, 0, 5, 3, 5,
+	3, 4, 4, 2, 8, 0, 3, 8, 8, 0, 3, 5, 4, 4, 5, 0,
+	5, 3, 5, 0, 3, 5, 4, 4, 5, 5, 3, 5, 3, 5, 4, 4,
+	5, 5, 3, 5, 0, 3, 4, 4, 2, 8, 3, 8, 8, 3, 4, 4,
+	2, 8, 8, 0, 3, 0, 8, 3, 4, 4, 2, 8, 3, 8, 8, 0,
+	3, 4, 4, 10, 4, 2, 8, 3, 8, 3, 3, 5, 4, 4, 0, 5,
+	5, 3, 5, 3, 5, 4, 4, 0, 5, 5, 3, 5, 0, 3, 5, 4,
+	4, 10, 0, 3, 3, 4, 8, 8, 0, 8, 3, 8, 8, 8, 0, 4,
+	4, 4, 7, 2, 3, 8, 3, 3, 4, 4, 4, 10, 0, 3, 2, 3,
+	3, 4, 4, 4, 0, 7, 1, 3, 0, 3, 3, 4, 4, 4, 4, 0,
+	10, 3, 3, 3, 3, 0, 5, 4, 4, 2, 8, 0, 3, 3, 4, 4,
+	4, 2, 4, 10, 0, 3, 3, 3, 3, 5, 4, 4, 7, 5, 0, 5,
+	3, 3, 0, 4, 0, 8, 0, 3, 0, 4, 4, 4, 10, 0, 3, 10,
+	3, 3, 5, 4, 4, 7, 0, 5, 5, 3, 3, 5, 4, 4, 2, 4,
+	0, 8, 3, 3, 3, 4, 4, 4, 2, 10, 0, 3, 0, 3, 3, 5,
+	4, 4, 2, 5, 5, 0, 5, 3, 3, 5, 4, 4, 2, 8, 8, 3,
+	3, 4, 4, 4, 10, 3, 10, 3, 3, 4, 4, 4, 10, 10, 2, 3,
+	0, 3, 3, 4, 4, 4, 7, 1, 3, 0, 3, 3, 4, 4, 4, 10,
+	10, 2, 3, 8, 3, 3, 4, 4, 4, 7, 2, 3, 0, 3, 3, 4,
+	4, 4, 10, 2, 7, 3, 0, 3, 3, 4, 4, 4, 2, 10, 3, 8,
+	3, 3, 4, 4, 4, 2, 10, 8, 0, 3, 0, 3, 3, 5, 4, 0,
+	4, 10, 0, 3, 3, 4, 8, 8, 0, 8, 3, 8, 8, 0, 8, 0,
+	4, 4, 7, 4, 2, 3, 10, 3, 3, 4, 4, 0, 4, 10, 0, 3,
+	2, 3, 3, 4, 4, 2, 4, 0, 7, 3, 0, 3, 3, 4, 4, 4,
+	4, 2, 10, 3, 3, 3, 3, 0, 5, 4, 4, 0, 8, 0, 3, 0,
+	3, 0, 5, 4, 5, 5, 4, 2, 5, 5, 0, 3, 3, 0, 4, 0,
+	3, 8, 8, 0, 5, 0, 4, 0, 3, 8, 4, 4, 4, 10, 0, 3,
+	3, 3, 8, 4, 5, 5, 3, 5, 5, 0, 5, 5, 5, 4, 4, 2,
+	4, 2, 10, 3, 3, 3, 5, 4, 4, 5, 4, 7, 0, 3, 3, 3,
+	4, 5, 5, 3, 5, 0, 5, 5, 0, 5, 5, 4, 4, 0, 8, 3,
+	3, 8, 4, 4, 10, 0, 3, 0, 3, 8, 4, 8, 4, 4, 10, 0,
+	3, 0, 3, 3, 4, 4, 4, 10, 8, 3, 3, 3, 8, 4, 4, 4,
+	10, 8, 0, 3, 3, 3, 8, 4, 4, 4, 0, 10, 0, 3, 3, 3,
+	8, 8, 4, 4, 4, 2, 5, 3, 0, 3, 3, 4, 4, 4, 0, 10,
+	3, 3, 3, 8, 4, 4, 4, 10, 4, 7, 0, 3, 3, 3, 3, 5,
+	4, 0, 4, 2, 8, 0, 3, 3, 5, 4, 5, 4, 4, 2, 10, 10,
+	3, 3, 3, 5, 4, 5, 4, 7, 0, 5, 3, 3, 5, 4, 0, 4,
+	10, 8, 3, 3, 4, 4, 0, 4, 10, 0, 3, 10, 3, 3, 5, 4,
+	5, 4, 2, 5, 5, 3, 3, 5, 4, 5, 4, 4, 10, 10, 3, 3,
+	3, 4, 4, 7, 4, 4, 7, 2, 3, 3, 3, 3, 5, 4, 5, 4,
+	5, 4, 7, 3, 3, 3, 4, 4, 2, 3, 0, 3, 8, 4, 4, 0,
+	4, 10, 0, 3, 3, 3, 8, 4, 4, 7, 4, 2, 8, 3, 3, 3,
+	8, 8, 4, 0, 8, 0, 8, 3, 5, 0, 8, 0, 8, 8, 0, 5,
+	0, 8, 8, 4, 8, 0, 5, 0, 3, 5, 4, 5, 5, 0, 5, 0,
+	3, 0, 0, 8, 0, 8, 8, 4, 0, 8, 0, 3, 4, 4, 10, 0,
+	3, 8, 3, 8, 5, 4, 5, 4, 0, 5, 3, 5, 3, 0, 4, 4,
+	10, 0, 3, 8, 8, 0, 3, 0, 4, 8, 4, 4, 10, 0, 3, 8,
+	3, 3, 5, 4, 5, 0, 5, 5, 3, 0, 5, 4, 5, 0, 5, 5,
+	0, 3, 0, 4, 4, 10, 0, 8, 3, 8, 3, 8, 4, 4, 7, 4,
+	0, 7, 3, 0, 3, 3, 5, 4, 4, 4, 7, 3, 5, 0, 5, 3,
+	3, 5, 4, 0, 4, 2, 8, 8, 3, 3, 4, 4, 7, 4, 7, 3,
+	0, 3, 3, 4, 4, 7, 4, 7, 0, 3, 0, 3, 3, 4, 4, 10,
+	0, 8, 3, 8, 8, 0, 3, 0, 5, 4, 5, 4, 4, 7, 0, 3,
+	3, 3, 4, 4, 8, 8, 4, 2, 10, 3, 8, 3, 3, 4, 4, 2,
+	4, 2, 3, 3, 3, 8, 4, 4, 2, 8, 0, 3, 0, 3, 8, 8,
+	4, 4, 4, 2, 8, 0, 3, 0, 3, 3, 5, 4, 0, 5, 5, 4,
+	2, 5, 3, 3, 5, 4, 0, 5, 5, 0, 5, 3, 0, 5, 4, 0,
+	5, 5, 4, 4, 7, 3, 3, 3, 5, 4, 0, 5, 5, 0, 5, 0,
+	3, 0, 4, 4, 2, 3, 8, 3, 8, 4, 4, 2, 3, 8, 8, 0,
+	3, 0, 0, 4, 8, 0, 8, 3, 8, 4, 4, 10, 8, 0, 3, 0,
+	3, 8, 0, 4, 8, 0, 8, 8, 0, 3, 0, 8, 4, 0, 4, 8,
+	0, 8, 3, 3, 5, 4, 4, 0, 5, 3, 5, 5, 3, 0, 5, 4,
+	4, 0, 5, 3, 5, 5, 0, 3, 0, 4, 4, 7, 5, 3, 0, 3,
+	8, 4, 4, 10, 8, 0, 3, 8, 3, 8, 4, 4, 7, 4, 2, 3,
+	2, 3, 3, 5, 4, 4, 4, 10, 10, 3, 5, 3, 3, 4, 4, 0,
+	4, 2, 10, 3, 8, 3, 3, 5, 4, 4, 4, 0, 10, 10, 3, 5,
+	3, 3, 4, 4, 7, 0, 5, 3, 0, 3, 8, 4, 4, 7, 5, 4,
+	2, 3, 10, 3, 3, 4, 4, 8, 8, 4, 10, 3, 10, 3, 3, 4,
+	4, 10, 4, 7, 3, 0, 3, 3, 4, 4, 2, 4, 2, 8, 3, 3,
+	3, 8, 4, 4, 10, 4, 7, 4, 2, 3, 3, 3, 3, 4, 4, 2,
+	8, 0, 3, 8, 3, 8, 5, 4, 4, 5, 0, 5, 3, 5, 3, 0,
+	4, 4, 2, 8, 0, 3, 8, 8, 0, 3, 0, 4, 4, 10, 4, 7,
+	0, 3, 0, 3, 3, 5, 4, 4, 5, 5, 3, 5, 3, 0, 5, 4,
+	4, 5, 5, 3, 5, 0, 3, 0, 4, 4, 2, 8, 3, 8, 3, 8,
+	4, 4, 2, 8, 8, 0, 3, 0, 3, 8, 4, 4, 2, 8, 3, 8,
+	8, 0, 3, 0, 8, 4, 4, 4, 2, 8, 3, 8, 3, 3, 5, 4,
+	4, 0, 5, 5, 3, 5, 3, 0, 5, 4, 4, 0, 5, 5, 3, 5,
+	0, 3, 0, 5, 4, 4, 10, 0, 3, 0, 3, 4, 4, 10, 8, 0,
+	8, 3, 3, 8, 8, 5, 4, 4, 4, 0, 10, 3, 3, 3, 4, 4,
+	4, 10, 0, 3, 2, 3, 0, 3, 5, 4, 4, 4, 10, 0, 5, 3,
+	3, 3, 5, 4, 4, 4, 0, 10, 8, 0, 3, 3, 3, 5, 4, 4,
+	2, 8, 0, 3, 0, 3, 5, 5, 4, 5, 4, 0, 5, 5, 0, 3,
+	3, 0, 5, 5, 4, 5, 5, 0, 5, 3, 0, 4, 0, 3, 0, 8,
+	0, 4, 4, 4, 10, 0, 3, 10, 3, 0, 3, 0, 5, 5, 4, 5,
+	0, 5, 5, 3, 5, 4, 4, 2, 4, 2, 8, 3, 3, 3, 5, 4,
+	4, 7, 4, 5, 2, 3, 3, 3, 0, 5, 5, 4, 0, 5, 5, 0,
+	5, 3, 5, 4, 4, 2, 8, 3, 8, 3, 4, 4, 4, 10, 3, 10,
+	3, 0, 3, 4, 4, 4, 10, 10, 2, 3, 0, 3, 0, 3, 4, 4,
+	2, 8, 8, 3, 3, 8, 8, 4, 4, 4, 10, 10, 2, 3, 3, 8,
+	3, 4, 4, 4, 7, 2, 3, 0, 3, 0, 3, 5, 4, 4, 4, 10,
+	3, 8, 3, 5, 3, 4, 4, 4, 2, 10, 3, 3, 8, 3, 8, 4,
+	4, 4, 4, 7, 2, 3, 3, 3, 3, 5, 4, 4, 10, 0, 3, 0,
+	3, 0, 4, 4, 10, 8, 0, 8, 3, 3, 8, 8, 0, 5, 4, 4,
+	4, 2, 10, 3, 3, 3, 5, 4, 4, 4, 10, 10, 2, 3, 3, 3,
+	5, 4, 4, 4, 10, 2, 7, 3, 3, 3, 5, 4, 4, 4, 2, 10,
+	8, 0, 3, 3, 3, 5, 4, 4, 2, 8, 0, 3, 0, 3, 0, 5,
+	5, 4, 5, 4, 2, 5, 5, 0, 3, 3, 0, 4, 0, 3, 0, 8,
+	8, 0, 5, 0, 4, 0, 3, 0, 8, 4, 4, 4, 10, 0, 3, 3,
+	3, 0, 8, 0, 5, 5, 4, 5, 0, 5, 5, 3, 0, 5, 4, 4,
+	0, 4, 2, 10, 3, 3, 3, 5, 4, 4, 7, 4, 7, 0, 3, 3,
+	3, 0, 5, 5, 4, 0, 5, 5, 0, 5, 3, 0, 5, 4, 4, 2,
+	8, 3, 3, 8, 4, 4, 10, 0, 3, 0, 3, 0, 8, 4, 8, 4,
+	4, 10, 0, 3, 0, 3, 0, 3, 4, 4, 2, 8, 8, 3, 3, 8,
+	8, 0, 4, 4, 4, 10, 10, 2, 3, 3, 3, 8, 4, 4, 4, 2,
+	10, 0, 3, 3, 3, 8, 5, 4, 4, 4, 10, 3, 8, 3, 5, 3,
+	0, 4, 4, 4, 2, 10, 3, 3, 3, 8, 4, 8, 4, 4, 4, 2,
+	10, 3, 3, 3, 3, 5, 4, 0, 4, 2, 8, 0, 3, 0, 3, 5,
+	5, 5, 4, 4, 0, 5, 5, 0, 3, 3, 0, 5, 5, 5, 4, 5,
+	0, 5, 3, 5, 4, 0, 4, 10, 3, 8, 3, 8, 4, 0, 8, 8,
+	8, 3, 5, 0, 5, 0, 5, 5, 5, 4, 0, 5, 5, 3, 5, 5,
+	5, 4, 4, 7, 5, 0, 3, 3, 5, 5, 5, 4, 4, 2, 5, 5,
+	0, 3, 3, 0, 5, 5, 5, 4, 5, 0, 5, 3, 0, 4, 4, 2,
+	3, 0, 3, 0, 8, 8, 4, 0, 8, 8, 8, 3, 5, 0, 5, 0,
+	0, 5, 5, 5, 4, 0, 5, 5, 3, 0, 0, 8, 8, 0, 8, 0,
+	5, 0, 8, 8, 8, 0, 5, 0, 8, 8, 0, 8, 0, 5, 0, 0,
+	8, 8, 8, 0, 5, 0, 0, 8, 8, 0, 8, 8, 0, 4, 4, 10,
+	0, 3, 3, 8, 8, 0, 5, 5, 5, 4, 0, 5, 3, 5, 4, 4,
+	10, 0, 3, 3, 8, 8, 0, 0, 5, 5, 5, 4, 0, 5, 3, 5,
+	0, 0, 5, 5, 5, 0, 5, 5, 0, 5, 5, 5, 0, 5, 5, 0,
+	4, 4, 10, 0, 8, 3, 3, 8, 8, 5, 4, 5, 4, 4, 7, 2,
+	3, 3, 3, 0, 0, 5, 5, 4, 4, 7, 3, 5, 0, 5, 3, 5,
+	4, 0, 4, 2, 8, 3, 8, 3, 4, 4, 7, 4, 7, 3, 0, 3,
+	0, 3, 4, 4, 7, 4, 7, 0, 3, 0, 3, 0, 3, 4, 4, 10,
+	0, 8, 3, 3, 8, 8, 0, 5, 4, 5, 4, 4, 7, 2, 3, 3,
+	3, 4, 4, 8, 8, 4, 2, 10, 3, 3, 8, 3, 5, 4, 0, 4,
+	2, 8, 3, 3, 8, 4, 4, 2, 8, 0, 3, 0, 3, 0, 8, 8,
+	4, 5, 4, 5, 4, 5, 2, 3, 3, 3, 0, 5, 5, 0, 5, 5,
+	4, 0, 5, 3, 0, 5, 5, 0, 5, 5, 0, 5, 0, 5, 5, 0,
+	5, 5, 4, 0, 5, 3, 0, 0, 5, 5, 0, 5, 5, 0, 5, 0,
+	4, 4, 2, 3, 3, 8, 8, 4, 4, 2, 3, 3, 8, 8, 0, 4,
+	8, 0, 3, 0, 8, 8, 8, 4, 4, 8, 0, 3, 0, 3, 8, 4,
+	8, 0, 3, 0, 8, 8, 0, 8, 4, 4, 8, 0, 3, 0, 8, 3,
+	0, 5, 5, 4, 0, 5, 3, 5, 5, 0, 5, 5, 4, 0, 5, 3,
+	5, 5, 0, 4, 4, 10, 8, 3, 3, 8, 8, 4, 4, 10, 8, 0,
+	3, 3, 8, 8, 4, 4, 7, 4, 2, 3, 2, 3, 0, 3, 5, 4,
+	4, 4, 10, 3, 10, 3, 5, 3, 4, 4, 0, 4, 2, 10, 3, 3,
+	8, 3, 5, 4, 4, 4, 2, 10, 3, 8, 3, 5, 3, 4, 4, 10,
+	8, 3, 3, 8, 8, 0, 4, 4, 10, 8, 0, 3, 3, 8, 8, 0,
+	4, 4, 7, 4, 0, 7, 3, 3, 3, 8, 4, 4, 10, 4, 7, 3,
+	0, 3, 0, 3, 4, 4, 0, 4, 2, 10, 3, 3, 3, 8, 4, 8,
+	4, 4, 10, 8, 0, 3, 3, 8, 3, 4, 4, 2, 8, 0, 3, 3,
+	8, 8, 0, 5, 5, 4, 5, 0, 5, 3, 5, 4, 4, 2, 8, 0,
+	3, 3, 8, 8, 0, 0, 5, 5, 4, 5, 0, 5, 3, 5, 0, 0,
+	5, 5, 4, 5, 5, 3, 5, 0, 5, 5, 4, 5, 5, 3, 5, 0,
+	4, 4, 2, 8, 3, 3, 8, 8, 8, 4, 4, 4, 2, 8, 3, 3,
+	3, 8, 4, 4, 2, 8, 3, 3, 8, 8, 0, 8, 4, 4, 4, 2,
+	8, 3, 3, 8, 3, 0, 5, 5, 4, 0, 5, 5, 3, 5, 0, 5,
+	5, 4, 0, 5, 5, 3, 5, 0, 4, 8, 0, 8, 0, 3, 8, 8,
+	8, 4, 4, 8, 8, 0, 3, 3, 8, 8, 8, 5, 5, 4, 4, 5,
+	0, 5, 3, 3, 5, 5, 4, 4, 5, 5, 3, 3, 8, 4, 5, 5,
+	3, 5, 4, 0, 5, 3, 5, 5, 4, 4, 0, 5, 5, 3, 3, 4,
+	8, 0, 8, 0, 3, 8, 8, 0, 8, 4, 5, 4, 4, 4, 2, 10,
+	3, 3, 3, 3, 5, 5, 4, 4, 5, 0, 5, 3, 0, 3, 4, 0,
+	4, 2, 3, 0, 8, 3, 8, 4, 5, 5, 3, 5, 4, 0, 5, 0,
+	3, 5, 5, 4, 4, 0, 5, 5, 3, 0, 3, 8, 4, 5, 5, 0,
+	5, 3, 5, 5, 5, 4, 5, 0, 5, 3, 5, 5, 4, 5, 4, 0,
+	5, 3, 0, 3, 5, 5, 4, 5, 0, 5, 0, 3, 5, 5, 4, 5,
+	5, 3, 5, 5, 4, 5, 5, 0, 3, 8, 4, 5, 5, 3, 5, 0,
+	5, 5, 5, 4, 4, 0, 5, 3, 5, 3, 4, 0, 4, 10, 0, 3,
+	8, 8, 0, 3, 5, 5, 4, 4, 0, 5, 3, 5, 0, 3, 5, 5,
+	4, 0, 5, 5, 3, 5, 5, 4, 0, 5, 5, 0, 3, 4, 8, 0,
+	8, 0, 3, 8, 8, 8, 0, 4, 4, 8, 8, 0, 3, 3, 8, 8,
+	8, 0, 5, 5, 4, 4, 7, 0, 5, 3, 3, 5, 5, 4, 4, 7,
+	5, 3, 3, 8, 4, 5, 5, 3, 5, 4, 0, 5, 3, 0, 5, 5,
+	4, 4, 2, 5, 5, 3, 3, 5, 5, 4, 4, 4, 10, 10, 3, 3,
+	3, 5, 5, 4, 4, 4, 0, 10, 10, 3, 3, 3, 5, 5, 4, 4,
+	5, 4, 7, 3, 3, 3, 4, 0, 4, 2, 3, 0, 3, 8, 4, 4,
+	4, 8, 2, 3, 2, 3, 0, 3, 8, 4, 5, 4, 4, 0, 10, 3,
+	3, 3, 8, 8, 4, 5, 5, 0, 5, 3, 5, 0, 5, 5, 4, 5,
+	0, 5, 3, 0, 5, 5, 4, 5, 4, 4, 7, 3, 3, 3, 5, 5,
+	4, 5, 0, 5, 0, 3, 0, 5, 5, 4, 5, 5, 3, 0, 5, 5,
+	4, 5, 5, 0, 3, 0, 8, 4, 5, 5, 3, 5, 0, 5, 0, 5,
+	5, 4, 4, 0, 5, 3, 5, 3, 0, 4, 0, 4, 10, 0, 3, 8,
+	8, 0, 3, 0, 5, 5, 4, 4, 0, 5, 3, 5, 0, 3, 0, 5,
+	5, 4, 0, 5, 5, 3, 0, 5, 5, 4, 0, 5, 5, 0, 3, 0,
+	5, 5, 4, 4, 4, 10, 8, 3, 3, 3, 5, 5, 4, 4, 4, 0,
+	10, 8, 3, 3, 3, 5, 5, 4, 4, 7, 0, 5, 3, 0, 3, 5,
+	5, 4, 4, 7, 5, 3, 0, 3, 4, 5, 4, 4, 10, 10, 2, 3,
+	3, 8, 3, 5, 5, 4, 4, 2, 5, 5, 3, 0, 3, 5, 5, 4,
+	4, 4, 10, 8, 3, 3, 3, 0, 5, 5, 4, 4, 4, 2, 10, 8,
+	3, 3, 3, 5, 5, 4, 4, 7, 4, 7, 3, 3, 3, 4, 0, 4,
+	2, 3, 0, 3, 0, 8, 4, 5, 4, 4, 10, 10, 2, 3, 3, 3,
+	8, 4, 5, 4, 4, 2, 10, 3, 3, 3, 8, 5, 5, 4, 5, 4,
+	2, 5, 3, 0, 3, 5, 5, 4, 5, 4, 7, 3, 0, 3, 5, 5,
+	4, 5, 4, 2, 5, 3, 0, 3, 0, 5, 5, 4, 5, 4, 7, 3,
+	0, 3, 0, 4, 0, 3, 0, 8, 8, 4, 0, 3, 0, 8, 8, 0,
+	4, 0, 4, 10, 0, 3, 3, 8, 8, 5, 5, 4, 4, 4, 7, 3,
+	5, 3, 0, 3, 4, 0, 4, 10, 0, 3, 3, 8, 8, 0, 4, 8,
+	4, 0, 4, 10, 0, 3, 3, 8, 3, 4, 5, 4, 2, 8, 3, 3,
+	8, 8, 4, 5, 4, 2, 8, 3, 3, 8, 8, 0, 8, 4, 8, 8,
+	8, 3, 5, 5, 5, 5, 4, 0, 5, 3, 8, 4, 8, 8, 0, 8,
+	3, 5, 5, 5, 5, 4, 0, 5, 0, 3, 5, 5, 5, 0, 5, 5,
+	5, 5, 4, 5, 0, 3, 8, 4, 8, 8, 8, 3, 5, 0, 5, 5,
+	5, 4, 0, 5, 3, 0, 8, 4, 8, 8, 0, 8, 3, 5, 0, 5,
+	5, 5, 4, 0, 5, 0, 3, 0, 5, 5, 5, 0, 5, 0, 5, 5,
+	5, 4, 5, 0, 3, 0, 5, 5, 5, 4, 4, 2, 5, 3, 0, 3,
+	5, 5, 5, 4, 4, 7, 3, 0, 3, 8, 8, 4, 8, 0, 8, 0,
+	5, 0, 3, 5, 5, 5, 4, 4, 7, 3, 0, 3, 0, 5, 5, 5,
+	0, 5, 0, 4, 0, 3, 8, 4, 8, 8, 8, 0, 5, 0, 3, 8,
+	8, 8, 8, 8, 0, 8, 8, 8, 8, 0, 8, 8, 0, 8, 0, 8,
+	8, 4, 8, 0, 3, 8, 4, 8, 8, 0, 3, 4, 8, 0, 3, 8,
+	8, 8, 5, 5, 4, 4, 2, 5, 3, 5, 3, 4, 8, 0, 3, 8,
+	8, 0, 8, 8, 4, 4, 8, 0, 3, 8, 3, 8, 5, 5, 4, 0,
+	5, 3, 5, 5, 5, 4, 4, 7, 3, 5, 0, 3, 4, 8, 0, 3,
+	8, 8, 8, 0, 5, 5, 4, 4, 2, 5, 3, 5, 3, 0, 4, 8,
+	0, 3, 8, 8, 0, 8, 0, 8, 4, 4, 8, 0, 3, 8, 8, 3,
+	5, 5, 4, 0, 5, 3, 5, 0, 5, 5, 4, 4, 7, 3, 5, 0,
+	3, 0, 4, 8, 0, 3, 8, 8, 4, 8, 0, 3, 8, 4, 4, 8,
+	0, 3, 8, 8, 0, 3, 0, 4, 8, 0, 3, 8, 4, 8, 8, 0,
+	3, 8, 4, 4, 8, 0, 3, 8, 8, 0, 3, 4, 5, 0, 4, 2,
+	8, 3, 3, 8, 8, 4, 5, 0, 4, 2, 8, 3, 3, 8, 8, 0,
+	5, 5, 0, 5, 5, 5, 5, 0, 5, 5, 4, 0, 3, 5, 5, 0,
+	5, 5, 0, 8, 4, 5, 5, 0, 5, 5, 3, 5, 5, 0, 5, 5,
+	0, 4, 0, 3, 8, 4, 5, 5, 0, 5, 5, 0, 3, 4, 8, 0,
+	8, 3, 8, 8, 8, 8, 8, 4, 0, 8, 8, 8, 3, 5, 4, 8,
+	0, 8, 8, 0, 3, 0, 8, 8, 4, 5, 4, 4, 10, 0, 3, 8,
+	3, 3, 8, 0, 5, 5, 5, 4, 0, 5, 3, 4, 5, 4, 4, 7,
+	2, 3, 2, 3, 3, 4, 8, 0, 8, 3, 8, 8, 0, 8, 5, 5,
+	4, 4, 4, 5, 2, 3, 3, 3, 4, 8, 8, 4, 2, 8, 3, 8,
+	3, 8, 4, 5, 4, 4, 10, 0, 3, 3, 8, 3, 8, 0, 5, 5,
+	5, 4, 0, 5, 0, 3, 4, 5, 4, 4, 7, 2, 3, 2, 3, 0,
+	3, 8, 4, 5, 4, 0, 5, 3, 5, 3, 5, 5, 4, 4, 7, 3,
+	5, 0, 5, 3, 5, 4, 4, 7, 3, 5, 4, 0, 5, 3, 0, 3,
+	5, 4, 4, 7, 3, 5, 0, 5, 0, 3, 4, 0, 4, 2, 3, 8,
+	8, 3, 4, 0, 4, 2, 3, 8, 8, 0, 3, 8, 0, 5, 5, 5,
+	0, 5, 4, 5, 4, 7, 4, 2, 3, 0, 3, 3, 4, 0, 4, 10,
+	3, 8, 8, 0, 3, 8, 4, 4, 5, 4, 7, 3, 0, 3, 3, 5,
+	4, 4, 2, 5, 3, 5, 5, 3, 5, 4, 4, 2, 5, 3, 5, 5,
+	0, 3, 4, 8, 0, 8, 3, 8, 8, 8, 0, 8, 8, 4, 0, 8,
+	8, 8, 3, 5, 0, 4, 8, 0, 8, 8, 0, 3, 0, 8, 8, 0,
+	5, 5, 4, 4, 10, 0, 8, 8, 3, 3, 8, 0, 5, 5, 5, 4,
+	0, 5, 3, 0, 4, 5, 4, 4, 7, 2, 3, 0, 3, 3, 4, 8,
+	0, 8, 3, 8, 8, 0, 8, 0, 5, 5, 4, 4, 4, 7, 0, 3,
+	3, 3, 4, 8, 8, 4, 2, 8, 3, 8, 8, 3, 8, 4, 4, 8,
+	0, 8, 3, 8, 8, 3, 4, 0, 4, 2, 8, 0, 3, 0, 3, 8,
+	8, 4, 4, 5, 4, 2, 5, 3, 0, 3, 3, 8, 4, 5, 4, 0,
+	5, 3, 5, 3, 5, 0, 5, 4, 4, 7, 3, 5, 0, 5, 3, 0,
+	4, 5, 4, 7, 4, 4, 7, 2, 3, 3, 3, 3, 5, 4, 4, 7,
+	3, 5, 0, 5, 0, 3, 0, 4, 0, 4, 2, 3, 8, 3, 8, 4,
+	0, 4, 2, 3, 8, 8, 0, 3, 0, 8, 0, 5, 5, 5, 0, 5,
+	0, 4, 5, 4, 7, 4, 2, 3, 2, 3, 3, 4, 0, 4, 10, 3,
+	8, 8, 0, 3, 0, 8, 4, 4, 5, 4, 7, 3, 2, 3, 3, 5,
+	4, 4, 2, 5, 3, 5, 5, 3, 0, 5, 4, 4, 2, 5, 3, 5,
+	5, 0, 3, 0, 4, 0, 4, 10, 0, 8, 3, 3, 8, 8, 5, 5,
+	4, 4, 4, 7, 2, 3, 3, 3, 0, 4, 8, 8, 4, 2, 8, 3,
+	8, 8, 0, 3, 0, 5, 5, 4, 4, 10, 0, 8, 3, 8, 3, 5,
+	5, 4, 4, 7, 4, 2, 3, 3, 3, 4, 5, 4, 4, 7, 2, 3,
+	0, 3, 0, 3, 4, 0, 4, 10, 0, 8, 3, 3, 8, 8, 0, 5,
+	5, 4, 4, 4, 7, 2, 3, 3, 3, 4, 8, 8, 4, 2, 8, 3,
+	8, 8, 0, 3, 5, 5, 4, 4, 10, 0, 8, 3, 3, 8, 5, 5,
+	4, 4, 7, 5, 0, 3, 3, 8, 8, 4, 5, 5, 4, 4, 5, 2,
+	3, 3, 3, 4, 4, 4, 8, 2, 3, 2, 3, 3, 8, 8, 0, 4,
+	0, 8, 8, 8, 3, 5, 0, 5, 4, 4, 4, 8, 2, 3, 2, 3,
+	3, 8, 8, 0, 0, 4, 0, 8, 8, 8, 3, 5, 0, 5, 0, 4,
+	0, 4, 2, 3, 3, 8, 8, 4, 0, 4, 2, 3, 3, 8, 8, 0,
+	4, 0, 8, 0, 3, 0, 8, 8, 8, 4, 4, 0, 8, 0, 3, 0,
+	3, 8, 4, 0, 8, 0, 3, 0, 8, 8, 0, 8, 4, 4, 0, 8,
+	0, 3, 0, 8, 3, 4, 5, 4, 2, 8, 0, 3, 3, 8, 8, 4,
+	5, 4, 2, 8, 0, 3, 3, 8, 8, 0, 8, 4, 5, 0, 5, 5,
+	3, 5, 5, 0, 5, 5, 4, 0, 5, 3, 8, 4, 5, 0, 5, 5,
+	3, 5, 4, 0, 3, 5, 0, 5, 5, 4, 0, 5, 0, 3, 5, 0,
+	5, 5, 0, 5, 5, 0, 5, 5, 4, 5, 0, 3, 8, 4, 5, 0,
+	5, 5, 3, 5, 0, 5, 0, 5, 5, 4, 0, 5, 3, 0, 5, 0,
+	5, 5, 4, 4, 4, 7, 3, 3, 3, 5, 0, 5, 5, 4, 0, 5,
+	0, 3, 0, 5, 0, 5, 5, 0, 5, 0, 5, 0, 5, 5, 4, 5,
+	0, 3, 0, 5, 0, 5, 5, 4, 4, 2, 5, 3, 0, 3, 5, 0,
+	5, 5, 4, 4, 7, 3, 0, 3, 5, 0, 5, 5, 4, 4, 2, 5,
+	3, 0, 3, 0, 5, 0, 5, 5, 4, 4, 7, 3, 0, 3, 0, 5,
+	0, 5, 5, 0, 5, 0, 4, 0, 3, 8, 4, 5, 0, 5, 5, 0,
+	5, 0, 3, 5, 0, 5, 5, 5, 4, 0, 3, 8, 8, 0, 8, 5,
+	0, 5, 5, 5, 0, 4, 0, 3, 8, 8, 0, 8, 0, 5, 0, 5,
+	5, 5, 0, 4, 0, 3, 4, 0, 3, 8, 4, 8, 8, 0, 3, 8,
+	0, 8, 8, 8, 8, 4, 8, 0, 3, 8, 8, 8, 0, 8, 8, 0,
+	8, 8, 4, 8, 0, 8, 3, 8, 8, 8, 4, 4, 8, 0, 3, 3,
+	8, 8, 4, 8, 4, 8, 0, 3, 3, 8, 8, 0, 8, 8, 8, 0,
+	8, 4, 8, 0, 3, 8, 8, 0, 8, 0, 8, 8, 0, 8, 0, 8,
+	4, 8, 0, 8, 8, 3, 8, 8, 4, 4, 8, 0, 3, 8, 3, 8,
+	4, 8, 4, 8, 0, 3, 8, 3, 8, 0, 8, 8, 4, 8, 0, 3,
+	8, 4, 8, 0, 8, 8, 0, 3, 0, 8, 8, 4, 0, 8, 8, 0,
+	3, 8, 4, 8, 0, 8, 8, 0, 3, 8, 8, 4, 4, 8, 0, 8,
+	3, 3, 8, 4, 8, 4, 8, 0, 8, 3, 3, 5, 4, 0, 5, 3,
+	5, 5, 5, 4, 0, 5, 3, 5, 5, 4, 0, 3, 5, 4, 0, 5,
+	3, 5, 5, 0, 8, 4, 5, 4, 0, 5, 3, 5, 5, 3, 5, 4,
+	0, 5, 3, 5, 5, 0, 4, 0, 3, 8, 4, 5, 4, 0, 5, 3,
+	5, 5, 0, 3, 8, 0, 8, 0, 8, 8, 8, 4, 8, 8, 0, 3,
+	8, 8, 8, 4, 5, 4, 7, 0, 3, 0, 8, 3, 8, 4, 8, 0,
+	8, 0, 3, 8, 8, 4, 8, 8, 4, 10, 0, 3, 3, 8, 8, 8,
+	4, 4, 8, 8, 0, 3, 3, 8, 8, 8, 0, 8, 0, 8, 8, 0,
+	8, 4, 8, 8, 0, 3, 8, 8, 0, 8, 8, 8, 4, 0, 8, 0,
+	8, 3, 8, 8, 4, 0, 5, 0, 4, 2, 3, 3, 4, 8, 8, 4,
+	10, 0, 3, 8, 3, 8, 8, 4, 4, 8, 8, 0, 3, 8, 3, 8,
+	4, 5, 4, 2, 4, 2, 3, 0, 3, 3, 5, 4, 4, 7, 0, 5,
+	3, 5, 3, 4, 5, 4, 2, 4, 2, 3, 0, 3, 0, 3, 5, 4,
+	4, 7, 0, 5, 3, 5, 0, 3, 5, 4, 4, 7, 5, 3, 5, 3,
+	5, 4, 4, 7, 5, 3, 5, 0, 3, 4, 0, 4, 2, 8, 3, 8,
+	8, 3, 4, 0, 4, 2, 8, 8, 0, 3, 0, 8, 3, 4, 0, 4,
+	2, 8, 3, 8, 8, 0, 3, 4, 0, 4, 10, 4, 2, 8, 3, 8,
+	3, 3, 5, 4, 4, 2, 5, 5, 3, 5, 3, 5, 4, 4, 2, 5,
+	5, 3, 5, 0, 3, 8, 0, 8, 0, 8, 8, 8, 0, 4, 8, 8,
+	0, 3, 8, 8, 8, 0, 4, 5, 5, 4, 2, 3, 0, 8, 3, 8,
+	4, 8, 0, 8, 0, 3, 8, 8, 0, 4, 8, 8, 4, 10, 0, 3,
+	3, 8, 8, 0, 8, 4, 4, 8, 8, 0, 3, 3, 8, 8, 0, 8,
+	0, 8, 0, 8, 8, 0, 8, 0, 4, 8, 8, 0, 3, 8, 8, 0,
+	8, 0, 8, 8, 4, 0, 8, 0, 8, 8, 3, 8, 4, 0, 5, 0,
+	4, 0, 3, 3, 4, 8, 8, 4, 10, 0, 3, 8, 8, 3, 8, 4,
+	4, 8, 8, 0, 3, 8, 8, 3, 4, 5, 4, 2, 4, 2, 3, 2,
+	3, 3, 5, 4, 4, 7, 0, 5, 3, 5, 3, 0, 4, 8, 8, 4,
+	10, 8, 0, 3, 0, 8, 3, 8, 4, 4, 5, 4, 2, 3, 0, 3,
+	3, 0, 4, 0, 8, 0, 8, 3, 5, 5, 4, 4, 7, 5, 3, 5,
+	0, 3, 0, 4, 0, 4, 2, 8, 3, 8, 3, 8, 4, 0, 4, 2,
+	8, 8, 0, 3, 0, 3, 8, 4, 0, 4, 2, 8, 3, 8, 8, 0,
+	3, 0, 8, 4, 4, 0, 4, 2, 8, 3, 8, 3, 3, 5, 4, 4,
+	2, 5, 5, 3, 5, 3, 0, 5, 4, 4, 2, 5, 5, 3, 5, 0,
+	3, 0, 4, 5, 4, 7, 3, 0, 3, 0, 8, 4, 5, 4, 4, 7,
+	2, 3, 3, 8, 3, 4, 5, 5, 4, 2, 3, 0, 8, 0, 3, 5,
+	4, 0, 4, 10, 0, 8, 3, 5, 3, 4, 5, 5, 4, 2, 4, 2,
+	3, 8, 3, 3, 8, 4, 4, 5, 5, 4, 2, 3, 10, 3, 3, 4,
+	5, 4, 7, 3, 0, 3, 0, 8, 0, 4, 5, 4, 4, 7, 2, 3,
+	3, 3, 8, 8, 8, 4, 0, 8, 0, 8, 8, 0, 3, 8, 4, 0,
+	5, 0, 4, 0, 3, 0, 3, 4, 8, 8, 4, 10, 0, 3, 8, 8,
+	0, 3, 8, 4, 4, 8, 8, 0, 3, 8, 8, 0, 3, 4, 0, 4,
+	2, 8, 0, 3, 3, 8, 8, 0, 4, 0, 8, 8, 8, 0, 5, 3,
+	5, 4, 0, 4, 2, 8, 0, 3, 3, 8, 8, 0, 0, 4, 0, 8,
+	8, 8, 0, 5, 3, 5, 0, 0, 4, 0, 8, 8, 3, 5, 0, 4,
+	0, 8, 8, 3, 5, 0, 4, 0, 4, 2, 8, 3, 3, 8, 8, 8,
+	4, 4, 0, 4, 2, 8, 3, 3, 3, 8, 4, 0, 4, 2, 8, 3,
+	3, 8, 8, 0, 8, 4, 4, 0, 4, 2, 8, 3, 3, 8, 3, 5,
+	4, 4, 0, 8, 3, 8, 8, 3, 5, 5, 4, 4, 0, 8, 3, 8,
+	8, 3, 5, 0, 4, 0, 8, 0, 3, 8, 8, 8, 5, 4, 5, 4,
+	2, 5, 3, 5, 3, 4, 0, 8, 0, 3, 8, 8, 0, 8, 5, 4,
+	5, 4, 2, 5, 3, 5, 0, 3, 5, 4, 5, 0, 5, 3, 5, 5,
+	4, 5, 4, 7, 3, 5, 0, 3, 4, 0, 8, 0, 3, 8, 8, 8,
+	0, 5, 4, 5, 4, 2, 5, 3, 5, 3, 0, 4, 0, 8, 0, 3,
+	8, 8, 0, 8, 0, 8, 4, 4, 0, 8, 0, 3, 8, 8, 3, 5,
+	4, 5, 0, 5, 3, 5, 0, 5, 4, 5, 4, 7, 3, 5, 0, 3,
+	0, 4, 0, 8, 0, 3, 8, 8, 4, 8, 0, 3, 5, 4, 5, 4,
+	4, 7, 3, 3, 5, 0, 3, 4, 0, 8, 0, 3, 8, 4, 8, 8,
+	0, 3, 8, 4, 4, 0, 8, 0, 3, 8, 8, 0, 3, 4, 4, 2,
+	3, 0, 8, 8, 3, 5, 4, 4, 2, 3, 0, 8, 8, 3, 5, 0,
+	5, 4, 5, 5, 3, 5, 0, 4, 8, 8, 0, 8, 3, 5, 5, 4,
+	5, 5, 3, 5, 0, 0, 4, 8, 8, 0, 8, 3, 5, 0, 5, 4,
+	5, 5, 3, 5, 0, 4, 0, 3, 8, 4, 0, 8, 0, 8, 0, 5,
+	0, 3, 4, 0, 8, 3, 8, 8, 8, 4, 0, 8, 8, 0, 3, 0,
+	8, 8, 4, 0, 8, 3, 8, 8, 0, 8, 8, 4, 4, 0, 8, 3,
+	8, 3, 8, 5, 4, 4, 0, 5, 3, 5, 3, 5, 5, 4, 4, 4,
+	7, 3, 5, 3, 5, 0, 3, 4, 0, 8, 3, 8, 8, 8, 0, 4,
+	0, 8, 8, 0, 3, 0, 8, 8, 0, 4, 0, 8, 3, 8, 8, 0,
+	8, 0, 8, 4, 4, 0, 8, 3, 8, 8, 3, 5, 4, 4, 0, 5,
+	3, 5, 3, 5, 0, 8, 4, 4, 0, 8, 8, 0, 3, 0, 8, 3,
+	4, 0, 8, 3, 8, 8, 4, 8, 0, 3, 8, 4, 4, 0, 8, 3,
+	8, 8, 0, 3, 0, 4, 0, 8, 3, 8, 4, 8, 8, 0, 3, 8,
+	4, 4, 0, 8, 3, 8, 8, 0, 3, 8, 8, 4, 4, 4, 0, 8,
+	3, 8, 3, 3, 8, 4, 8, 4, 4, 0, 8, 3, 8, 3, 3, 5,
+	4, 0, 5, 5, 3, 5, 5, 4, 0, 5, 5, 3, 5, 4, 0, 3,
+	5, 4, 0, 5, 5, 3, 5, 0, 8, 4, 5, 4, 0, 5, 5, 3,
+	5, 3, 5, 4, 0, 5, 5, 3, 5, 0, 4, 0, 3, 8, 4, 5,
+	4, 0, 5, 5, 3, 5, 0, 3, 8, 0, 8, 0, 5, 5, 5, 8,
+	8, 4, 0, 5, 5, 3, 5, 5, 4, 4, 4, 0, 8, 0, 3, 3,
+	3, 0, 4, 0, 4, 0, 8, 0, 3, 3, 4, 4, 4, 4, 10, 3,
+	8, 3, 3, 3, 5, 4, 4, 4, 0, 8, 8, 3, 3, 3, 8, 0,
+	8, 0, 8, 8, 0, 8, 8, 4, 8, 8, 0, 3, 8, 8, 0, 8,
+	8, 8, 8, 4, 0, 8, 0, 8, 3, 8, 8, 0, 4, 0, 4, 0,
+	8, 3, 3, 4, 4, 4, 10, 0, 3, 0, 8, 3, 3, 5, 4, 4,
+	4, 0, 8, 3, 8, 3, 3, 8, 4, 5, 4, 2, 5, 3, 5, 3,
+	5, 4, 4, 5, 0, 5, 3, 3, 5, 4, 4, 5, 4, 0, 5, 3,
+	0, 3, 3, 5, 4, 4, 5, 0, 5, 0, 3, 3, 5, 4, 4, 5,
+	5, 3, 3, 5, 4, 4, 5, 5, 0, 3, 3, 8, 0, 5, 5, 4,
+	0, 5, 3, 5, 4, 4, 4, 0, 5, 3, 5, 3, 3, 4, 4, 4,
+	10, 3, 8, 8, 0, 3, 3, 5, 4, 4, 4, 0, 5, 3, 5, 0,
+	3, 3, 5, 4, 4, 0, 5, 5, 3, 3, 5, 4, 4, 0, 5, 5,
+	0, 3, 3, 5, 4, 4, 4, 8, 2, 3, 3, 3, 4, 8, 8, 0,
+	3, 8, 8, 8, 0, 8, 5, 4, 4, 4, 2, 8, 0, 3, 3, 3,
+	5, 4, 4, 4, 10, 10, 3, 3, 3, 0, 4, 4, 4, 0, 10, 3,
+	8, 3, 8, 3, 5, 4, 4, 4, 2, 8, 8, 3, 3, 3, 5, 4,
+	4, 2, 4, 10, 0, 3, 3, 3, 4, 4, 7, 5, 4, 2, 3, 8,
+	8, 3, 3, 4, 8, 8, 8, 3, 5, 5, 0, 5, 0, 0, 4, 0,
+	4, 0, 3, 8, 3, 4, 4, 4, 10, 0, 3, 0, 3, 8, 3, 4,
+	8, 8, 8, 3, 5, 0, 5, 5, 0, 8, 4, 5, 4, 2, 5, 3,
+	5, 0, 3, 5, 4, 4, 5, 0, 5, 3, 0, 3, 4, 5, 5, 0,
+	5, 3, 5, 5, 0, 5, 0, 5, 4, 4, 0, 8, 0, 3, 8, 3,
+	0, 4, 0, 8, 0, 8, 3, 5, 4, 4, 5, 5, 0, 3, 0, 3,
+	8, 0, 5, 5, 4, 0, 5, 0, 3, 5, 4, 4, 4, 0, 5, 3,
+	5, 3, 0, 3, 4, 4, 4, 10, 3, 8, 8, 0, 3, 0, 3, 4,
+	5, 5, 4, 7, 3, 5, 5, 3, 5, 0, 5, 4, 4, 0, 5, 5,
+	3, 0, 3, 5, 4, 4, 0, 5, 5, 0, 3, 0, 3, 5, 4, 4,
+	4, 8, 2, 3, 0, 3, 3, 4, 4, 4, 4, 2, 10, 3, 3, 8,
+	3, 3, 5, 4, 4, 4, 2, 8, 0, 3, 0, 3, 3, 5, 4, 0,
+	4, 8, 0, 8, 3, 3, 4, 4, 4, 0, 10, 3, 3, 8, 8, 3,
+	5, 4, 4, 4, 2, 8, 3, 8, 3, 3, 5, 4, 4, 4, 8, 2,
+	3, 0, 3, 0, 3, 4, 4, 4, 4, 2, 10, 3, 3, 3, 8, 3,
+	4, 5, 0, 5, 5, 3, 5, 5, 0, 5, 0, 0, 4, 0, 4, 0,
+	3, 0, 8, 3, 4, 4, 4, 0, 10, 3, 3, 8, 8, 0, 3, 5,
+	4, 4, 4, 2, 8, 3, 3, 8, 3, 4, 4, 4, 10, 0, 3, 3,
+	8, 8, 3, 0, 4, 0, 8, 8, 8, 0, 5, 3, 4, 4, 4, 10,
+	0, 3, 3, 8, 8, 0, 3, 0, 4, 0, 8, 8, 8, 0, 5, 0,
+	3, 0, 4, 0, 8, 8, 3, 0, 4, 0, 8, 8, 0, 3, 4, 4,
+	10, 0, 3, 0, 8, 8, 3, 5, 4, 4, 0, 4, 2, 8, 3, 8,
+	3, 3, 4, 4, 10, 0, 3, 0, 8, 8, 0, 3, 4, 4, 8, 4,
+	10, 0, 3, 0, 8, 3, 3, 5, 4, 4, 0, 8, 3, 8, 8, 3,
+	5, 4, 4, 0, 8, 3, 8, 8, 0, 3, 8, 4, 5, 0, 5, 3,
+	5, 5, 4, 5, 4, 0, 5, 3, 3, 4, 4, 10, 0, 3, 8, 8,
+	0, 8, 3, 5, 4, 5, 4, 0, 5, 0, 3, 3, 5, 4, 5, 0,
+	5, 3, 5, 4, 5, 4, 5, 0, 3, 3, 8, 4, 5, 4, 7, 3,
+	5, 0, 3, 5, 4, 5, 4, 0, 5, 3, 0, 3, 8, 8, 4, 4,
+	5, 0, 5, 3, 5, 3, 0, 5, 4, 5, 4, 0, 5, 0, 3, 0,
+	3, 5, 4, 5, 0, 5, 0, 3, 5, 4, 5, 4, 5, 0, 3, 0,
+	3, 5, 4, 5, 4, 4, 2, 5, 3, 0, 3, 3, 5, 4, 5, 0,
+	4, 0, 5, 0, 3, 3, 5, 4, 5, 4, 4, 2, 5, 3, 0, 3,
+	0, 3, 5, 4, 5, 0, 4, 0, 5, 0, 3, 0, 3, 4, 4, 2,
+	3, 0, 8, 8, 3, 4, 4, 2, 3, 0, 8, 8, 0, 3, 5, 4,
+	5, 5, 3, 0, 4, 8, 8, 0, 8, 3, 5, 4, 5, 5, 0, 3,
+	0, 4, 8, 8, 0, 8, 0, 3, 5, 4, 5, 5, 0, 4, 0, 3,
+	3, 0, 4, 8, 4, 8, 8, 0, 3, 3, 8, 0, 5, 5, 0, 5,
+	8, 8, 4, 5, 5, 3, 5, 0, 5, 0, 4, 8, 0, 8, 8, 0,
+	8, 3, 0, 4, 8, 4, 8, 0, 8, 3, 8, 3, 5, 4, 4, 0,
+	5, 3, 5, 3, 5, 4, 0, 4, 0, 5, 5, 0, 3, 3, 8, 0,
+	5, 5, 4, 5, 0, 3, 5, 4, 4, 4, 2, 5, 3, 5, 3, 0,
+	3, 8, 8, 4, 0, 5, 5, 0, 5, 3, 0, 8, 4, 8, 0, 5,
+	5, 0, 5, 3, 0, 5, 4, 4, 0, 5, 3, 5, 0, 3, 5, 4,
+	0, 4, 0, 5, 5, 0, 3, 0, 3, 4, 4, 2, 8, 0, 3, 0,
+	8, 8, 3, 4, 4, 4, 7, 2, 3, 7, 5, 3, 5, 3, 4, 4,
+	2, 8, 0, 3, 0, 8, 8, 0, 3, 0, 4, 8, 4, 8, 0, 8,
+	8, 0, 3, 3, 4, 4, 2, 4, 2, 3, 3, 8, 8, 3, 4, 4,
+	2, 4, 2, 3, 3, 8, 8, 0, 3, 5, 4, 0, 5, 5, 3, 5,
+	4, 0, 5, 5, 4, 0, 3, 3, 5, 4, 0, 5, 5, 0, 3, 8,
+	4, 5, 4, 2, 5, 5, 3, 3, 5, 4, 0, 5, 5, 0, 4, 0,
+	3, 3, 8, 4, 5, 4, 2, 5, 5, 0, 3, 3, 8, 0, 8, 0,
+	5, 5, 5, 0, 8, 8, 4, 0, 5, 5, 3, 5, 0, 5, 4, 4,
+	4, 0, 10, 2, 3, 3, 3, 5, 4, 4, 10, 0, 8, 0, 3, 3,
+	4, 4, 4, 2, 10, 3, 8, 8, 3, 3, 5, 4, 4, 4, 2, 10,
+	10, 3, 3, 3, 8, 0, 8, 0, 8, 8, 0, 8, 8, 0, 4, 8,
+	8, 0, 3, 8, 8, 0, 8, 8, 0, 8, 8, 4, 0, 8, 0, 8,
+	3, 8, 8, 0, 5, 4, 4, 10, 0, 8, 3, 3, 4, 4, 4, 10,
+	0, 3, 2, 8, 3, 3, 4, 4, 4, 7, 2, 3, 8, 8, 3, 3,
+	8, 4, 5, 4, 2, 5, 3, 5, 3, 0, 5, 4, 4, 7, 0, 5,
+	3, 3, 5, 4, 4, 7, 4, 0, 5, 3, 0, 3, 3, 5, 4, 4,
+	7, 0, 5, 0, 3, 3, 5, 4, 4, 7, 5, 3, 3, 5, 4, 4,
+	7, 5, 0, 3, 3, 8, 0, 5, 5, 4, 0, 5, 3, 0, 5, 4,
+	4, 4, 2, 7, 3, 5, 3, 3, 4, 4, 4, 10, 3, 10, 8, 0,
+	3, 3, 5, 4, 4, 4, 2, 7, 3, 5, 0, 3, 3, 5, 4, 4,
+	2, 5, 5, 3, 3, 5, 4, 4, 2, 5, 5, 0, 3, 3, 5, 4,
+	4, 4, 8, 2, 3, 3, 3, 0, 4, 8, 8, 0, 3, 8, 8, 8,
+	0, 8, 0, 5, 4, 4, 4, 2, 10, 2, 3, 3, 3, 5, 4, 4,
+	4, 10, 10, 3, 3, 3, 4, 4, 4, 0, 10, 3, 8, 3, 3, 8,
+	5, 4, 4, 4, 0, 10, 10, 3, 3, 3, 8, 0, 8, 8, 4, 0,
+	8, 8, 8, 3, 5, 4, 4, 4, 4, 7, 0, 3, 3, 3, 3, 4,
+	8, 8, 8, 3, 5, 5, 0, 5, 0, 4, 0, 4, 0, 3, 3, 8,
+	4, 4, 4, 10, 0, 3, 0, 3, 3, 8, 4, 8, 8, 8, 3, 5,
+	0, 5, 5, 5, 4, 4, 5, 4, 0, 7, 3, 3, 3, 5, 4, 4,
+	5, 4, 7, 3, 3, 3, 4, 5, 5, 0, 5, 3, 5, 5, 0, 5,
+	5, 4, 4, 0, 8, 0, 3, 3, 8, 0, 4, 0, 8, 0, 3, 8,
+	8, 4, 0, 4, 0, 8, 0, 3, 3, 4, 4, 4, 10, 3, 8, 3,
+	3, 8, 5, 4, 4, 2, 4, 2, 10, 8, 3, 3, 3, 5, 4, 4,
+	7, 5, 4, 2, 10, 3, 3, 3, 4, 5, 5, 4, 7, 3, 5, 5,
+	3, 5, 5, 4, 4, 0, 8, 8, 3, 3, 8, 5, 4, 4, 0, 5,
+	5, 0, 3, 0, 3, 0, 5, 4, 4, 4, 8, 2, 3, 2, 3, 3,
+	4, 4, 4, 4, 2, 10, 3, 3, 10, 3, 3, 4, 5, 5, 3, 5,
+	4, 5, 0, 5, 0, 3, 5, 4, 0, 4, 10, 0, 8, 3, 3, 4,
+	4, 4, 0, 10, 3, 3, 8, 3, 8, 4, 4, 7, 4, 2, 3, 10,
+	8, 3, 3, 5, 4, 4, 2, 4, 10, 0, 3, 2, 3, 3, 5, 4,
+	4, 4, 4, 7, 2, 3, 3, 3, 3, 4, 5, 0, 5, 5, 3, 5,
+	5, 0, 5, 0, 4, 0, 4, 0, 3, 0, 3, 8, 4, 4, 4, 10,
+	0, 3, 0, 3, 0, 3, 8, 5, 4, 4, 4, 2, 8, 3, 3, 3,
+	8, 4, 4, 4, 10, 0, 3, 3, 8, 3, 8, 0, 4, 0, 8, 3,
+	8, 8, 0, 5, 5, 4, 5, 5, 4, 4, 7, 0, 3, 3, 3, 5,
+	4, 4, 0, 8, 0, 3, 0, 3, 8, 0, 4, 0, 8, 3, 8, 0,
+	4, 0, 8, 8, 0, 3, 0, 4, 4, 10, 0, 3, 0, 8, 3, 8,
+	5, 4, 4, 2, 4, 2, 10, 3, 8, 3, 3, 4, 4, 10, 0, 3,
+	0, 8, 8, 0, 3, 0, 4, 8, 4, 4, 10, 0, 3, 0, 8, 3,
+	3, 5, 4, 4, 0, 8, 3, 8, 3, 8, 5, 4, 4, 0, 8, 3,
+	8, 8, 0, 3, 0, 8, 4, 5, 0, 5, 3, 5, 0, 5, 4, 5,
+	4, 2, 5, 3, 3, 4, 4, 10, 0, 3, 8, 8, 0, 3, 8, 5,
+	4, 5, 4, 2, 5, 0, 3, 3, 5, 4, 5, 0, 5, 3, 0, 5,
+	4, 5, 4, 7, 0, 3, 3, 8, 4, 5, 4, 7, 3, 5, 0, 3,
+	0, 5, 4, 5, 4, 4, 7, 3, 3, 3, 8, 8, 4, 4, 5, 0,
+	5, 3, 5, 3, 8, 4, 8, 4, 5, 0, 5, 3, 5, 3, 5, 4,
+	5, 0, 5, 0, 3, 0, 8, 4, 5, 4, 5, 0, 5, 3, 3, 5,
+	4, 5, 4, 4, 0, 7, 3, 0, 3, 3, 5, 4, 5, 4, 4, 7,
+	3, 0, 3, 3, 5, 4, 5, 4, 4, 4, 7, 3, 3, 0, 3, 3,
+	4, 4, 2, 4, 2, 3, 0, 3, 0, 3, 8, 4, 4, 2, 3, 0,
+	8, 3, 8, 4, 4, 2, 3, 0, 8, 8, 0, 3, 0, 5, 4, 5,
+	5, 3, 0, 0, 4, 8, 8, 0, 3, 8, 5, 4, 5, 5, 0, 3,
+	0, 8, 4, 0, 8, 0, 8, 0, 3, 0, 4, 8, 8, 4, 10, 0,
+	3, 3, 8, 4, 0, 4, 8, 8, 0, 3, 3, 8, 0, 5, 5, 0,
+	5, 0, 8, 8, 4, 5, 5, 3, 5, 0, 5, 0, 0, 4, 8, 0,
+	8, 8, 0, 3, 8, 0, 4, 8, 4, 8, 0, 8, 3, 3, 8, 5,
+	4, 4, 0, 5, 3, 5, 3, 0, 5, 4, 4, 4, 7, 3, 5, 0,
+	3, 3, 8, 0, 5, 5, 4, 5, 0, 3, 0, 4, 4, 7, 5, 4,
+	2, 3, 2, 8, 3, 3, 8, 8, 4, 0, 5, 5, 0, 5, 3, 8,
+	4, 8, 0, 5, 5, 0, 5, 3, 5, 4, 4, 0, 5, 3, 5, 0,
+	3, 0, 8, 4, 5, 4, 4, 0, 5, 3, 5, 3, 3, 4, 4, 2,
+	8, 0, 3, 0, 8, 3, 8, 4, 4, 4, 7, 2, 3, 7, 5, 3,
+	5, 3, 0, 0, 4, 8, 8, 4, 2, 8, 8, 0, 3, 3, 8, 4,
+	0, 4, 8, 0, 8, 8, 0, 3, 3, 4, 4, 2, 4, 2, 3, 3,
+	8, 3, 8, 4, 4, 2, 4, 2, 3, 3, 8, 8, 0, 3, 0, 5,
+	4, 0, 5, 5, 3, 0, 5, 4, 0, 5, 5, 4, 2, 3, 3, 5,
+	4, 0, 5, 5, 0, 3, 0, 8, 4, 5, 4, 0, 5, 5, 3, 3,
+	5, 4, 0, 5, 5, 0, 4, 2, 3, 3, 8, 4, 5, 4, 0, 5,
+	5, 0, 3, 3, 5, 4, 4, 4, 10, 0, 3, 3, 3, 4, 4, 10,
+	8, 0, 3, 8, 3, 8, 8, 5, 4, 4, 4, 0, 10, 0, 3, 3,
+	3, 5, 4, 4, 4, 10, 8, 3, 3, 3, 4, 4, 4, 4, 10, 3,
+	10, 3, 3, 3, 5, 4, 4, 4, 0, 10, 8, 3, 3, 3, 5, 4,
+	4, 0, 4, 10, 0, 3, 3, 3, 4, 5, 4, 7, 4, 2, 3, 8,
+	8, 3, 3, 4, 5, 4, 7, 3, 5, 5, 0, 5, 3, 5, 4, 4,
+	10, 0, 3, 8, 3, 4, 4, 4, 10, 0, 3, 2, 3, 8, 3, 4,
+	4, 4, 7, 2, 3, 8, 3, 8, 3, 5, 4, 4, 7, 4, 2, 5,
+	3, 3, 3, 5, 4, 4, 7, 0, 5, 3, 0, 3, 5, 4, 4, 7,
+	0, 4, 2, 5, 3, 3, 3, 5, 4, 4, 2, 8, 0, 3, 8, 3,
+	5, 4, 4, 7, 5, 3, 0, 3, 5, 4, 4, 7, 5, 0, 3, 0,
+	3, 4, 4, 4, 10, 3, 10, 3, 8, 3, 5, 4, 4, 4, 2, 7,
+	3, 5, 3, 0, 3, 4, 4, 4, 10, 3, 10, 8, 0, 3, 0, 3,
+	4, 4, 4, 8, 4, 10, 3, 10, 3, 3, 3, 5, 4, 4, 2, 5,
+	5, 3, 0, 3, 5, 4, 4, 2, 5, 5, 0, 3, 0, 3, 5, 4,
+	4, 4, 10, 0, 3, 3, 3, 0, 4, 4, 10, 8, 0, 3, 8, 3,
+	8, 8, 0, 5, 4, 4, 4, 2, 10, 0, 3, 3, 3, 5, 4, 4,
+	4, 10, 8, 3, 3, 3, 0, 4, 4, 4, 2, 10, 3, 8, 3, 3,
+	8, 5, 4, 4, 4, 2, 10, 8, 3, 3, 3, 5, 4, 4, 0, 4,
+	10, 0, 3, 3, 3, 0, 4, 5, 4, 7, 4, 2, 3, 10, 8, 3,
+	3, 4, 0, 8, 8, 8, 3, 5, 5, 0, 5, 5, 4, 4, 10, 0,
+	3, 3, 8, 4, 4, 4, 10, 0, 3, 2, 3, 3, 8, 4, 4, 4,
+	7, 2, 3, 8, 3, 3, 8, 5, 4, 4, 7, 4, 0, 7, 3, 3,
+	3, 5, 4, 4, 7, 4, 7, 3, 3, 3, 5, 4, 4, 7, 4, 4,
+	7, 3, 3, 3, 3, 5, 4, 4, 2, 8, 0, 3, 3, 8, 0, 4,
+	0, 8, 0, 3, 0, 8, 5, 4, 4, 7, 5, 0, 3, 0, 3, 0,
+	4, 4, 4, 10, 3, 10, 3, 3, 8, 5, 4, 4, 0, 4, 2, 10,
+	8, 3, 3, 3, 5, 4, 4, 5, 5, 4, 2, 10, 3, 3, 3, 4,
+	4, 4, 10, 4, 7, 3, 2, 3, 3, 3, 5, 4, 4, 2, 8, 8,
+	3, 3, 8, 5, 4, 4, 2, 5, 5, 0, 3, 0, 3, 0, 4, 4,
+	4, 10, 8, 3, 3, 3, 8, 8, 4, 4, 4, 10, 8, 0, 3, 3,
+	3, 8, 8, 4, 5, 5, 3, 5, 4, 5, 0, 5, 3, 5, 4, 0,
+	4, 10, 0, 3, 8, 3, 4, 4, 4, 0, 10, 3, 3, 3, 8, 8,
+	4, 4, 7, 4, 2, 3, 10, 3, 8, 3, 4, 4, 4, 10, 8, 3,
+	3, 3, 8, 8, 0, 4, 4, 4, 10, 8, 0, 3, 3, 3, 8, 8,
+	0, 4, 5, 5, 3, 5, 4, 5, 0, 5, 3, 0, 5, 4, 0, 4,
+	10, 0, 3, 3, 8, 4, 4, 4, 0, 10, 3, 3, 3, 8, 8, 0,
+	4, 4, 7, 4, 2, 3, 10, 3, 3, 8, 4, 5, 5, 3, 5, 5,
+	4, 0, 5, 3, 4, 5, 5, 3, 5, 5, 0, 5, 4, 5, 5, 3,
+	5, 5, 4, 0, 5, 3, 0, 4, 5, 5, 3, 5, 5, 0, 5, 0,
+	0, 4, 0, 3, 8, 8, 0, 4, 0, 3, 8, 8, 0, 4, 4, 10,
+	0, 3, 0, 3, 8, 8, 4, 5, 5, 3, 5, 4, 0, 5, 3, 5,
+	4, 4, 10, 0, 3, 0, 3, 8, 8, 0, 4, 5, 5, 3, 5, 4,
+	0, 5, 3, 5, 0, 4, 5, 5, 3, 5, 0, 5, 5, 4, 5, 5,
+	3, 5, 0, 5, 5, 0, 4, 4, 10, 0, 3, 8, 3, 8, 8, 5,
+	4, 5, 4, 2, 5, 3, 0, 3, 5, 4, 5, 4, 2, 4, 2, 5,
+	3, 3, 3, 5, 4, 5, 4, 2, 5, 0, 3, 0, 3, 5, 4, 5,
+	4, 7, 3, 0, 3, 5, 4, 5, 4, 7, 0, 3, 0, 3, 4, 4,
+	10, 0, 3, 8, 3, 8, 8, 0, 5, 4, 5, 4, 2, 5, 3, 0,
+	3, 0, 8, 8, 4, 4, 5, 0, 5, 3, 5, 0, 3, 5, 4, 0,
+	4, 2, 8, 0, 3, 3, 8, 5, 4, 5, 4, 7, 3, 0, 3, 0,
+	5, 4, 5, 4, 7, 0, 3, 0, 3, 0, 4, 5, 0, 5, 3, 5,
+	5, 4, 0, 5, 3, 4, 5, 0, 5, 3, 5, 5, 0, 5, 4, 5,
+	0, 5, 3, 5, 5, 4, 0, 5, 3, 0, 4, 5, 0, 5, 3, 5,
+	5, 0, 5, 0, 4, 4, 2, 3, 0, 3, 8, 8, 4, 4, 2, 3,
+	0, 3, 8, 8, 0, 0, 8, 0, 8, 8, 8, 4, 0, 8, 0, 3,
+	8, 0, 8, 0, 8, 8, 0, 8, 4, 0, 8, 0, 8, 3, 8, 8,
+	4, 4, 0, 8, 0, 3, 3, 8, 4, 8, 4, 0, 8, 0, 3, 3,
+	0, 4, 8, 0, 8, 3, 8, 8, 4, 4, 10, 8, 0, 3, 0, 3,
+	8, 8, 0, 4, 8, 0, 8, 8, 0, 3, 0, 8, 8, 4, 0, 4,
+	8, 0, 8, 3, 3, 8, 5, 4, 4, 4, 7, 3, 5, 3, 0, 3,
+	5, 4, 4, 4, 7, 3, 5, 0, 3, 0, 3, 0, 4, 8, 0, 8,
+	3, 8, 8, 0, 4, 4, 10, 8, 0, 3, 0, 3, 8, 8, 0, 8,
+	8, 4, 0, 5, 5, 0, 5, 0, 3, 8, 4, 8, 0, 5, 5, 0,
+	5, 0, 3, 5, 4, 0, 4, 2, 8, 8, 3, 3, 8, 5, 4, 4,
+	4, 7, 3, 5, 0, 3, 0, 3, 0, 4, 4, 2, 8, 0, 3, 0,
+	3, 8, 8, 4, 5, 4, 7, 3, 5, 0, 5, 3, 5, 4, 4, 2,
+	8, 0, 3, 0, 3, 8, 8, 0, 4, 5, 4, 7, 3, 5, 0, 5,
+	3, 5, 0, 4, 5, 4, 7, 3, 5, 5, 3, 5, 4, 5, 4, 7,
+	3, 5, 5, 3, 5, 0, 4, 4, 2, 3, 8, 3, 8, 8, 5, 4,
+	0, 5, 5, 4, 2, 3, 0, 3, 4, 4, 2, 3, 8, 3, 8, 8,
+	0, 8, 4, 5, 4, 0, 5, 5, 3, 0, 3, 4, 5, 4, 2, 5,
+	3, 5, 5, 3, 5, 4, 5, 4, 2, 5, 3, 5, 5, 3, 5, 0,
+	4, 4, 10, 8, 3, 3, 8, 8, 8, 4, 4, 10, 8, 0, 3, 3,
+	8, 8, 8, 0, 5, 5, 4, 4, 5, 0, 5, 3, 3, 5, 4, 4,
+	4, 10, 3, 8, 3, 3, 4, 4, 4, 2, 10, 3, 3, 8, 8, 3,
+	5, 4, 4, 4, 0, 10, 3, 8, 3, 3, 4, 4, 10, 8, 3, 3,
+	8, 8, 0, 8, 5, 4, 4, 4, 4, 2, 10, 3, 3, 3, 3, 0,
+	5, 5, 4, 4, 5, 0, 5, 3, 0, 3, 5, 4, 4, 10, 0, 3,
+	0, 8, 3, 4, 4, 4, 2, 10, 3, 3, 8, 8, 0, 3, 5, 4,
+	4, 4, 0, 10, 3, 3, 8, 3, 8, 4, 0, 5, 5, 0, 5, 3,
+	5, 0, 5, 5, 4, 5, 0, 5, 3, 0, 5, 5, 4, 5, 4, 0,
+	5, 3, 0, 3, 0, 5, 5, 4, 5, 0, 5, 0, 3, 0, 5, 5,
+	4, 5, 5, 3, 0, 5, 5, 4, 5, 5, 0, 3, 4, 4, 2, 8,
+	3, 3, 8, 8, 8, 0, 5, 5, 4, 4, 0, 5, 3, 5, 3, 4,
+	4, 2, 8, 3, 3, 8, 8, 0, 8, 0, 5, 5, 4, 4, 0, 5,
+	3, 5, 0, 3, 0, 5, 5, 4, 0, 5, 5, 3, 0, 5, 5, 4,
+	0, 5, 5, 0, 3, 4, 4, 10, 8, 3, 3, 8, 8, 8, 0, 4,
+	4, 10, 8, 0, 3, 3, 8, 8, 8, 0, 0, 5, 5, 4, 4, 7,
+	0, 5, 3, 3, 5, 4, 4, 4, 10, 3, 10, 3, 3, 4, 4, 4,
+	2, 10, 3, 3, 8, 3, 8, 5, 4, 4, 4, 2, 10, 3, 8, 3,
+	3, 4, 4, 10, 8, 3, 3, 8, 8, 0, 8, 0, 5, 4, 4, 4,
+	4, 2, 10, 3, 3, 3, 3, 0, 5, 5, 4, 4, 5, 4, 7, 0,
+	3, 3, 3, 5, 4, 4, 10, 0, 3, 0, 3, 8, 4, 4, 4, 10,
+	0, 3, 2, 3, 0, 3, 8, 5, 4, 4, 4, 0, 10, 3, 3, 3,
+	8, 8, 4, 0, 5, 5, 0, 5, 3, 5, 0, 0, 5, 5, 4, 5,
+	0, 5, 3, 0, 5, 5, 4, 5, 4, 4, 7, 0, 3, 3, 3, 0,
+	5, 5, 4, 5, 0, 5, 0, 3, 0, 0, 5, 5, 4, 5, 5, 3,
+	0, 0, 5, 5, 4, 5, 5, 0, 3, 0, 4, 4, 2, 8, 3, 3,
+	8, 8, 8, 0, 0, 5, 5, 4, 4, 0, 5, 3, 5, 3, 0, 4,
+	4, 2, 8, 3, 3, 8, 8, 0, 8, 0, 8, 4, 4, 4, 2, 8,
+	3, 3, 8, 8, 3, 0, 5, 5, 4, 0, 5, 5, 3, 0, 0, 5,
+	5, 4, 0, 5, 5, 0, 3, 0, 5, 4, 4, 4, 10, 0, 3, 2,
+	3, 0, 3, 4, 4, 4, 10, 10, 2, 3, 3, 3, 8, 8, 0, 5,
+	5, 4, 4, 7, 0, 5, 3, 0, 3, 5, 4, 4, 4, 10, 3, 10,
+	3, 0, 3, 4, 4, 4, 2, 10, 3, 3, 3, 8, 8, 5, 4, 4,
+	4, 2, 10, 3, 3, 8, 3, 5, 5, 4, 4, 4, 10, 10, 2, 3,
+	3, 3, 4, 4, 4, 10, 10, 2, 3, 3, 3, 8, 8, 0, 5, 5,
+	4, 4, 7, 4, 7, 0, 3, 3, 3, 5, 4, 4, 10, 0, 3, 0,
+	3, 0, 8, 4, 4, 4, 2, 10, 3, 3, 3, 8, 8, 0, 5, 4,
+	4, 4, 2, 10, 3, 3, 3, 8, 0, 5, 5, 4, 5, 4, 2, 5,
+	3, 0, 3, 4, 0, 5, 5, 3, 5, 5, 0, 5, 5, 5, 4, 5,
+	4, 4, 7, 2, 3, 3, 3, 4, 0, 5, 5, 3, 5, 5, 0, 5,
+	0, 0, 4, 0, 3, 0, 8, 8, 0, 4, 0, 3, 0, 8, 8, 0,
+	4, 4, 10, 0, 3, 0, 3, 0, 8, 8, 5, 4, 4, 0, 4, 2,
+	10, 3, 3, 8, 3, 4, 4, 10, 0, 3, 0, 3, 0, 8, 8, 0,
+	5, 4, 4, 0, 4, 2, 10, 3, 3, 3, 8, 5, 4, 4, 2, 8,
+	3, 3, 8, 8, 5, 4, 4, 2, 8, 3, 3, 8, 8, 0, 8, 4,
+	0, 8, 8, 8, 3, 5, 0, 5, 5, 5, 4, 0, 5, 3, 8, 4,
+	0, 8, 8, 0, 8, 3, 5, 0, 5, 5, 5, 4, 0, 5, 0, 3,
+	0, 5, 5, 5, 0, 5, 0, 5, 5, 5, 4, 5, 0, 3, 8, 4,
+	0, 8, 8, 8, 3, 5, 0, 0, 5, 5, 5, 4, 0, 5, 3, 0,
+	8, 4, 0, 8, 8, 0, 8, 3, 5, 0, 0, 5, 5, 5, 4, 0,
+	5, 0, 3, 0, 0, 5, 5, 5, 0, 5, 0, 0, 5, 5, 5, 4,
+	5, 0, 3, 0, 0, 5, 5, 5, 4, 4, 2, 5, 3, 0, 3, 0,
+	5, 5, 5, 4, 4, 7, 3, 0, 3, 0, 8, 8, 4, 8, 0, 8,
+	0, 5, 0, 3, 0, 5, 5, 5, 4, 4, 7, 3, 0, 3, 0, 4,
+	4, 2, 3, 0, 3, 0, 8, 8, 4, 4, 2, 3, 0, 3, 0, 8,
+	8, 0, 0, 8, 8, 8, 0, 8, 8, 0, 8, 0, 8, 8, 8, 0,
+	0, 8, 8, 0, 8, 0, 0, 8, 8, 4, 8, 0, 3, 8, 4, 0,
+	8, 8, 0, 3, 4, 8, 0, 3, 0, 8, 8, 8, 0, 5, 5, 4,
+	4, 2, 5, 3, 5, 3, 4, 8, 0, 3, 0, 8, 8, 0, 8, 8,
+	4, 4, 8, 0, 3, 0, 8, 3, 8, 0, 5, 5, 4, 0, 5, 3,
+	5, 0, 5, 5, 4, 4, 7, 3, 5, 0, 3, 4, 8, 0, 3, 0,
+	8, 8, 8, 0, 0, 5, 5, 4, 4, 2, 5, 3, 5, 3, 0, 4,
+	8, 0, 3, 0, 8, 8, 0, 8, 0, 8, 4, 4, 8, 0, 3, 0,
+	8, 8, 3, 0, 5, 5, 4, 0, 5, 3, 5, 0, 0, 5, 5, 4,
+	4, 7, 3, 5, 0, 3, 0, 4, 8, 0, 3, 0, 8, 8, 4, 8,
+	0, 3, 8, 4, 4, 8, 0, 3, 0, 8, 8, 0, 3, 0, 4, 8,
+	0, 3, 8, 4, 0, 8, 8, 0, 3, 8, 4, 4, 8, 0, 3, 0,
+	8, 8, 0, 3, 5, 4, 0, 4, 2, 8, 3, 3, 8, 8, 5, 4,
+	0, 4, 2, 8, 3, 3, 8, 8, 0, 0, 5, 5, 0, 5, 5, 0,
+	5, 5, 0, 5, 5, 4, 0, 3, 0, 5, 5, 0, 5, 5, 0, 8,
+	4, 0, 5, 5, 0, 5, 5, 3, 0, 5, 5, 0, 5, 5, 0, 4,
+	0, 3, 8, 4, 0, 5, 5, 0, 5, 5, 0, 3, 8, 4, 5, 5,
+	3, 5, 5, 5, 4, 4, 0, 5, 3, 3, 4, 8, 0, 3, 8, 8,
+	0, 8, 8, 5, 5, 4, 4, 0, 5, 0, 3, 3, 5, 5, 4, 0,
+	5, 3, 5, 5, 4, 4, 5, 0, 3, 3, 8, 4, 5, 5, 3, 5,
+	4, 0, 3, 5, 5, 4, 4, 0, 5, 3, 0, 3, 8, 8, 4, 4,
+	5, 5, 3, 5, 3, 0, 8, 4, 8, 4, 5, 5, 3, 5, 3, 0,
+	5, 5, 4, 0, 5, 0, 3, 5, 5, 4, 4, 5, 0, 3, 0, 3,
+	5, 5, 4, 4, 4, 2, 5, 3, 0, 3, 3, 5, 5, 4, 0, 4,
+	0, 5, 0, 3, 3, 4, 8, 0, 3, 8, 4, 8, 8, 0, 3, 8,
+	5, 5, 4, 0, 4, 0, 5, 0, 3, 0, 3, 4, 0, 4, 2, 3,
+	0, 8, 8, 3, 4, 0, 4, 2, 3, 0, 8, 8, 0, 3, 5, 5,
+	0, 5, 5, 5, 4, 5, 4, 0, 3, 3, 5, 5, 4, 5, 0, 3,
+	8, 4, 5, 5, 0, 5, 3, 0, 5, 5, 4, 5, 0, 4, 0, 3,
+	3, 8, 4, 5, 5, 4, 7, 0, 3, 3, 8, 4, 5, 5, 3, 5,
+	0, 5, 5, 4, 4, 2, 5, 3, 3, 4, 8, 0, 3, 8, 8, 0,
+	8, 8, 0, 5, 5, 4, 4, 2, 5, 0, 3, 3, 5, 5, 4, 0,
+	5, 3, 0, 5, 5, 4, 4, 7, 0, 3, 3, 8, 4, 5, 5, 3,
+	5, 4, 0, 3, 0, 5, 5, 4, 4, 4, 7, 3, 3, 3, 8, 8,
+	4, 4, 5, 5, 3, 5, 3, 8, 4, 8, 4, 5, 5, 3, 5, 3,
+	5, 5, 4, 0, 5, 0, 3, 0, 8, 4, 5, 5, 4, 0, 5, 3,
+	3, 5, 5, 4, 4, 4, 0, 7, 3, 0, 3, 3, 5, 5, 4, 4,
+	4, 7, 3, 0, 3, 3, 4, 8, 0, 3, 8, 4, 8, 8, 0, 8,
+	3, 8, 4, 4, 8, 0, 3, 8, 8, 0, 8, 3, 4, 0, 4, 2,
+	3, 0, 8, 3, 8, 8, 4, 5, 5, 4, 0, 5, 0, 3, 3, 5,
+	5, 0, 5, 0, 5, 5, 4, 5, 4, 2, 3, 3, 5, 5, 4, 5,
+	0, 3, 0, 8, 4, 5, 5, 0, 5, 3, 5, 5, 4, 5, 0, 4,
+	2, 3, 3, 8, 4, 5, 5, 4, 5, 0, 3, 3, 8, 4, 5, 5,
+	3, 5, 0, 4, 0, 3, 5, 5, 4, 4, 2, 5, 3, 0, 3, 8,
+	8, 4, 4, 5, 5, 3, 5, 0, 3, 0, 5, 5, 4, 4, 2, 5,
+	0, 3, 0, 3, 5, 5, 4, 4, 7, 3, 0, 3, 5, 5, 4, 4,
+	7, 0, 3, 0, 3, 8, 4, 5, 5, 3, 5, 0, 4, 0, 3, 0,
+	5, 5, 4, 4, 2, 5, 3, 0, 3, 0, 8, 8, 4, 4, 5, 5,
+	3, 5, 0, 3, 8, 4, 8, 4, 5, 5, 3, 5, 0, 3, 5, 5,
+	4, 4, 7, 3, 0, 3, 0, 5, 5, 4, 4, 7, 0, 3, 0, 3,
+	0, 5, 5, 4, 4, 4, 0, 7, 3, 0, 3, 0, 3, 4, 4, 7,
+	5, 3, 5, 3, 5, 0, 5, 4, 8, 0, 3, 8, 4, 8, 8, 0,
+	8, 0, 3, 4, 4, 7, 5, 3, 5, 3, 5, 0, 5, 0, 4, 0,
+	4, 2, 3, 0, 3, 8, 8, 4, 0, 4, 2, 3, 0, 3, 8, 8,
+	0, 5, 5, 0, 5, 0, 4, 0, 3, 8, 4, 5, 5, 0, 5, 0,
+	3, 0, 5, 5, 0, 5, 0, 4, 0, 3, 0, 8, 4, 5, 5, 0,
+	5, 0, 3, 5, 5, 4, 5, 0, 4, 2, 3, 0, 3, 8, 4, 5,
+	5, 4, 5, 0, 3, 0, 3, 4, 0, 4, 10, 0, 3, 3, 8, 8,
+	8, 4, 0, 5, 3, 5, 5, 4, 0, 5, 3, 4, 0, 4, 10, 0,
+	3, 3, 8, 8, 0, 8, 4, 0, 5, 3, 5, 5, 4, 0, 5, 0,
+	3, 4, 0, 5, 3, 5, 5, 0, 5, 4, 0, 5, 3, 5, 5, 4,
+	5, 0, 3, 4, 0, 4, 10, 0, 3, 3, 8, 8, 8, 0, 4, 0,
+	5, 3, 5, 5, 4, 0, 5, 3, 0, 4, 0, 4, 10, 0, 3, 3,
+	8, 8, 0, 8, 0, 5, 5, 4, 4, 4, 10, 8, 3, 3, 3, 8,
+	4, 0, 5, 3, 5, 5, 0, 5, 0, 4, 0, 5, 3, 5, 5, 4,
+	5, 0, 3, 0, 5, 5, 5, 4, 4, 4, 10, 0, 5, 3, 3, 3,
+	4, 5, 4, 4, 2, 10, 3, 3, 3, 8, 8, 5, 0, 5, 5, 4,
+	4, 4, 7, 2, 3, 3, 3, 4, 5, 4, 4, 2, 10, 3, 3, 3,
+	8, 8, 0, 4, 0, 4, 2, 3, 0, 3, 0, 8, 8, 4, 0, 4,
+	2, 3, 0, 3, 0, 8, 8, 0, 4, 0, 3, 0, 8, 8, 8, 4,
+	0, 3, 0, 8, 8, 0, 8, 4, 0, 3, 0, 8, 8, 8, 0, 4,
+	0, 3, 0, 8, 8, 0, 8, 0, 4, 0, 3, 0, 8, 8, 4, 8,
+	0, 3, 4, 0, 3, 8, 4, 0, 8, 8, 0, 3, 5, 5, 5, 8,
+	8, 0, 8, 8, 8, 8, 8, 0, 8, 8, 8, 0, 8, 0, 8, 8,
+	8, 4, 8, 0, 3, 8, 8, 4, 8, 8, 0, 3, 8, 5, 5, 5,
+	0, 8, 8, 0, 8, 8, 0, 8, 8, 8, 0, 8, 0, 8, 4, 8,
+	8, 8, 3, 8, 8, 4, 8, 0, 8, 3, 8, 4, 8, 8, 0, 8,
+	3, 5, 5, 5, 0, 4, 0, 3, 8, 4, 8, 8, 8, 0, 3, 0,
+	8, 8, 4, 8, 8, 0, 3, 8, 4, 8, 8, 8, 0, 3, 8, 8,
+	4, 8, 0, 8, 0, 3, 8, 4, 8, 8, 0, 8, 0, 3, 8, 8,
+	8, 4, 4, 8, 0, 3, 3, 8, 4, 8, 8, 4, 10, 0, 3, 3,
+	8, 8, 4, 8, 4, 8, 0, 3, 3, 8, 4, 8, 8, 4, 8, 0,
+	3, 3, 8, 8, 4, 4, 8, 8, 0, 3, 3, 8, 4, 8, 4, 8,
+	8, 0, 3, 3, 8, 0, 5, 5, 5, 8, 4, 8, 0, 3, 8, 8,
+	8, 8, 0, 8, 8, 0, 8, 8, 8, 4, 8, 0, 8, 3, 8, 8,
+	5, 4, 4, 2, 5, 3, 5, 3, 5, 4, 4, 4, 7, 2, 3, 7,
+	3, 3, 8, 0, 8, 8, 8, 0, 8, 8, 4, 8, 0, 3, 8, 8,
+	0, 8, 8, 0, 8, 8, 0, 8, 0, 8, 8, 4, 8, 0, 8, 8,
+	3, 8, 5, 4, 4, 2, 5, 3, 5, 0, 3, 8, 4, 8, 4, 8,
+	0, 3, 8, 3, 8, 8, 0, 8, 8, 4, 8, 0, 3, 8, 8, 4,
+	8, 0, 8, 8, 0, 3, 0, 8, 8, 8, 4, 0, 8, 8, 0, 3,
+	8, 8, 4, 8, 0, 8, 8, 0, 3, 8, 5, 4, 4, 10, 0, 8,
+	8, 3, 5, 3, 8, 4, 8, 4, 8, 0, 8, 3, 3, 8, 5, 4,
+	0, 5, 3, 5, 5, 4, 4, 7, 3, 5, 4, 0, 3, 3, 5, 4,
+	4, 7, 3, 5, 0, 3, 8, 4, 5, 4, 0, 5, 3, 5, 3, 0,
+	5, 4, 4, 7, 3, 5, 0, 4, 0, 3, 3, 8, 4, 5, 4, 4,
+	7, 3, 5, 0, 3, 3, 8, 0, 5, 5, 5, 0, 8, 4, 8, 0,
+	3, 8, 8, 8, 0, 8, 0, 8, 8, 0, 8, 8, 0, 8, 4, 8,
+	0, 8, 3, 8, 8, 0, 5, 4, 4, 2, 5, 3, 5, 3, 0, 5,
+	4, 4, 4, 7, 2, 3, 5, 3, 3, 8, 0, 8, 8, 8, 0, 8,
+	0, 8, 4, 8, 0, 3, 8, 8, 0, 8, 0, 8, 8, 4, 0, 8,
+	8, 8, 3, 8, 4, 8, 0, 8, 8, 8, 3, 5, 4, 4, 2, 5,
+	3, 5, 0, 3, 0, 8, 4, 8, 4, 8, 0, 3, 8, 8, 3, 8,
+	0, 8, 8, 4, 8, 0, 8, 3, 8, 4, 8, 8, 4, 2, 8, 3,
+	8, 3, 8, 8, 4, 0, 8, 8, 0, 8, 3, 8, 4, 8, 0, 8,
+	8, 0, 8, 3, 8, 8, 4, 4, 8, 0, 8, 3, 8, 3, 8, 4,
+	8, 4, 8, 0, 8, 3, 8, 3, 5, 4, 0, 5, 3, 5, 0, 5,
+	4, 4, 7, 3, 5, 4, 2, 3, 3, 5, 4, 4, 7, 3, 5, 0,
+	3, 0, 8, 4, 5, 4, 0, 5, 3, 5, 3, 5, 4, 4, 7, 3,
+	5, 0, 4, 2, 3, 3, 8, 4, 5, 0, 4, 0, 5, 5, 0, 3,
+	3, 8, 0, 5, 5, 5, 0, 4, 0, 3, 8, 4, 8, 0, 3, 8,
+	8, 4, 8, 0, 3, 8, 8, 4, 0, 8, 8, 8, 0, 3, 0, 8,
+	4, 8, 0, 8, 8, 8, 0, 3, 0, 5, 4, 4, 4, 7, 3, 3,
+	5, 0, 3, 5, 4, 4, 4, 7, 2, 3, 5, 3, 0, 3, 8, 0,
+	8, 8, 4, 8, 8, 0, 3, 8, 4, 8, 0, 3, 8, 4, 8, 8,
+	0, 3, 8, 8, 4, 0, 8, 8, 8, 0, 3, 8, 4, 8, 0, 8,
+	8, 8, 0, 3, 5, 4, 4, 4, 7, 3, 3, 5, 0, 3, 0, 8,
+	4, 8, 4, 8, 0, 3, 8, 8, 0, 3, 8, 0, 8, 8, 4, 8,
+	0, 8, 0, 3, 8, 4, 8, 8, 4, 2, 8, 8, 3, 3, 8, 8,
+	4, 0, 8, 8, 0, 8, 0, 3, 8, 4, 8, 0, 8, 8, 0, 8,
+	0, 3, 4, 4, 7, 5, 3, 5, 5, 3, 5, 4, 4, 7, 5, 3,
+	5, 5, 3, 5, 0, 4, 0, 4, 2, 3, 8, 3, 8, 8, 8, 4,
+	5, 4, 0, 5, 3, 5, 0, 3, 0, 4, 0, 4, 2, 3, 8, 3,
+	8, 8, 0, 8, 4, 5, 4, 0, 5, 3, 5, 0, 3, 4, 4, 7,
+	0, 5, 3, 5, 5, 3, 5, 4, 4, 7, 0, 5, 3, 5, 5, 3,
+	5, 0, 4, 0, 8, 0, 3, 0, 8, 8, 8, 4, 4, 7, 3, 5,
+	4, 2, 5, 3, 5, 3, 4, 0, 8, 0, 3, 0, 8, 8, 0, 8,
+	8, 4, 8, 0, 8, 8, 4, 10, 0, 3, 3, 4, 4, 7, 3, 5,
+	0, 5, 3, 5, 4, 4, 7, 3, 5, 4, 7, 3, 5, 0, 3, 4,
+	0, 8, 0, 3, 0, 8, 8, 8, 0, 4, 4, 7, 3, 5, 4, 2,
+	5, 3, 5, 3, 0, 4, 0, 8, 0, 3, 0, 8, 8, 0, 8, 0,
+	8, 4, 8, 0, 8, 8, 4, 8, 0, 3, 3, 4, 4, 7, 3, 5,
+	0, 5, 3, 5, 0, 4, 4, 7, 3, 5, 4, 7, 3, 5, 0, 3,
+	0, 8, 8, 8, 4, 4, 0, 8, 8, 0, 3, 3, 8, 4, 8, 8,
+	4, 2, 8, 8, 0, 3, 3, 8, 8, 4, 8, 4, 0, 8, 8, 0,
+	3, 3, 8, 4, 8, 8, 4, 0, 8, 8, 0, 3, 3, 4, 4, 2,
+	5, 5, 3, 5, 5, 3, 5, 4, 4, 2, 5, 5, 3, 5, 5, 3,
+	5, 0, 0, 4, 0, 8, 8, 8, 3, 5, 0, 4, 0, 8, 8, 0,
+	8, 3, 5, 0, 4, 0, 8, 8, 8, 3, 5, 0, 0, 4, 0, 8,
+	8, 0, 8, 3, 5, 0, 0, 4, 0, 8, 8, 4, 10, 3, 5, 0,
+	3, 8, 4, 0, 4, 0, 8, 8, 3, 5, 0, 3, 5, 0, 5, 5,
+	4, 0, 3, 8, 8, 0, 8, 8, 5, 0, 5, 5, 4, 0, 3, 8,
+	4, 5, 0, 5, 5, 3, 0, 5, 0, 5, 5, 4, 0, 4, 0, 3,
+	3, 8, 4, 5, 0, 5, 5, 4, 2, 3, 3, 5, 0, 5, 5, 0,
+	4, 0, 3, 8, 8, 0, 8, 8, 0, 5, 0, 5, 5, 4, 0, 3,
+	0, 8, 4, 5, 0, 5, 5, 3, 5, 0, 5, 5, 4, 0, 4, 2,
+	3, 3, 8, 4, 5, 0, 5, 5, 4, 0, 3, 3, 5, 0, 5, 5,
+	0, 4, 0, 3, 8, 4, 5, 0, 5, 5, 0, 3, 0, 5, 0, 5,
+	5, 0, 4, 0, 3, 0, 8, 4, 5, 0, 5, 5, 0, 3, 8, 8,
+	4, 4, 5, 0, 5, 5, 3, 3, 8, 4, 8, 4, 5, 0, 5, 5,
+	3, 3, 4, 4, 2, 5, 3, 5, 5, 3, 5, 8, 4, 5, 0, 5,
+	5, 0, 4, 2, 3, 3, 4, 4, 2, 5, 3, 5, 5, 3, 5, 0,
+	8, 4, 5, 0, 5, 5, 0, 4, 0, 3, 3, 8, 8, 4, 4, 5,
+	0, 5, 5, 0, 3, 3, 8, 4, 8, 4, 5, 0, 5, 5, 0, 3,
+	3, 8, 0, 5, 5, 8, 8, 4, 5, 5, 3, 5, 8, 0, 8, 8,
+	0, 8, 8, 8, 8, 4, 8, 0, 8, 3, 8, 8, 8, 5, 4, 4,
+	0, 5, 3, 3, 5, 4, 4, 4, 5, 0, 3, 3, 3, 8, 0, 8,
+	8, 8, 0, 8, 8, 5, 4, 4, 4, 0, 5, 3, 0, 3, 3, 8,
+	0, 8, 8, 0, 8, 0, 8, 8, 4, 4, 10, 8, 3, 5, 5, 0,
+	3, 5, 4, 4, 0, 5, 0, 3, 3, 5, 4, 4, 4, 5, 0, 3,
+	0, 3, 3, 4, 4, 2, 8, 0, 5, 3, 5, 5, 3, 4, 4, 4,
+	7, 2, 3, 7, 5, 3, 3, 8, 8, 4, 0, 8, 8, 0, 3, 8,
+	8, 8, 4, 8, 0, 8, 8, 0, 3, 8, 8, 0, 4, 0, 4, 0,
+	8, 8, 3, 3, 0, 4, 0, 4, 0, 8, 8, 0, 3, 3, 5, 4,
+	0, 5, 3, 5, 4, 4, 5, 4, 0, 3, 3, 3, 5, 4, 4, 5,
+	0, 3, 3, 8, 4, 5, 4, 2, 5, 3, 0, 3, 5, 4, 4, 5,
+	0, 4, 0, 3, 3, 3, 8, 4, 5, 4, 4, 7, 2, 3, 3, 3,
+	0, 8, 0, 5, 5, 4, 0, 3, 5, 4, 4, 4, 2, 5, 3, 3,
+	3, 8, 0, 8, 8, 0, 8, 8, 0, 8, 5, 4, 4, 4, 2, 5,
+	0, 3, 3, 3, 5, 4, 4, 0, 5, 3, 0, 3, 5, 4, 4, 4,
+	5, 2, 3, 3, 3, 8, 0, 8, 8, 8, 0, 8, 0, 8, 5, 4,
+	4, 0, 4, 2, 5, 3, 3, 3, 8, 8, 4, 0, 5, 5, 3, 0,
+	8, 0, 8, 0, 5, 5, 0, 5, 4, 4, 0, 5, 0, 3, 0, 3,
+	8, 8, 8, 4, 5, 0, 5, 3, 5, 0, 8, 0, 8, 8, 4, 8,
+	0, 8, 3, 8, 4, 4, 4, 7, 2, 3, 7, 5, 3, 0, 3, 8,
+	8, 4, 0, 8, 8, 0, 8, 3, 8, 4, 5, 5, 0, 5, 5, 3,
+	5, 5, 0, 0, 4, 0, 4, 0, 8, 3, 8, 3, 0, 4, 0, 4,
+	0, 8, 8, 0, 3, 0, 3, 5, 4, 0, 5, 0, 3, 5, 4, 4,
+	5, 4, 2, 3, 3, 3, 5, 4, 4, 5, 0, 3, 0, 3, 8, 4,
+	5, 4, 2, 5, 3, 3, 5, 4, 4, 5, 0, 4, 2, 3, 3, 3,
+	8, 4, 5, 4, 4, 5, 0, 3, 3, 3, 0, 8, 0, 5, 5, 4,
+	0, 4, 0, 3, 3, 5, 4, 4, 4, 2, 5, 3, 0, 3, 3, 8,
+	8, 4, 0, 5, 5, 4, 2, 3, 0, 3, 4, 4, 2, 8, 8, 3,
+	5, 5, 0, 3, 5, 4, 0, 4, 0, 5, 0, 3, 3, 5, 4, 4,
+	4, 5, 2, 3, 0, 3, 3, 8, 0, 8, 8, 4, 8, 8, 0, 3,
+	8, 5, 4, 4, 4, 2, 5, 3, 0, 3, 0, 3, 8, 8, 4, 0,
+	5, 5, 4, 2, 3, 3, 4, 4, 2, 8, 8, 3, 5, 5, 3, 5,
+	4, 0, 4, 0, 5, 0, 3, 0, 3, 4, 5, 0, 5, 5, 0, 5,
+	3, 5, 5, 0, 8, 4, 4, 8, 0, 8, 3, 5, 3, 5, 0, 4,
+	4, 7, 5, 3, 5, 0, 5, 3, 8, 8, 4, 0, 8, 8, 0, 8,
+	0, 3, 8, 4, 4, 7, 5, 3, 5, 0, 5, 0, 3, 4, 4, 7,
+	5, 3, 5, 5, 3, 4, 4, 7, 5, 3, 5, 5, 0, 3, 0, 4,
+	0, 8, 0, 8, 8, 3, 8, 4, 5, 4, 2, 5, 0, 3, 0, 3,
+	0, 4, 0, 8, 0, 8, 8, 0, 3, 8, 4, 5, 4, 2, 5, 0,
+	3, 3, 4, 4, 7, 0, 5, 3, 5, 5, 3, 4, 4, 7, 0, 5,
+	3, 5, 5, 0, 3, 4, 0, 8, 0, 5, 3, 5, 5, 4, 4, 7,
+	3, 5, 4, 0, 5, 3, 3, 4, 4, 10, 0, 3, 0, 8, 8, 0,
+	8, 3, 4, 4, 7, 3, 5, 4, 0, 5, 0, 3, 3, 4, 4, 7,
+	3, 5, 0, 5, 3, 4, 4, 7, 3, 5, 4, 5, 0, 3, 3, 4,
+	4, 10, 0, 5, 3, 5, 5, 0, 3, 4, 4, 7, 3, 5, 4, 0,
+	5, 3, 0, 3, 4, 0, 8, 8, 4, 2, 5, 3, 5, 5, 3, 0,
+	4, 0, 8, 0, 8, 0, 5, 3, 5, 5, 0, 4, 4, 7, 3, 5,
+	0, 5, 0, 3, 4, 4, 7, 3, 5, 4, 5, 0, 3, 0, 3, 5,
+	4, 4, 4, 4, 7, 2, 3, 3, 10, 3, 3, 4, 4, 2, 5, 5,
+	3, 5, 0, 5, 3, 4, 4, 4, 4, 2, 10, 3, 3, 3, 8, 8,
+	3, 4, 4, 2, 5, 5, 3, 5, 0, 5, 0, 3, 4, 4, 2, 5,
+	5, 3, 5, 5, 3, 4, 4, 2, 5, 5, 3, 5, 5, 0, 3, 0,
+	4, 0, 8, 8, 8, 3, 0, 4, 0, 8, 8, 0, 8, 3, 0, 4,
+	0, 8, 8, 8, 0, 3, 0, 4, 0, 8, 8, 0, 8, 0, 3, 0,
+	4, 0, 8, 8, 4, 8, 0, 3, 3, 0, 4, 8, 4, 0, 8, 8,
+	0, 3, 3, 5, 0, 5, 0, 4, 8, 8, 0, 8, 8, 3, 5, 4,
+	5, 4, 0, 3, 3, 8, 4, 5, 4, 7, 3, 0, 3, 5, 4, 5,
+	4, 0, 4, 0, 3, 3, 3, 8, 4, 5, 4, 7, 4, 2, 3, 3,
+	3, 5, 4, 5, 0, 3, 0, 4, 8, 8, 0, 8, 8, 0, 3, 5,
+	4, 5, 4, 0, 3, 0, 3, 8, 4, 5, 0, 5, 3, 0, 5, 4,
+	5, 4, 0, 4, 2, 3, 3, 3, 8, 4, 5, 4, 7, 4, 0, 3,
+	3, 3, 5, 4, 5, 0, 4, 0, 3, 3, 8, 4, 5, 4, 7, 0,
+	3, 0, 3, 5, 4, 5, 0, 4, 0, 3, 0, 3, 8, 4, 5, 4,
+	7, 0, 3, 3, 8, 8, 4, 4, 5, 4, 7, 3, 3, 3, 8, 4,
+	8, 4, 5, 4, 7, 3, 3, 3, 4, 4, 2, 5, 3, 5, 5, 3,
+	4, 4, 2, 3, 0, 8, 8, 0, 8, 3, 4, 4, 2, 5, 3, 5,
+	5, 0, 3, 4, 4, 2, 3, 0, 8, 8, 0, 8, 0, 3, 8, 8,
+	4, 4, 5, 4, 7, 0, 3, 3, 3, 8, 4, 8, 4, 5, 4, 7,
+	0, 3, 3, 3, 8, 0, 5, 5, 0, 8, 8, 4, 5, 5, 3, 5,
+	0, 8, 0, 8, 8, 0, 8, 8, 8, 0, 8, 4, 8, 0, 8, 3,
+	8, 8, 8, 0, 5, 4, 4, 2, 5, 3, 3, 5, 4, 4, 4, 5,
+	0, 3, 3, 3, 0, 8, 0, 8, 8, 8, 0, 8, 8, 0, 5, 4,
+	4, 4, 2, 7, 3, 0, 3, 3, 8, 0, 8, 8, 0, 8, 0, 8,
+	8, 0, 4, 4, 10, 8, 3, 5, 5, 0, 3, 0, 5, 4, 4, 2,
+	5, 0, 3, 3, 5, 4, 4, 4, 5, 0, 3, 2, 3, 3, 4, 4,
+	2, 8, 0, 5, 3, 5, 5, 3, 0, 4, 4, 4, 7, 2, 3, 5,
+	5, 3, 3, 8, 8, 4, 0, 8, 8, 0, 3, 8, 8, 0, 8, 4,
+	8, 0, 8, 8, 0, 3, 8, 8, 0, 5, 4, 4, 10, 0, 8, 8,
+	3, 3, 5, 4, 4, 10, 0, 8, 8, 0, 3, 3, 5, 4, 0, 5,
+	3, 0, 5, 4, 4, 7, 4, 0, 3, 3, 3, 5, 4, 4, 7, 0,
+	3, 3, 8, 4, 5, 4, 2, 5, 3, 0, 3, 0, 5, 4, 4, 7,
+	0, 4, 0, 3, 3, 3, 8, 4, 5, 4, 4, 7, 2, 3, 3, 3,
+	8, 0, 5, 5, 4, 0, 3, 0, 5, 4, 4, 4, 0, 7, 3, 3,
+	3, 8, 0, 8, 8, 0, 8, 8, 0, 8, 0, 5, 4, 4, 4, 0,
+	7, 0, 3, 3, 3, 5, 4, 4, 4, 7, 3, 3, 3, 5, 4, 4,
+	4, 7, 0, 3, 3, 3, 8, 0, 8, 8, 4, 8, 8, 8, 3, 5,
+	4, 4, 4, 4, 7, 3, 3, 3, 3, 8, 8, 4, 0, 5, 5, 3,
+	8, 0, 8, 0, 5, 5, 5, 4, 4, 0, 5, 0, 3, 0, 3, 0,
+	8, 8, 8, 4, 5, 0, 5, 3, 5, 8, 0, 8, 8, 4, 8, 0,
+	8, 8, 3, 4, 4, 7, 5, 3, 5, 4, 7, 0, 3, 3, 8, 8,
+	4, 0, 8, 8, 0, 8, 8, 3, 4, 5, 5, 0, 5, 5, 3, 5,
+	5, 0, 4, 0, 4, 0, 8, 3, 3, 8, 8, 4, 5, 4, 4, 0,
+	5, 0, 3, 3, 3, 5, 4, 0, 5, 0, 3, 0, 5, 4, 4, 5,
+	5, 0, 3, 3, 8, 5, 4, 4, 5, 0, 3, 0, 3, 0, 8, 4,
+	5, 4, 0, 5, 3, 3, 5, 4, 4, 5, 0, 5, 0, 3, 3, 8,
+	8, 4, 5, 4, 4, 5, 0, 3, 3, 3, 8, 0, 5, 5, 4, 0,
+	4, 2, 3, 3, 5, 4, 4, 4, 0, 7, 3, 0, 3, 3, 4, 5,
+	5, 4, 7, 3, 5, 0, 5, 0, 3, 4, 5, 5, 4, 7, 3, 5,
+	5, 0, 3, 5, 4, 4, 4, 7, 3, 0, 3, 3, 5, 4, 4, 4,
+	7, 0, 3, 0, 3, 3, 8, 0, 8, 8, 4, 8, 8, 0, 8, 3,
+	5, 4, 4, 4, 4, 7, 3, 3, 0, 3, 3, 8, 8, 4, 0, 5,
+	5, 4, 0, 3, 3, 4, 4, 0, 3, 8, 8, 3, 5, 5, 5, 4,
+	0, 4, 0, 5, 0, 3, 0, 3, 0, 4, 5, 0, 5, 5, 0, 5,
+	3, 5, 5, 8, 4, 4, 8, 0, 8, 3, 5, 3, 5, 4, 8, 0,
+	8, 8, 3, 5, 0, 5, 8, 8, 4, 8, 4, 0, 5, 5, 3, 0,
+	3, 4, 4, 7, 5, 3, 5, 0, 5, 0, 3, 0, 4, 8, 0, 8,
+	8, 3, 5, 5, 4, 4, 7, 5, 3, 5, 5, 0, 3, 0, 0, 4,
+	0, 8, 0, 8, 3, 8, 5, 4, 4, 5, 4, 2, 3, 2, 3, 3,
+	0, 4, 0, 8, 0, 8, 8, 0, 3, 0, 8, 4, 5, 4, 0, 5,
+	0, 3, 3, 4, 4, 7, 0, 5, 3, 5, 5, 3, 0, 4, 4, 7,
+	0, 5, 3, 5, 5, 0, 3, 0, 4, 0, 8, 0, 5, 3, 5, 5,
+	0, 4, 4, 7, 3, 5, 4, 2, 5, 3, 3, 4, 4, 10, 0, 3,
+	0, 8, 8, 0, 3, 8, 4, 4, 7, 3, 5, 4, 2, 5, 0, 3,
+	3, 4, 4, 7, 3, 5, 0, 5, 3, 0, 4, 4, 7, 3, 5, 4,
+	7, 0, 3, 3, 4, 4, 10, 0, 5, 3, 5, 5, 0, 3, 0, 4,
+	4, 7, 3, 5, 4, 4, 7, 3, 3, 3, 4, 0, 8, 8, 4, 2,
+	5, 3, 5, 5, 3, 4, 0, 8, 0, 8, 0, 5, 3, 5, 5, 4,
+	4, 7, 3, 5, 0, 5, 0, 3, 0, 4, 4, 10, 4, 7, 3, 5,
+	0, 5, 3, 3, 4, 5, 0, 5, 5, 3, 5, 4, 0, 5, 0, 3,
+	4, 4, 2, 5, 5, 3, 5, 0, 5, 3, 0, 5, 4, 5, 4, 4,
+	4, 7, 2, 3, 3, 3, 3, 4, 5, 4, 0, 5, 5, 3, 5, 3,
+	5, 5, 4, 4, 2, 5, 5, 3, 5, 5, 3, 0, 4, 4, 2, 5,
+	5, 3, 5, 5, 0, 3, 0, 0, 4, 0, 8, 8, 3, 8, 0, 4,
+	0, 8, 8, 0, 3, 8, 0, 4, 0, 8, 8, 8, 0, 3, 0, 8,
+	4, 0, 4, 0, 8, 8, 3, 3, 0, 4, 0, 8, 8, 4, 10, 0,
+	3, 3, 8, 4, 0, 4, 0, 8, 8, 0, 3, 3, 5, 0, 5, 0,
+	0, 4, 8, 8, 0, 8, 3, 8, 5, 4, 5, 4, 2, 3, 3, 8,
+	4, 5, 4, 7, 3, 0, 3, 0, 5, 4, 5, 4, 2, 4, 0, 3,
+	3, 3, 0, 4, 8, 4, 8, 8, 0, 3, 3, 8, 5, 4, 5, 0,
+	3, 0, 5, 4, 5, 5, 4, 2, 8, 3, 3, 8, 8, 4, 5, 5,
+	0, 5, 3, 8, 4, 5, 0, 5, 3, 0, 4, 8, 8, 4, 10, 0,
+	8, 3, 3, 8, 4, 5, 4, 5, 4, 0, 3, 3, 3, 5, 4, 5,
+	0, 4, 2, 3, 3, 8, 4, 5, 4, 7, 0, 3, 0, 3, 0, 5,
+	4, 5, 0, 4, 0, 3, 0, 3, 0, 8, 4, 5, 4, 5, 0, 3,
+	3, 8, 8, 4, 4, 5, 0, 5, 3, 0, 3, 8, 4, 8, 4, 5,
+	0, 5, 3, 0, 3, 4, 4, 2, 5, 3, 5, 5, 3, 0, 4, 4,
+	2, 3, 0, 8, 8, 0, 3, 8, 4, 4, 2, 5, 3, 5, 5, 0,
+	3, 0, 8, 4, 5, 4, 5, 0, 4, 0, 3, 3, 3, 8, 8, 4,
+	4, 5, 4, 5, 2, 3, 3, 3, 8, 4, 8, 4, 5, 4, 5, 2,
+	3, 3, 3, 8, 0, 5, 5, 0, 4, 0, 3, 5, 4, 4, 4, 2,
+	7, 3, 3, 0, 3, 0, 4, 8, 0, 8, 8, 0, 3, 8, 8, 5,
+	4, 4, 4, 2, 7, 2, 3, 3, 3, 5, 4, 4, 2, 5, 3, 0,
+	3, 5, 4, 4, 4, 7, 2, 3, 3, 3, 0, 8, 0, 5, 5, 4,
+	4, 2, 3, 0, 3, 5, 4, 4, 2, 4, 2, 5, 3, 3, 3, 8,
+	8, 4, 0, 5, 5, 0, 3, 0, 4, 0, 8, 8, 3, 5, 5, 0,
+	5, 4, 4, 2, 5, 0, 3, 0, 3, 8, 4, 5, 4, 4, 0, 7,
+	3, 3, 3, 4, 4, 4, 10, 0, 3, 2, 8, 3, 8, 3, 4, 4,
+	4, 7, 2, 3, 5, 5, 3, 0, 3, 4, 5, 4, 2, 5, 5, 3,
+	5, 0, 5, 3, 4, 5, 4, 2, 5, 5, 3, 5, 5, 3, 5, 4,
+	4, 10, 0, 8, 3, 8, 3, 5, 4, 4, 10, 0, 8, 8, 0, 3,
+	0, 3, 5, 4, 4, 7, 3, 0, 3, 5, 4, 4, 7, 4, 2, 3,
+	3, 3, 5, 4, 4, 7, 0, 3, 0, 3, 8, 4, 5, 4, 4, 7,
+	3, 3, 3, 5, 4, 4, 7, 0, 4, 2, 3, 3, 3, 8, 4, 5,
+	4, 4, 7, 0, 3, 3, 3, 8, 0, 5, 5, 0, 4, 0, 3, 0,
+	5, 4, 4, 4, 0, 7, 3, 3, 0, 3, 0, 4, 8, 0, 8, 8,
+	0, 3, 8, 8, 0, 5, 4, 4, 4, 0, 7, 2, 3, 3, 3, 5,
+	4, 4, 2, 5, 3, 0, 3, 0, 5, 4, 4, 4, 7, 2, 3, 3,
+	3, 8, 0, 8, 8, 4, 8, 8, 8, 0, 3, 5, 4, 4, 2, 4,
+	0, 7, 3, 3, 3, 8, 8, 4, 0, 5, 5, 0, 3, 4, 0, 8,
+	8, 3, 5, 5, 5, 4, 4, 2, 5, 0, 3, 0, 3, 0, 8, 4,
+	5, 4, 4, 2, 5, 3, 3, 3, 8, 0, 8, 8, 4, 8, 0, 8,
+	8, 0, 3, 4, 5, 4, 7, 3, 5, 4, 7, 0, 3, 3, 8, 8,
+	4, 0, 8, 8, 0, 8, 8, 0, 3, 4, 0, 5, 5, 0, 5, 5,
+	3, 5, 5, 5, 4, 4, 10, 0, 8, 3, 3, 8, 8, 4, 5, 4,
+	4, 2, 5, 0, 3, 3, 3, 5, 4, 4, 7, 3, 0, 3, 0, 5,
+	4, 4, 7, 5, 0, 3, 3, 8, 5, 4, 4, 7, 0, 3, 0, 3,
+	0, 8, 4, 5, 4, 0, 5, 3, 0, 3, 5, 4, 4, 7, 0, 5,
+	0, 3, 3, 8, 8, 4, 5, 4, 4, 5, 2, 3, 3, 3, 4, 4,
+	4, 10, 3, 8, 3, 3, 8, 8, 5, 4, 4, 4, 0, 7, 3, 0,
+	3, 0, 3, 4, 5, 5, 4, 7, 3, 5, 0, 5, 3, 4, 5, 5,
+	4, 7, 3, 5, 5, 3, 5, 4, 4, 4, 7, 3, 0, 3, 0, 3,
+	4, 5, 5, 4, 2, 5, 3, 5, 5, 3, 4, 4, 4, 10, 3, 8,
+	3, 3, 8, 8, 0, 5, 4, 4, 4, 6, 4, 7, 3, 3, 3, 3,
+	4, 5, 5, 4, 7, 3, 5, 0, 5, 3, 0, 4, 5, 5, 4, 7,
+	3, 5, 5, 3, 0, 5, 4, 4, 4, 10, 10, 3, 3, 3, 8, 4,
+	5, 5, 4, 2, 5, 3, 5, 5, 3, 0, 4, 8, 8, 0, 8, 3,
+	5, 0, 5, 4, 8, 8, 8, 3, 5, 0, 5, 4, 8, 8, 0, 8,
+	3, 5, 0, 5, 0, 4, 8, 8, 8, 3, 5, 0, 5, 0, 4, 8,
+	8, 8, 3, 5, 5, 4, 8, 8, 8, 3, 5, 5, 0, 0, 4, 0,
+	8, 0, 3, 8, 8, 8, 4, 0, 4, 0, 8, 0, 3, 3, 8, 0,
+	4, 0, 8, 0, 3, 8, 8, 0, 8, 4, 5, 4, 0, 5, 0, 3,
+	0, 3, 4, 5, 5, 0, 5, 3, 5, 5, 4, 5, 5, 0, 5, 3,
+	5, 5, 0, 4, 4, 10, 0, 3, 0, 8, 3, 8, 8, 4, 4, 7,
+	3, 5, 4, 2, 5, 3, 0, 3, 8, 8, 4, 0, 8, 8, 4, 10,
+	0, 8, 3, 3, 5, 4, 4, 4, 8, 2, 3, 2, 3, 8, 3, 4,
+	4, 7, 3, 5, 4, 7, 3, 0, 3, 4, 4, 7, 3, 5, 4, 7,
+	0, 3, 0, 3, 4, 4, 10, 0, 3, 0, 8, 3, 8, 8, 0, 4,
+	5, 5, 3, 5, 4, 4, 7, 0, 3, 3, 4, 0, 8, 8, 4, 2,
+	5, 3, 5, 5, 0, 3, 5, 4, 4, 4, 8, 2, 3, 2, 3, 3,
+	8, 5, 4, 0, 4, 10, 0, 8, 3, 3, 8, 4, 4, 7, 3, 5,
+	4, 7, 0, 3, 0, 3, 0, 4, 5, 0, 5, 5, 3, 5, 4, 0,
+	5, 3, 4, 5, 0, 5, 5, 3, 5, 0, 5, 4, 5, 0, 5, 5,
+	3, 5, 4, 0, 5, 3, 0, 4, 5, 0, 5, 5, 3, 5, 0, 5,
+	0, 4, 5, 0, 5, 5, 3, 5, 5, 4, 5, 0, 5, 5, 3, 5,
+	5, 0, 0, 4, 0, 8, 3, 8, 8, 0, 4, 0, 8, 8, 0, 3,
+	0, 8, 0, 4, 0, 8, 3, 8, 8, 0, 8, 4, 0, 4, 0, 8,
+	3, 8, 3, 4, 5, 4, 0, 5, 3, 5, 3, 5, 5, 4, 5, 4,
+	0, 5, 3, 5, 3, 5, 5, 0, 5, 0, 5, 0, 4, 0, 3, 0,
+	4, 8, 8, 0, 3, 8, 8, 5, 4, 5, 4, 2, 3, 0, 3, 8,
+	4, 5, 0, 5, 0, 3, 0, 5, 4, 5, 4, 2, 4, 2, 3, 3,
+	3, 8, 4, 0, 4, 8, 8, 0, 3, 3, 8, 5, 0, 5, 0, 4,
+	0, 3, 0, 0, 4, 8, 8, 0, 3, 8, 8, 0, 5, 4, 5, 4,
+	2, 3, 0, 3, 0, 8, 4, 5, 0, 5, 0, 3, 0, 4, 8, 8,
+	4, 10, 0, 3, 8, 3, 8, 4, 5, 4, 5, 4, 2, 3, 3, 3,
+	5, 4, 5, 0, 4, 2, 3, 0, 3, 8, 4, 5, 4, 5, 0, 3,
+	0, 3, 0, 5, 4, 5, 0, 4, 2, 3, 0, 3, 0, 8, 4, 5,
+	4, 5, 0, 3, 0, 3, 8, 8, 4, 4, 5, 0, 5, 3, 3, 8,
+	4, 8, 4, 5, 0, 5, 3, 3, 4, 4, 2, 3, 0, 8, 3, 8,
+	8, 4, 4, 2, 3, 0, 8, 8, 0, 3, 0, 8, 4, 4, 2, 3,
+	0, 8, 3, 8, 8, 0, 8, 4, 5, 4, 5, 0, 4, 2, 3, 3,
+	3, 4, 5, 4, 2, 5, 5, 3, 5, 3, 5, 4, 5, 4, 2, 5,
+	5, 3, 5, 3, 5, 0, 0, 4, 8, 0, 8, 3, 8, 8, 8, 0,
+	8, 8, 4, 0, 8, 8, 8, 3, 5, 4, 5, 4, 4, 7, 2, 3,
+	7, 5, 3, 3, 5, 4, 4, 4, 10, 0, 3, 8, 3, 3, 5, 4,
+	4, 4, 5, 9, 3, 0, 3, 3, 5, 4, 4, 4, 7, 2, 3, 2,
+	3, 3, 0, 4, 8, 0, 8, 3, 8, 8, 0, 8, 5, 4, 4, 2,
+	4, 2, 5, 3, 0, 3, 3, 8, 8, 4, 0, 5, 5, 0, 4, 2,
+	3, 3, 5, 4, 4, 4, 10, 0, 3, 3, 8, 3, 5, 4, 4, 4,
+	10, 8, 3, 3, 8, 3, 5, 4, 4, 4, 7, 2, 3, 2, 3, 0,
+	3, 8, 4, 4, 5, 0, 5, 3, 5, 3, 5, 4, 5, 4, 7, 3,
+	5, 0, 5, 3, 4, 5, 4, 7, 3, 5, 4, 0, 5, 3, 0, 3,
+	4, 5, 4, 7, 3, 5, 0, 5, 0, 3, 4, 5, 4, 7, 3, 5,
+	5, 3, 4, 5, 4, 7, 3, 5, 5, 0, 3, 0, 8, 0, 5, 5,
+	5, 0, 5, 5, 4, 4, 7, 4, 2, 3, 0, 3, 3, 5, 4, 4,
+	7, 5, 3, 0, 8, 0, 3, 8, 4, 5, 4, 4, 7, 3, 0, 3,
+	3, 4, 5, 4, 2, 5, 3, 5, 5, 3, 4, 5, 4, 2, 5, 3,
+	5, 5, 0, 3, 0, 4, 8, 0, 8, 3, 8, 8, 8, 0, 0, 8,
+	8, 4, 0, 8, 8, 8, 3, 5, 0, 4, 5, 4, 4, 7, 2, 3,
+	5, 5, 3, 3, 5, 4, 4, 4, 10, 0, 3, 10, 3, 3, 5, 4,
+	4, 4, 7, 1, 3, 0, 3, 3, 5, 4, 4, 4, 7, 2, 3, 0,
+	3, 3, 0, 4, 8, 0, 8, 3, 8, 8, 0, 8, 0, 5, 4, 4,
+	2, 4, 0, 7, 3, 0, 3, 3, 8, 8, 4, 0, 5, 5, 0, 4,
+	0, 3, 3, 5, 4, 4, 4, 10, 0, 3, 3, 3, 8, 5, 4, 4,
+	4, 10, 8, 3, 3, 3, 8, 8, 4, 5, 4, 4, 2, 5, 3, 0,
+	3, 3, 8, 4, 4, 5, 0, 5, 3, 5, 3, 5, 0, 4, 5, 4,
+	7, 3, 5, 0, 5, 3, 0, 8, 8, 4, 8, 4, 0, 5, 5, 0,
+	3, 0, 3, 4, 5, 4, 7, 3, 5, 0, 5, 0, 3, 0, 4, 5,
+	4, 7, 3, 5, 5, 3, 0, 4, 5, 4, 7, 3, 5, 5, 0, 3,
+	0, 0, 8, 0, 5, 5, 5, 0, 5, 0, 5, 4, 4, 7, 4, 2,
+	3, 2, 3, 3, 5, 4, 4, 7, 0, 5, 3, 0, 3, 8, 8, 4,
+	5, 0, 4, 0, 5, 0, 3, 3, 4, 5, 4, 2, 5, 3, 5, 5,
+	3, 0, 4, 5, 4, 2, 5, 3, 5, 5, 0, 3, 0, 4, 4, 4,
+	10, 3, 10, 3, 3, 8, 8, 5, 5, 4, 4, 4, 10, 0, 5, 3,
+	3, 3, 4, 0, 5, 5, 4, 7, 3, 5, 0, 5, 3, 4, 0, 5,
+	5, 4, 7, 3, 5, 5, 3, 5, 4, 4, 2, 8, 8, 3, 3, 8,
+	8, 5, 4, 4, 4, 7, 2, 3, 0, 3, 0, 3, 4, 4, 4, 10,
+	3, 10, 3, 3, 8, 8, 0, 0, 5, 5, 4, 4, 4, 7, 2, 3,
+	3, 3, 4, 0, 5, 5, 4, 7, 3, 5, 0, 5, 3, 0, 4, 0,
+	5, 5, 4, 7, 3, 5, 5, 3, 0, 5, 4, 4, 2, 8, 8, 3,
+	3, 8, 8, 0, 5, 4, 4, 4, 2, 10, 0, 3, 3, 3, 8, 4,
+	0, 8, 8, 0, 8, 3, 5, 0, 5, 4, 0, 8, 8, 8, 3, 5,
+	0, 5, 4, 0, 8, 8, 0, 8, 3, 5, 0, 5, 0, 4, 0, 8,
+	8, 8, 3, 5, 0, 5, 0, 4, 0, 8, 8, 8, 3, 5, 5, 4,
+	0, 8, 8, 8, 3, 5, 5, 0, 0, 4, 0, 8, 0, 3, 0, 8,
+	8, 5, 4, 4, 7, 4, 2, 3, 2, 3, 0, 3, 0, 4, 0, 8,
+	0, 3, 0, 8, 8, 0, 8, 4, 5, 0, 4, 0, 5, 0, 3, 0,
+	3, 4, 0, 5, 5, 0, 5, 3, 5, 5, 4, 0, 5, 5, 0, 5,
+	3, 5, 5, 0, 8, 4, 4, 5, 5, 3, 5, 3, 5, 4, 5, 5,
+	3, 5, 4, 0, 5, 3, 4, 4, 10, 0, 3, 0, 3, 8, 8, 0,
+	8, 4, 5, 5, 3, 5, 4, 0, 5, 0, 3, 4, 5, 5, 3, 5,
+	0, 5, 4, 5, 5, 3, 5, 4, 5, 0, 3, 8, 4, 4, 5, 5,
+	3, 5, 3, 5, 0, 4, 5, 5, 3, 5, 4, 0, 5, 3, 0, 4,
+	4, 10, 0, 3, 0, 3, 8, 8, 0, 8, 0, 4, 5, 5, 3, 5,
+	4, 0, 5, 0, 3, 0, 4, 5, 5, 3, 5, 0, 5, 0, 4, 5,
+	5, 3, 5, 4, 5, 0, 3, 0, 4, 5, 5, 3, 5, 4, 4, 2,
+	5, 3, 0, 3, 4, 5, 5, 3, 5, 4, 4, 7, 3, 0, 3, 5,
+	5, 5, 4, 4, 4, 2, 10, 8, 3, 3, 3, 4, 5, 5, 3, 5,
+	4, 4, 7, 3, 0, 3, 0, 5, 4, 0, 4, 10, 0, 3, 3, 8,
+	8, 5, 4, 0, 4, 10, 0, 3, 3, 8, 8, 0, 4, 5, 5, 3,
+	5, 5, 0, 4, 0, 3, 8, 8, 0, 8, 4, 5, 5, 3, 5, 5,
+	0, 0, 4, 0, 3, 8, 8, 0, 8, 0, 4, 5, 5, 3, 5, 5,
+	0, 4, 0, 3, 0, 4, 0, 3, 8, 4, 8, 8, 0, 3, 0, 8,
+	0, 8, 8, 8, 8, 4, 0, 8, 0, 3, 8, 8, 0, 8, 0, 8,
+	8, 0, 8, 8, 4, 0, 8, 0, 8, 3, 8, 4, 5, 4, 2, 5,
+	3, 5, 3, 5, 8, 4, 8, 4, 0, 8, 0, 3, 3, 8, 0, 8,
+	0, 8, 8, 8, 0, 8, 4, 0, 8, 0, 3, 8, 8, 0, 0, 8,
+	0, 8, 8, 0, 8, 0, 8, 4, 0, 8, 0, 8, 8, 3, 4, 5,
+	4, 2, 5, 3, 5, 3, 5, 0, 8, 4, 8, 4, 0, 8, 0, 3,
+	8, 3, 0, 8, 0, 8, 8, 4, 8, 0, 3, 8, 4, 0, 8, 0,
+	8, 8, 0, 3, 0, 0, 8, 8, 4, 0, 8, 8, 0, 3, 8, 4,
+	0, 8, 0, 8, 8, 0, 3, 8, 8, 4, 4, 5, 0, 5, 0, 3,
+	3, 8, 4, 8, 4, 5, 0, 5, 0, 3, 3, 4, 5, 0, 5, 3,
+	5, 5, 4, 5, 0, 5, 3, 5, 5, 4, 0, 3, 4, 5, 0, 5,
+	3, 5, 5, 0, 8, 4, 4, 5, 0, 5, 3, 5, 5, 3, 4, 5,
+	0, 5, 3, 5, 5, 0, 4, 0, 3, 8, 4, 4, 5, 0, 5, 3,
+	5, 5, 0, 3, 8, 4, 0, 5, 5, 3, 5, 0, 5, 5, 4, 4,
+	0, 5, 3, 3, 4, 8, 0, 3, 0, 8, 8, 0, 8, 8, 0, 5,
+	5, 4, 4, 0, 5, 0, 3, 3, 0, 5, 5, 4, 0, 5, 3, 0,
+	5, 5, 4, 4, 5, 0, 3, 3, 8, 4, 0, 5, 5, 3, 5, 4,
+	0, 3, 0, 5, 5, 4, 4, 0, 5, 3, 0, 3, 8, 8, 4, 4,
+	0, 5, 5, 3, 5, 3, 0, 4, 8, 0, 8, 0, 5, 3, 5, 5,
+	0, 0, 5, 5, 4, 0, 5, 0, 3, 0, 5, 5, 4, 4, 5, 0,
+	3, 0, 3, 4, 4, 0, 8, 0, 5, 3, 5, 3, 5, 5, 0, 5,
+	5, 4, 0, 4, 0, 5, 0, 3, 3, 5, 4, 4, 4, 4, 2, 10,
+	3, 3, 3, 8, 3, 4, 4, 10, 8, 3, 3, 8, 8, 0, 8, 8,
+	0, 5, 4, 4, 10, 0, 3, 0, 8, 8, 3, 5, 4, 4, 10, 0,
+	3, 0, 8, 8, 0, 3, 0, 5, 5, 0, 5, 0, 5, 5, 4, 5,
+	4, 0, 3, 3, 0, 5, 5, 4, 5, 0, 3, 8, 4, 0, 5, 5,
+	0, 5, 3, 0, 0, 5, 5, 4, 5, 0, 4, 0, 3, 3, 8, 4,
+	0, 5, 5, 4, 7, 0, 3, 3, 8, 4, 0, 5, 5, 3, 5, 0,
+	0, 5, 5, 4, 4, 2, 5, 3, 3, 4, 8, 0, 3, 0, 8, 8,
+	0, 8, 8, 0, 0, 5, 5, 4, 4, 2, 5, 0, 3, 3, 0, 5,
+	5, 4, 0, 5, 3, 0, 0, 5, 5, 4, 4, 7, 0, 3, 3, 8,
+	4, 0, 5, 5, 3, 5, 4, 0, 3, 0, 0, 5, 5, 4, 4, 4,
+	7, 3, 3, 3, 8, 8, 4, 4, 0, 5, 5, 3, 5, 3, 4, 8,
+	0, 8, 0, 5, 3, 5, 5, 0, 5, 5, 4, 0, 5, 0, 3, 0,
+	8, 4, 0, 5, 5, 4, 0, 5, 3, 3, 4, 4, 0, 8, 0, 5,
+	3, 5, 3, 5, 5, 0, 0, 5, 5, 4, 4, 4, 7, 3, 0, 3,
+	3, 5, 5, 4, 4, 4, 4, 7, 2, 3, 3, 3, 3, 4, 4, 10,
+	8, 3, 3, 8, 8, 0, 8, 8, 5, 4, 4, 10, 0, 3, 0, 8,
+	3, 8, 8, 4, 0, 5, 5, 4, 0, 5, 0, 3, 3, 0, 5, 5,
+	0, 5, 0, 0, 5, 5, 4, 5, 4, 2, 3, 3, 0, 5, 5, 4,
+	5, 0, 3, 0, 8, 4, 0, 5, 5, 0, 5, 3, 0, 5, 5, 4,
+	5, 0, 4, 2, 3, 3, 8, 4, 0, 5, 5, 4, 5, 0, 3, 3,
+	8, 4, 0, 5, 5, 3, 5, 0, 4, 0, 3, 0, 5, 5, 4, 4,
+	2, 5, 3, 0, 3, 8, 8, 4, 4, 0, 5, 5, 3, 5, 0, 3,
+	0, 4, 4, 0, 8, 8, 3, 5, 3, 5, 5, 0, 0, 5, 5, 4,
+	4, 7, 3, 0, 3, 0, 5, 5, 4, 4, 7, 0, 3, 0, 3, 4,
+	4, 4, 2, 10, 3, 3, 8, 3, 8, 8, 0, 5, 5, 4, 4, 2,
+	5, 3, 0, 3, 0, 8, 8, 4, 4, 0, 5, 5, 3, 5, 0, 3,
+	4, 4, 0, 8, 8, 3, 5, 3, 5, 5, 0, 5, 5, 4, 4, 7,
+	3, 0, 3, 0, 0, 5, 5, 4, 4, 7, 0, 3, 0, 3, 0, 4,
+	4, 5, 5, 3, 5, 3, 5, 4, 0, 5, 3, 4, 4, 5, 5, 3,
+	5, 3, 5, 0, 5, 4, 4, 5, 5, 3, 5, 3, 5, 4, 0, 5,
+	3, 0, 4, 4, 5, 5, 3, 5, 3, 5, 0, 5, 0, 4, 4, 5,
+	5, 3, 5, 3, 5, 5, 4, 4, 5, 5, 3, 5, 3, 5, 5, 0,
+	0, 5, 5, 0, 5, 0, 4, 0, 3, 8, 4, 0, 5, 5, 0, 5,
+	0, 3, 0, 0, 5, 5, 0, 5, 0, 4, 0, 3, 0, 8, 4, 0,
+	5, 5, 0, 5, 0, 3, 4, 4, 5, 0, 5, 3, 5, 3, 5, 5,
+	4, 4, 5, 0, 5, 3, 5, 3, 5, 5, 0, 8, 4, 4, 0, 5,
+	5, 3, 5, 3, 5, 4, 0, 5, 5, 3, 5, 4, 0, 5, 3, 5,
+	5, 4, 4, 4, 4, 2, 10, 3, 3, 3, 3, 4, 0, 5, 5, 3,
+	5, 4, 0, 5, 0, 3, 4, 0, 5, 5, 3, 5, 0, 5, 4, 0,
+	5, 5, 3, 5, 4, 5, 0, 3, 8, 4, 4, 0, 5, 5, 3, 5,
+	3, 5, 0, 4, 0, 5, 5, 3, 5, 4, 0, 5, 3, 0, 4, 4,
+	4, 10, 10, 2, 3, 3, 3, 8, 8, 8, 4, 0, 5, 5, 3, 5,
+	4, 0, 5, 0, 3, 0, 4, 0, 5, 5, 3, 5, 0, 5, 0, 4,
+	0, 5, 5, 3, 5, 4, 5, 0, 3, 0, 4, 4, 4, 2, 10, 3,
+	3, 3, 8, 8, 0, 8, 5, 4, 4, 4, 2, 10, 3, 3, 3, 8,
+	8, 4, 4, 4, 2, 10, 3, 3, 3, 8, 8, 0, 8, 0, 5, 4,
+	4, 4, 2, 10, 3, 3, 3, 8, 8, 0, 4, 4, 0, 5, 5, 3,
+	5, 3, 5, 5, 4, 4, 0, 5, 5, 3, 5, 3, 5, 5, 0, 4,
+	0, 5, 5, 3, 5, 5, 0, 4, 0, 3, 0, 8, 8, 0, 8, 4,
+	0, 5, 5, 3, 5, 5, 0, 0, 4, 0, 3, 0, 8, 8, 0, 8,
+	0, 4, 0, 5, 5, 3, 5, 5, 0, 4, 0, 3, 0, 4, 0, 3,
+	8, 4, 0, 8, 8, 0, 3, 0, 5, 5, 5, 0, 8, 8, 0, 8,
+	8, 0, 8, 8, 8, 0, 8, 0, 8, 8, 0, 8, 0, 8, 0, 8,
+	8, 4, 8, 0, 3, 8, 8, 4, 0, 8, 8, 0, 3, 8, 0, 5,
+	5, 5, 0, 0, 8, 8, 0, 8, 8, 0, 0, 8, 8, 8, 0, 8,
+	0, 8, 4, 0, 8, 8, 8, 3, 0, 8, 8, 4, 8, 0, 8, 3,
+	8, 4, 0, 8, 8, 0, 8, 3, 0, 5, 5, 5, 0, 4, 0, 3,
+	8, 4, 0, 8, 8, 8, 0, 3, 0, 0, 8, 8, 4, 8, 8, 0,
+	3, 8, 4, 0, 8, 8, 8, 0, 3, 0, 8, 8, 4, 8, 0, 8,
+	0, 3, 8, 4, 0, 8, 8, 0, 8, 0, 3, 4, 4, 0, 5, 3,
+	5, 3, 5, 5, 8, 4, 0, 8, 8, 4, 10, 0, 3, 3, 4, 4,
+	0, 5, 3, 5, 3, 5, 5, 0, 8, 4, 0, 8, 8, 4, 8, 0,
+	3, 3, 8, 8, 4, 4, 0, 8, 8, 0, 3, 3, 8, 4, 8, 4,
+	0, 8, 8, 0, 3, 3, 5, 5, 8, 8, 0, 8, 8, 8, 8, 8,
+	8, 0, 8, 8, 8, 8, 0, 8, 0, 8, 8, 8, 8, 4, 8, 0,
+	3, 8, 8, 8, 4, 8, 8, 0, 3, 8, 8, 5, 5, 4, 0, 3,
+	8, 8, 0, 8, 8, 0, 8, 8, 8, 8, 0, 8, 0, 8, 8, 4,
+	5, 5, 3, 0, 8, 8, 4, 8, 0, 8, 3, 8, 8, 4, 8, 8,
+	0, 8, 3, 8, 5, 5, 4, 0, 4, 0, 3, 3, 8, 4, 5, 5,
+	4, 2, 3, 0, 3, 8, 8, 4, 8, 8, 0, 3, 8, 8, 4, 5,
+	5, 4, 2, 3, 3, 8, 8, 4, 8, 0, 8, 0, 3, 8, 8, 4,
+	8, 8, 0, 8, 0, 3, 8, 4, 4, 2, 5, 3, 5, 3, 5, 8,
+	4, 8, 8, 4, 10, 0, 3, 3, 8, 4, 4, 4, 7, 3, 3, 5,
+	5, 0, 3, 8, 4, 8, 8, 4, 8, 0, 3, 3, 8, 8, 8, 4,
+	4, 8, 8, 0, 3, 3, 8, 8, 4, 8, 4, 8, 8, 0, 3, 3,
+	8, 5, 5, 0, 8, 8, 0, 8, 8, 8, 0, 8, 8, 8, 0, 8,
+	8, 0, 8, 8, 0, 8, 0, 8, 8, 0, 8, 8, 4, 8, 0, 3,
+	8, 8, 0, 8, 4, 8, 8, 0, 3, 8, 8, 0, 5, 5, 4, 0,
+	3, 0, 8, 8, 0, 8, 8, 0, 8, 0, 8, 8, 4, 8, 8, 8,
+	3, 8, 4, 5, 5, 3, 8, 8, 4, 8, 0, 8, 8, 3, 8, 4,
+	8, 8, 0, 8, 8, 3, 5, 5, 4, 0, 4, 2, 3, 3, 8, 8,
+	8, 4, 0, 8, 0, 8, 3, 8, 8, 4, 8, 8, 0, 8, 3, 8,
+	4, 5, 5, 4, 0, 3, 3, 8, 8, 4, 4, 5, 5, 3, 0, 3,
+	8, 4, 8, 4, 5, 5, 3, 0, 3, 4, 4, 2, 5, 3, 5, 3,
+	5, 0, 8, 4, 8, 8, 4, 10, 0, 3, 8, 3, 8, 8, 4, 8,
+	4, 8, 0, 3, 8, 3, 8, 4, 8, 8, 4, 8, 0, 3, 8, 3,
+	8, 8, 4, 4, 8, 8, 0, 3, 8, 3, 8, 4, 8, 4, 8, 8,
+	0, 3, 8, 3, 5, 5, 0, 4, 0, 3, 8, 8, 0, 8, 8, 4,
+	8, 0, 3, 5, 5, 4, 4, 2, 3, 0, 3, 8, 4, 5, 5, 0,
+	3, 0, 8, 8, 4, 8, 0, 8, 8, 0, 3, 0, 8, 4, 8, 8,
+	0, 8, 8, 0, 3, 0, 5, 5, 0, 4, 0, 3, 0, 8, 8, 8,
+	4, 0, 8, 8, 0, 3, 8, 8, 4, 8, 8, 8, 0, 3, 8, 4,
+	5, 5, 0, 3, 8, 8, 4, 8, 0, 8, 8, 0, 3, 8, 4, 8,
+	8, 0, 8, 8, 0, 3, 5, 5, 4, 0, 4, 2, 3, 0, 3, 8,
+	4, 8, 8, 4, 10, 8, 3, 3, 8, 8, 4, 8, 8, 0, 8, 0,
+	3, 8, 4, 5, 5, 4, 0, 3, 0, 3, 8, 8, 4, 4, 5, 5,
+	3, 3, 8, 4, 8, 4, 5, 5, 3, 3, 8, 8, 8, 4, 4, 8,
+	0, 8, 3, 3, 8, 4, 8, 8, 4, 10, 0, 8, 3, 3, 8, 8,
+	4, 8, 4, 8, 0, 8, 3, 3, 8, 4, 8, 8, 4, 8, 0, 8,
+	3, 3, 8, 8, 4, 4, 8, 8, 0, 8, 3, 3, 8, 4, 8, 4,
+	8, 8, 0, 8, 3, 3, 5, 5, 0, 4, 0, 4, 0, 3, 3, 8,
+	4, 5, 5, 0, 4, 2, 3, 0, 3, 5, 5, 0, 4, 0, 4, 0,
+	3, 0, 3, 8, 4, 5, 5, 0, 4, 2, 3, 3, 4, 4, 7, 0,
+	5, 3, 5, 3, 5, 8, 4, 8, 4, 5, 5, 0, 3, 0, 3, 0,
+	5, 5, 5, 4, 4, 10, 0, 3, 3, 5, 5, 5, 4, 4, 2, 8,
+	0, 3, 3, 8, 8, 4, 8, 8, 4, 8, 0, 3, 3, 8, 4, 5,
+	5, 0, 4, 0, 3, 3, 4, 4, 7, 0, 5, 3, 5, 3, 5, 0,
+	8, 4, 8, 4, 5, 5, 0, 3, 0, 3, 5, 5, 5, 4, 4, 10,
+	0, 3, 0, 3, 8, 4, 8, 8, 4, 10, 8, 0, 3, 3, 8, 8,
+	4, 8, 4, 8, 8, 0, 3, 3, 8, 4, 5, 5, 0, 4, 0, 3,
+	0, 3, 8, 8, 4, 4, 5, 5, 0, 3, 3, 8, 4, 8, 4, 5,
+	5, 0, 3, 3, 4, 4, 7, 5, 3, 5, 3, 5, 4, 4, 10, 8,
+	0, 8, 3, 5, 3, 5, 4, 4, 7, 5, 3, 5, 3, 5, 0, 4,
+	4, 10, 8, 0, 8, 3, 5, 3, 5, 0, 8, 8, 4, 4, 8, 8,
+	0, 8, 0, 3, 3, 8, 4, 8, 4, 8, 8, 0, 8, 0, 3, 3,
+	4, 0, 5, 3, 5, 5, 4, 0, 3, 0, 8, 8, 0, 8, 8, 4,
+	0, 5, 3, 5, 5, 4, 0, 3, 8, 4, 4, 0, 5, 3, 5, 5,
+	3, 0, 4, 0, 3, 0, 8, 8, 4, 8, 0, 3, 8, 4, 0, 3,
+	8, 4, 0, 8, 8, 0, 3, 8, 4, 0, 5, 3, 5, 5, 0, 4,
+	0, 3, 0, 8, 8, 0, 8, 8, 0, 4, 0, 5, 3, 5, 5, 4,
+	0, 3, 0, 8, 4, 4, 0, 5, 3, 5, 5, 3, 4, 0, 3, 0,
+	8, 8, 4, 8, 0, 8, 3, 4, 0, 3, 8, 4, 0, 8, 8, 0,
+	8, 3, 4, 0, 5, 3, 5, 5, 0, 4, 0, 3, 8, 4, 4, 0,
+	5, 3, 5, 5, 0, 3, 0, 4, 0, 5, 3, 5, 5, 0, 4, 0,
+	3, 0, 8, 4, 4, 0, 5, 3, 5, 5, 0, 3, 4, 4, 10, 0,
+	8, 0, 5, 3, 5, 3, 5, 4, 4, 10, 0, 8, 0, 5, 3, 5,
+	3, 5, 0, 4, 4, 2, 5, 5, 3, 5, 3, 5, 4, 4, 2, 8,
+	8, 0, 8, 3, 5, 3, 5, 4, 4, 2, 5, 5, 3, 5, 3, 5,
+	0, 4, 4, 2, 8, 8, 0, 8, 3, 5, 3, 5, 0, 8, 8, 4,
+	4, 8, 4, 8, 8, 0, 3, 3, 3, 8, 4, 8, 4, 8, 4, 8,
+	8, 0, 3, 3, 3, 5, 8, 8, 0, 5, 5, 5, 8, 8, 8, 0,
+	8, 8, 8, 8, 8, 0, 8, 0, 8, 8, 8, 4, 4, 4, 2, 7,
+	3, 3, 5, 3, 8, 4, 8, 8, 0, 3, 8, 8, 8, 5, 4, 4,
+	0, 3, 3, 8, 8, 0, 8, 8, 0, 8, 8, 8, 8, 8, 0, 8,
+	0, 8, 8, 8, 0, 5, 0, 4, 0, 3, 8, 8, 4, 8, 0, 8,
+	3, 8, 8, 8, 4, 8, 8, 0, 8, 3, 8, 8, 5, 4, 4, 0,
+	4, 0, 3, 3, 3, 4, 4, 4, 0, 10, 3, 5, 0, 3, 3, 8,
+	8, 4, 8, 8, 0, 3, 8, 8, 4, 4, 4, 0, 10, 3, 5, 3,
+	3, 4, 4, 10, 0, 8, 3, 5, 0, 3, 4, 4, 4, 10, 8, 3,
+	5, 0, 3, 3, 4, 4, 2, 5, 3, 5, 3, 4, 4, 4, 10, 0,
+	5, 3, 5, 0, 3, 3, 4, 4, 4, 7, 2, 3, 7, 3, 3, 4,
+	4, 2, 8, 0, 5, 3, 5, 0, 3, 4, 4, 4, 0, 10, 8, 3,
+	5, 3, 3, 4, 4, 4, 0, 10, 8, 3, 5, 0, 3, 3, 5, 4,
+	0, 3, 8, 8, 0, 8, 8, 8, 0, 8, 5, 4, 4, 4, 2, 3,
+	3, 3, 8, 8, 0, 8, 0, 8, 8, 0, 8, 4, 4, 4, 2, 7,
+	3, 3, 5, 0, 3, 8, 4, 8, 8, 0, 3, 8, 8, 0, 8, 5,
+	4, 4, 0, 3, 0, 3, 8, 8, 0, 8, 8, 0, 8, 0, 8, 8,
+	8, 4, 5, 5, 3, 0, 8, 0, 5, 0, 8, 8, 4, 8, 0, 8,
+	8, 3, 8, 8, 8, 8, 0, 5, 5, 0, 5, 0, 5, 4, 4, 0,
+	4, 2, 3, 3, 3, 8, 8, 8, 4, 0, 8, 0, 8, 3, 8, 8,
+	8, 4, 8, 8, 0, 8, 3, 8, 8, 4, 5, 4, 7, 0, 8, 3,
+	3, 4, 4, 10, 0, 8, 3, 5, 3, 0, 4, 8, 4, 8, 0, 5,
+	0, 3, 3, 4, 4, 2, 5, 3, 5, 0, 3, 0, 4, 0, 4, 0,
+	8, 8, 0, 3, 8, 3, 4, 4, 4, 7, 2, 3, 7, 3, 0, 3,
+	4, 4, 2, 8, 0, 5, 3, 5, 3, 4, 4, 4, 0, 8, 3, 10,
+	3, 5, 3, 8, 4, 8, 4, 8, 8, 0, 3, 8, 3, 8, 5, 4,
+	0, 4, 0, 3, 3, 5, 4, 5, 4, 4, 0, 8, 3, 3, 3, 5,
+	4, 4, 4, 2, 3, 0, 3, 3, 8, 4, 5, 4, 2, 3, 0, 3,
+	4, 4, 2, 4, 2, 5, 3, 5, 0, 3, 3, 8, 4, 5, 4, 7,
+	4, 2, 8, 3, 3, 3, 5, 4, 0, 4, 0, 3, 0, 3, 5, 4,
+	5, 4, 4, 2, 8, 3, 3, 3, 8, 8, 4, 5, 5, 4, 2, 3,
+	3, 8, 4, 5, 4, 2, 3, 3, 8, 8, 4, 8, 0, 8, 8, 0,
+	3, 8, 8, 4, 8, 8, 0, 8, 8, 0, 3, 8, 5, 4, 4, 0,
+	4, 2, 3, 0, 3, 3, 4, 4, 7, 5, 0, 5, 3, 5, 3, 8,
+	8, 4, 8, 8, 0, 8, 0, 3, 8, 4, 4, 7, 5, 0, 5, 3,
+	5, 0, 3, 4, 8, 0, 8, 3, 5, 0, 8, 4, 8, 0, 5, 0,
+	3, 0, 4, 4, 10, 0, 8, 8, 3, 5, 3, 4, 4, 10, 4, 8,
+	0, 3, 8, 3, 5, 3, 4, 4, 10, 0, 8, 8, 3, 5, 0, 3,
+	4, 4, 10, 4, 2, 5, 3, 5, 0, 3, 3, 4, 4, 7, 0, 5,
+	5, 3, 5, 3, 4, 4, 7, 0, 5, 5, 3, 5, 0, 3, 4, 0,
+	8, 0, 5, 5, 3, 5, 4, 4, 7, 4, 2, 5, 3, 5, 3, 3,
+	0, 4, 0, 8, 0, 8, 8, 0, 8, 3, 8, 4, 5, 4, 2, 4,
+	2, 3, 3, 3, 4, 4, 7, 0, 5, 3, 5, 3, 4, 4, 7, 4,
+	7, 3, 7, 0, 3, 3, 0, 4, 0, 8, 0, 8, 8, 8, 0, 3,
+	4, 4, 7, 4, 2, 5, 3, 5, 3, 0, 3, 0, 4, 0, 8, 0,
+	8, 8, 0, 8, 0, 3, 8, 4, 5, 4, 2, 4, 0, 3, 3, 3,
+	4, 4, 7, 0, 5, 3, 5, 0, 3, 4, 4, 7, 4, 7, 3, 7,
+	0, 3, 0, 3, 5, 4, 0, 4, 0, 4, 2, 3, 0, 3, 3, 4,
+	4, 2, 5, 5, 0, 5, 3, 5, 3, 8, 8, 4, 8, 4, 8, 8,
+	0, 3, 3, 8, 4, 4, 2, 5, 5, 0, 5, 3, 5, 0, 3, 4,
+	4, 2, 8, 8, 3, 5, 3, 4, 4, 2, 8, 8, 3, 5, 0, 3,
+	4, 4, 7, 5, 3, 5, 3, 4, 4, 10, 8, 0, 8, 3, 5, 3,
+	4, 4, 7, 5, 3, 5, 0, 3, 4, 4, 10, 8, 0, 8, 3, 5,
+	0, 3, 4, 4, 7, 5, 3, 5, 0, 4, 0, 3, 3, 4, 4, 8,
+	4, 10, 8, 3, 5, 0, 3, 3, 4, 0, 5, 3, 5, 0, 4, 0,
+	8, 8, 0, 8, 8, 3, 4, 4, 7, 3, 5, 4, 0, 3, 3, 4,
+	4, 10, 0, 5, 3, 5, 0, 3, 4, 4, 4, 2, 7, 3, 5, 3,
+	5, 3, 0, 4, 8, 4, 0, 8, 8, 0, 3, 8, 3, 4, 4, 7,
+	3, 5, 0, 3, 0, 4, 0, 8, 8, 0, 8, 8, 0, 3, 4, 4,
+	7, 3, 5, 4, 0, 3, 0, 3, 4, 0, 8, 0, 5, 3, 5, 0,
+	4, 4, 4, 2, 7, 3, 5, 3, 5, 0, 3, 0, 4, 8, 4, 0,
+	8, 8, 0, 8, 3, 3, 4, 4, 7, 3, 5, 0, 4, 0, 3, 3,
+	8, 4, 4, 4, 7, 3, 5, 0, 3, 0, 3, 4, 4, 7, 3, 5,
+	0, 4, 0, 3, 0, 3, 8, 4, 4, 4, 7, 3, 5, 0, 3, 3,
+	4, 4, 10, 0, 8, 0, 5, 3, 5, 3, 4, 4, 10, 0, 8, 0,
+	5, 3, 5, 0, 3, 4, 4, 2, 5, 5, 3, 5, 3, 4, 4, 2,
+	8, 8, 0, 8, 3, 5, 3, 4, 4, 2, 5, 5, 3, 5, 0, 3,
+	4, 4, 2, 8, 8, 0, 8, 3, 5, 0, 3, 4, 4, 4, 2, 10,
+	10, 3, 5, 3, 5, 3, 4, 4, 4, 2, 10, 10, 3, 5, 3, 5,
+	0, 3, 5, 0, 8, 8, 0, 5, 5, 5, 0, 8, 8, 8, 0, 8,
+	8, 8, 0, 8, 8, 0, 8, 0, 8, 8, 8, 0, 4, 4, 4, 0,
+	7, 3, 3, 5, 3, 8, 4, 8, 8, 0, 3, 8, 8, 8, 0, 5,
+	4, 4, 2, 3, 3, 8, 8, 0, 8, 8, 0, 8, 8, 0, 8, 8,
+	8, 0, 8, 0, 8, 8, 0, 8, 0, 5, 0, 4, 0, 3, 0, 8,
+	8, 4, 8, 0, 8, 3, 8, 8, 0, 8, 4, 8, 8, 0, 8, 3,
+	8, 8, 0, 5, 4, 4, 2, 4, 0, 3, 3, 3, 4, 4, 4, 2,
+	10, 3, 5, 0, 3, 3, 8, 8, 4, 8, 8, 0, 3, 8, 8, 0,
+	4, 4, 4, 2, 10, 3, 5, 3, 3, 4, 4, 4, 10, 8, 3, 7,
+	3, 3, 4, 4, 4, 10, 8, 3, 7, 0, 3, 3, 4, 4, 2, 5,
+	3, 5, 3, 0, 4, 4, 4, 10, 2, 7, 3, 5, 0, 3, 3, 4,
+	4, 4, 7, 2, 3, 5, 3, 3, 4, 4, 4, 10, 2, 7, 3, 5,
+	3, 3, 4, 4, 4, 2, 10, 8, 3, 5, 3, 3, 4, 4, 4, 2,
+	10, 8, 3, 5, 0, 3, 3, 5, 4, 0, 3, 0, 8, 8, 0, 8,
+	8, 8, 0, 8, 0, 5, 4, 5, 4, 2, 8, 3, 3, 8, 8, 0,
+	8, 0, 8, 8, 0, 8, 0, 4, 4, 2, 4, 0, 7, 3, 5, 3,
+	3, 8, 4, 8, 8, 0, 3, 8, 8, 0, 8, 0, 5, 4, 4, 0,
+	3, 0, 3, 0, 8, 8, 8, 4, 0, 8, 8, 8, 3, 8, 8, 4,
+	5, 5, 3, 8, 0, 5, 8, 8, 4, 8, 0, 8, 8, 8, 3, 8,
+	8, 8, 0, 5, 5, 0, 5, 5, 4, 5, 0, 4, 2, 8, 3, 3,
+	8, 8, 8, 4, 0, 8, 0, 8, 8, 3, 8, 8, 4, 8, 8, 0,
+	8, 8, 3, 8, 4, 5, 4, 4, 0, 3, 3, 3, 4, 4, 8, 0,
+	3, 8, 3, 5, 8, 4, 8, 0, 5, 0, 4, 0, 3, 3, 4, 4,
+	2, 5, 3, 5, 0, 3, 0, 8, 4, 8, 8, 4, 10, 0, 3, 8,
+	8, 3, 4, 4, 4, 7, 2, 3, 7, 3, 0, 3, 0, 4, 4, 2,
+	8, 0, 5, 3, 5, 3, 0, 4, 4, 4, 0, 8, 3, 3, 8, 3,
+	5, 8, 4, 8, 4, 8, 8, 0, 3, 8, 8, 3, 5, 4, 0, 4,
+	2, 3, 3, 5, 4, 4, 4, 7, 0, 3, 8, 3, 3, 5, 4, 5,
+	4, 2, 8, 0, 3, 3, 8, 4, 5, 4, 2, 3, 0, 3, 0, 4,
+	4, 2, 4, 0, 7, 3, 5, 0, 3, 3, 5, 5, 5, 4, 0, 5,
+	5, 0, 5, 0, 3, 5, 4, 0, 4, 0, 3, 0, 3, 0, 5, 4,
+	4, 5, 4, 2, 3, 10, 3, 3, 8, 8, 4, 5, 5, 4, 0, 3,
+	3, 8, 4, 5, 4, 0, 3, 3, 8, 8, 4, 8, 0, 8, 8, 0,
+	8, 3, 8, 4, 8, 8, 0, 8, 8, 0, 8, 3, 8, 8, 8, 4,
+	4, 5, 5, 3, 0, 3, 8, 8, 8, 4, 5, 0, 5, 0, 3, 8,
+	8, 4, 8, 4, 5, 5, 3, 0, 3, 8, 4, 8, 8, 4, 5, 5,
+	3, 0, 3, 4, 8, 0, 8, 3, 5, 8, 4, 8, 0, 5, 0, 3,
+	4, 4, 8, 0, 8, 3, 8, 3, 5, 8, 4, 8, 8, 4, 10, 0,
+	8, 3, 8, 3, 4, 4, 10, 0, 8, 8, 3, 5, 0, 3, 0, 8,
+	4, 4, 4, 2, 5, 3, 5, 0, 3, 3, 4, 4, 7, 0, 5, 5,
+	3, 5, 3, 0, 4, 4, 7, 0, 5, 5, 3, 5, 0, 3, 0, 4,
+	0, 8, 0, 5, 5, 3, 5, 0, 4, 4, 7, 4, 0, 7, 3, 5,
+	3, 3, 0, 4, 0, 8, 0, 8, 8, 0, 3, 8, 4, 4, 0, 4,
+	2, 10, 3, 5, 3, 3, 4, 4, 7, 0, 5, 3, 5, 3, 0, 4,
+	4, 7, 4, 7, 3, 5, 0, 3, 3, 5, 4, 0, 5, 0, 4, 2,
+	8, 3, 3, 5, 4, 5, 4, 4, 2, 10, 2, 3, 3, 3, 0, 4,
+	0, 8, 8, 4, 2, 8, 8, 3, 3, 8, 4, 5, 4, 0, 4, 0,
+	3, 3, 3, 4, 4, 0, 8, 0, 3, 8, 3, 5, 8, 4, 8, 4,
+	5, 4, 2, 3, 0, 3, 3, 5, 4, 0, 5, 0, 4, 2, 8, 0,
+	3, 3, 4, 4, 2, 5, 5, 0, 5, 3, 5, 3, 0, 8, 8, 4,
+	8, 4, 8, 8, 0, 3, 8, 3, 8, 4, 5, 4, 0, 4, 0, 3,
+	0, 3, 3, 4, 4, 0, 8, 3, 8, 3, 5, 4, 4, 2, 8, 8,
+	3, 5, 0, 3, 0, 4, 4, 7, 5, 3, 5, 3, 0, 4, 4, 8,
+	8, 0, 3, 8, 3, 5, 4, 4, 7, 5, 3, 5, 0, 3, 0, 8,
+	4, 4, 8, 0, 8, 3, 5, 0, 3, 8, 8, 4, 4, 8, 0, 5,
+	0, 3, 0, 3, 8, 4, 8, 4, 8, 0, 5, 0, 3, 0, 3, 4,
+	0, 5, 3, 5, 0, 0, 4, 0, 8, 8, 0, 8, 3, 8, 4, 4,
+	7, 3, 5, 4, 2, 3, 3, 4, 4, 10, 0, 5, 3, 5, 0, 3,
+	0, 4, 4, 4, 2, 7, 3, 5, 3, 5, 3, 0, 0, 4, 8, 4,
+	0, 8, 8, 0, 3, 3, 8, 4, 4, 7, 3, 5, 0, 3, 0, 0,
+	4, 0, 8, 8, 0, 8, 8, 0, 3, 0, 0, 4, 0, 8, 8, 4,
+	10, 8, 3, 3, 4, 0, 8, 0, 5, 3, 5, 0, 4, 0, 8, 8,
+	4, 10, 0, 8, 3, 3, 8, 4, 0, 4, 0, 8, 8, 0, 8, 3,
+	3, 4, 4, 7, 3, 5, 0, 4, 2, 3, 3, 8, 4, 4, 4, 7,
+	3, 5, 0, 3, 0, 3, 0, 0, 4, 0, 8, 8, 4, 10, 8, 0,
+	3, 3, 4, 4, 10, 4, 7, 3, 5, 0, 3, 3, 4, 0, 4, 8,
+	0, 8, 3, 5, 3, 5, 8, 4, 4, 0, 8, 0, 5, 3, 5, 0,
+	3, 4, 4, 2, 5, 5, 3, 5, 3, 0, 4, 4, 0, 8, 8, 0,
+	3, 8, 3, 5, 4, 4, 2, 5, 5, 3, 5, 0, 3, 0, 8, 4,
+	4, 4, 2, 8, 8, 3, 5, 3, 3, 4, 4, 4, 2, 8, 3, 8,
+	3, 5, 3, 5, 8, 4, 4, 4, 2, 8, 8, 3, 5, 0, 3, 3,
+	5, 0, 4, 0, 3, 0, 4, 8, 8, 0, 8, 3, 8, 8, 5, 5,
+	4, 4, 0, 8, 3, 3, 4, 4, 4, 10, 3, 7, 0, 3, 0, 3,
+	4, 4, 4, 0, 7, 3, 3, 5, 0, 3, 8, 4, 5, 4, 4, 7,
+	2, 3, 3, 8, 3, 5, 4, 4, 2, 3, 0, 3, 5, 4, 4, 7,
+	4, 2, 8, 3, 3, 3, 8, 8, 4, 5, 5, 0, 3, 0, 8, 4,
+	5, 0, 3, 0, 4, 4, 4, 8, 2, 3, 10, 3, 5, 3, 5, 5,
+	4, 5, 0, 5, 5, 0, 5, 3, 5, 4, 4, 2, 4, 2, 3, 3,
+	3, 4, 4, 4, 2, 10, 3, 5, 0, 3, 0, 3, 8, 8, 4, 8,
+	8, 0, 8, 8, 0, 3, 0, 8, 4, 5, 5, 4, 2, 8, 3, 3,
+	4, 0, 4, 10, 0, 8, 3, 5, 3, 4, 4, 4, 10, 8, 3, 7,
+	0, 3, 0, 3, 4, 4, 4, 7, 3, 3, 5, 0, 3, 5, 4, 4,
+	10, 0, 8, 8, 0, 3, 8, 3, 4, 4, 4, 7, 2, 3, 5, 3,
+	0, 3, 4, 0, 4, 2, 8, 0, 5, 3, 5, 3, 4, 4, 4, 2,
+	8, 3, 10, 3, 5, 3, 4, 4, 4, 2, 10, 8, 3, 5, 0, 3,
+	0, 3, 5, 0, 4, 0, 3, 0, 0, 4, 8, 8, 0, 8, 3, 8,
+	8, 0, 5, 5, 4, 4, 2, 8, 3, 3, 4, 4, 4, 10, 3, 7,
+	0, 3, 0, 3, 0, 4, 4, 4, 0, 7, 3, 3, 5, 0, 3, 0,
+	4, 4, 4, 4, 7, 2, 3, 3, 3, 5, 3, 5, 4, 4, 2, 3,
+	0, 3, 0, 8, 8, 8, 4, 0, 8, 8, 8, 0, 3, 8, 8, 4,
+	5, 5, 0, 3, 8, 4, 5, 0, 3, 8, 8, 4, 8, 0, 8, 8,
+	8, 0, 3, 8, 4, 8, 8, 0, 8, 8, 8, 0, 3, 5, 5, 4,
+	0, 4, 2, 8, 3, 3, 8, 8, 8, 4, 0, 8, 0, 8, 8, 0,
+	3, 8, 8, 4, 8, 8, 0, 8, 8, 0, 3, 8, 4, 5, 4, 4,
+	2, 3, 3, 3, 4, 4, 8, 0, 3, 0, 8, 3, 5, 8, 4, 8,
+	0, 5, 0, 4, 0, 3, 0, 3, 4, 4, 4, 7, 3, 3, 5, 0,
+	3, 0, 5, 4, 4, 10, 0, 8, 8, 0, 3, 3, 8, 4, 4, 4,
+	7, 2, 3, 5, 3, 0, 3, 0, 4, 0, 4, 2, 8, 0, 5, 3,
+	5, 3, 0, 4, 4, 4, 2, 8, 3, 3, 8, 3, 5, 8, 4, 8,
+	4, 8, 8, 0, 3, 8, 8, 0, 3, 5, 4, 0, 4, 2, 3, 0,
+	3, 5, 4, 5, 4, 4, 0, 10, 3, 3, 3, 5, 4, 5, 4, 2,
+	8, 0, 3, 0, 3, 8, 4, 5, 4, 0, 3, 0, 3, 0, 5, 4,
+	5, 4, 2, 4, 2, 8, 3, 3, 3, 5, 5, 5, 4, 0, 5, 5,
+	0, 5, 3, 5, 4, 0, 4, 2, 3, 0, 3, 0, 5, 4, 5, 4,
+	4, 2, 10, 3, 3, 3, 8, 8, 4, 5, 5, 4, 0, 3, 0, 3,
+	8, 4, 5, 4, 0, 3, 0, 3, 8, 8, 4, 8, 0, 8, 8, 0,
+	8, 0, 3, 5, 5, 5, 4, 0, 5, 5, 0, 5, 3, 0, 8, 8,
+	8, 4, 4, 5, 5, 3, 3, 8, 8, 8, 4, 5, 0, 5, 3, 8,
+	8, 4, 8, 4, 5, 5, 3, 3, 8, 8, 8, 4, 5, 0, 5, 3,
+	0, 8, 0, 8, 0, 5, 8, 0, 8, 0, 5, 0, 4, 4, 8, 0,
+	3, 8, 8, 3, 5, 4, 5, 5, 4, 0, 5, 3, 5, 3, 5, 4,
+	4, 8, 0, 3, 8, 8, 3, 5, 0, 4, 5, 5, 4, 0, 5, 3,
+	5, 3, 5, 0, 4, 5, 5, 0, 5, 5, 3, 5, 4, 5, 5, 0,
+	5, 5, 3, 5, 0, 0, 4, 0, 8, 0, 8, 3, 8, 8, 4, 4,
+	7, 4, 0, 7, 3, 5, 3, 0, 3, 5, 4, 5, 4, 0, 4, 10,
+	0, 3, 3, 3, 8, 4, 5, 5, 0, 4, 2, 8, 3, 3, 4, 4,
+	7, 4, 7, 3, 5, 3, 0, 3, 4, 4, 7, 4, 7, 3, 5, 0,
+	3, 0, 3, 0, 4, 0, 8, 0, 8, 3, 8, 8, 0, 5, 5, 5,
+	4, 4, 7, 0, 5, 0, 3, 3, 8, 8, 4, 8, 8, 4, 8, 0,
+	8, 3, 3, 8, 4, 5, 4, 0, 4, 2, 3, 3, 3, 4, 4, 0,
+	8, 0, 3, 0, 8, 3, 5, 4, 4, 7, 4, 7, 3, 5, 0, 3,
+	0, 3, 0, 8, 8, 8, 4, 4, 8, 8, 0, 8, 3, 3, 4, 5,
+	0, 5, 5, 0, 5, 3, 5, 8, 8, 4, 8, 4, 8, 8, 0, 8,
+	3, 3, 4, 5, 0, 5, 5, 0, 5, 3, 5, 0, 4, 4, 0, 3,
+	8, 8, 3, 5, 4, 4, 0, 3, 8, 8, 3, 5, 0, 4, 8, 0,
+	8, 8, 3, 5, 4, 8, 4, 8, 0, 3, 8, 3, 5, 4, 8, 0,
+	8, 8, 3, 5, 0, 8, 4, 4, 8, 0, 8, 3, 5, 3, 8, 8,
+	4, 4, 8, 0, 5, 0, 3, 3, 8, 4, 8, 4, 8, 0, 5, 0,
+	3, 3, 0, 4, 0, 8, 8, 3, 8, 8, 0, 4, 0, 8, 8, 0,
+	3, 8, 8, 4, 4, 7, 3, 5, 4, 2, 3, 0, 3, 8, 4, 4,
+	0, 5, 3, 5, 0, 3, 0, 4, 4, 2, 4, 2, 10, 3, 8, 3,
+	5, 3, 8, 4, 0, 4, 0, 8, 8, 0, 3, 3, 8, 0, 4, 0,
+	8, 8, 3, 8, 8, 0, 0, 4, 0, 8, 8, 0, 3, 8, 8, 0,
+	0, 4, 0, 8, 8, 4, 10, 3, 8, 3, 8, 4, 4, 0, 5, 3,
+	5, 0, 3, 0, 4, 0, 8, 8, 4, 10, 0, 3, 8, 3, 8, 4,
+	0, 4, 0, 8, 8, 0, 3, 8, 3, 4, 4, 0, 8, 0, 3, 8,
+	8, 3, 5, 4, 5, 4, 5, 0, 5, 3, 5, 3, 5, 4, 4, 0,
+	8, 0, 3, 8, 8, 3, 5, 0, 4, 5, 4, 5, 0, 5, 3, 5,
+	3, 5, 0, 4, 0, 8, 0, 8, 0, 5, 3, 5, 4, 0, 8, 0,
+	8, 0, 5, 3, 5, 0, 4, 4, 0, 8, 3, 8, 8, 3, 5, 4,
+	4, 0, 8, 8, 0, 3, 0, 8, 3, 5, 4, 4, 0, 8, 3, 8,
+	8, 3, 5, 0, 8, 4, 4, 4, 0, 8, 3, 8, 3, 5, 3, 4,
+	5, 4, 0, 5, 5, 3, 5, 3, 5, 4, 5, 4, 0, 5, 5, 3,
+	5, 3, 5, 0, 5, 0, 4, 0, 4, 0, 3, 3, 0, 4, 8, 8,
+	0, 3, 8, 8, 8, 5, 5, 4, 4, 0, 8, 0, 3, 3, 8, 4,
+	5, 0, 4, 2, 3, 0, 3, 5, 5, 4, 4, 0, 4, 0, 8, 3,
+	3, 3, 8, 4, 5, 5, 4, 4, 0, 10, 3, 3, 3, 5, 0, 4,
+	0, 4, 0, 3, 0, 3, 5, 5, 4, 4, 4, 2, 8, 3, 3, 3,
+	5, 5, 4, 4, 0, 8, 0, 3, 0, 3, 8, 4, 5, 0, 4, 2,
+	3, 3, 5, 5, 4, 4, 0, 4, 2, 8, 3, 3, 3, 8, 4, 5,
+	4, 4, 7, 0, 3, 8, 3, 3, 5, 4, 4, 2, 4, 2, 3, 0,
+	3, 3, 4, 5, 4, 7, 0, 5, 3, 5, 3, 5, 4, 4, 2, 4,
+	2, 3, 0, 3, 0, 3, 4, 5, 4, 7, 0, 5, 3, 5, 0, 3,
+	4, 0, 8, 0, 8, 3, 5, 0, 4, 0, 4, 10, 8, 3, 5, 0,
+	3, 4, 8, 0, 5, 5, 0, 5, 3, 5, 4, 5, 4, 4, 2, 7,
+	3, 5, 3, 5, 3, 5, 4, 4, 10, 0, 8, 3, 8, 8, 0, 3,
+	4, 5, 4, 4, 2, 7, 3, 5, 3, 5, 0, 3, 4, 5, 4, 2,
+	5, 5, 3, 5, 3, 4, 5, 4, 2, 5, 5, 3, 5, 0, 3, 5,
+	5, 4, 4, 10, 0, 3, 3, 0, 4, 8, 8, 0, 3, 8, 8, 8,
+	0, 5, 5, 4, 4, 2, 8, 0, 3, 3, 8, 4, 5, 0, 4, 2,
+	3, 0, 3, 0, 5, 5, 4, 4, 2, 4, 0, 8, 3, 3, 3, 8,
+	4, 5, 5, 4, 4, 2, 10, 3, 3, 3, 5, 5, 4, 0, 4, 10,
+	0, 3, 3, 5, 4, 4, 7, 4, 2, 3, 10, 3, 3, 8, 8, 4,
+	5, 5, 0, 4, 0, 3, 3, 8, 4, 5, 0, 4, 0, 3, 3, 5,
+	5, 4, 4, 2, 4, 2, 10, 3, 3, 3, 8, 4, 5, 5, 4, 4,
+	0, 8, 3, 3, 3, 5, 5, 4, 0, 4, 2, 8, 0, 3, 3, 4,
+	5, 4, 7, 0, 5, 3, 5, 3, 0, 8, 8, 4, 8, 4, 5, 5,
+	0, 3, 0, 3, 8, 4, 5, 4, 4, 2, 3, 0, 3, 3, 4, 0,
+	8, 0, 8, 3, 5, 8, 4, 8, 4, 5, 0, 3, 0, 3, 4, 8,
+	0, 5, 5, 0, 5, 3, 5, 0, 4, 5, 4, 4, 2, 7, 3, 5,
+	3, 5, 3, 0, 5, 4, 4, 10, 0, 8, 3, 8, 8, 0, 3, 0,
+	8, 4, 4, 0, 4, 2, 5, 3, 5, 0, 3, 3, 4, 5, 4, 2,
+	5, 5, 3, 5, 3, 0, 4, 5, 4, 2, 5, 5, 3, 5, 0, 3,
+	0, 5, 5, 4, 4, 10, 0, 3, 0, 3, 5, 5, 4, 4, 4, 0,
+	10, 3, 3, 3, 5, 5, 4, 4, 2, 8, 0, 3, 0, 3, 8, 4,
+	5, 0, 4, 0, 3, 0, 3, 0, 5, 5, 4, 4, 2, 4, 2, 8,
+	3, 3, 3, 8, 4, 5, 4, 5, 4, 2, 3, 10, 3, 3, 5, 5,
+	4, 4, 10, 0, 3, 0, 3, 0, 5, 5, 4, 4, 4, 2, 10, 3,
+	3, 3, 5, 5, 4, 4, 2, 8, 0, 3, 0, 3, 0, 8, 4, 5,
+	0, 4, 0, 3, 0, 3, 5, 5, 4, 4, 0, 4, 2, 10, 3, 3,
+	3, 8, 4, 5, 5, 4, 4, 2, 8, 3, 3, 3, 8, 8, 8, 4,
+	4, 5, 5, 0, 3, 3, 4, 0, 8, 8, 8, 0, 5, 3, 5, 8,
+	8, 4, 8, 4, 5, 5, 0, 3, 3, 4, 0, 8, 8, 8, 0, 5,
+	3, 5, 0, 4, 0, 8, 8, 3, 5, 4, 0, 8, 8, 3, 5, 0,
+	5, 4, 4, 10, 0, 8, 3, 3, 8, 8, 4, 0, 5, 5, 4, 0,
+	5, 3, 5, 3, 5, 5, 4, 4, 10, 0, 8, 3, 3, 8, 8, 0,
+	4, 0, 5, 5, 4, 0, 5, 3, 5, 3, 5, 0, 4, 0, 5, 5,
+	0, 5, 5, 3, 5, 4, 0, 5, 5, 0, 5, 5, 3, 5, 0, 0,
+	4, 0, 8, 0, 3, 8, 8, 8, 4, 5, 5, 4, 2, 5, 3, 5,
+	3, 0, 4, 0, 8, 0, 3, 8, 8, 0, 8, 4, 5, 5, 4, 2,
+	5, 3, 5, 0, 3, 4, 5, 5, 0, 5, 3, 5, 4, 5, 5, 4,
+	7, 3, 5, 0, 3, 0, 4, 0, 8, 0, 3, 8, 8, 8, 0, 4,
+	5, 5, 4, 2, 5, 3, 5, 3, 0, 0, 4, 0, 8, 0, 3, 8,
+	8, 0, 8, 0, 4, 5, 5, 4, 2, 5, 3, 5, 0, 3, 0, 4,
+	5, 5, 0, 5, 3, 5, 0, 4, 5, 5, 4, 7, 3, 5, 0, 3,
+	0, 5, 5, 5, 4, 4, 4, 10, 8, 3, 3, 3, 5, 5, 5, 4,
+	4, 7, 0, 5, 3, 0, 3, 5, 5, 5, 4, 4, 4, 10, 8, 3,
+	3, 3, 0, 5, 5, 5, 4, 4, 7, 4, 7, 3, 3, 3, 4, 4,
+	0, 3, 0, 8, 8, 3, 5, 4, 4, 0, 3, 0, 8, 8, 3, 5,
+	0, 4, 8, 8, 8, 3, 5, 4, 8, 8, 0, 8, 3, 5, 4, 8,
+	8, 8, 3, 5, 0, 4, 8, 8, 0, 8, 3, 5, 0, 8, 8, 4,
+	0, 8, 0, 5, 0, 3, 8, 4, 8, 0, 8, 0, 5, 0, 3, 0,
+	4, 0, 8, 3, 8, 8, 8, 0, 4, 0, 8, 8, 0, 3, 0, 8,
+	8, 0, 4, 0, 8, 3, 8, 8, 0, 8, 8, 4, 0, 4, 0, 8,
+	3, 8, 3, 8, 4, 5, 4, 0, 5, 3, 5, 3, 5, 4, 5, 4,
+	4, 7, 3, 5, 3, 5, 0, 3, 0, 4, 0, 8, 3, 8, 8, 8,
+	0, 0, 4, 0, 8, 8, 0, 3, 0, 8, 8, 0, 0, 4, 0, 8,
+	3, 8, 8, 0, 8, 0, 8, 4, 0, 4, 0, 8, 3, 8, 8, 3,
+	4, 5, 4, 0, 5, 3, 5, 3, 5, 0, 4, 5, 4, 4, 7, 3,
+	5, 3, 5, 0, 3, 0, 0, 4, 0, 8, 3, 8, 8, 4, 8, 0,
+	3, 8, 4, 0, 4, 0, 8, 3, 8, 8, 0, 3, 0, 0, 4, 0,
+	8, 3, 8, 4, 8, 8, 0, 3, 8, 4, 0, 4, 0, 8, 3, 8,
+	8, 0, 3, 4, 0, 4, 0, 8, 8, 3, 5, 3, 5, 4, 0, 4,
+	0, 8, 8, 3, 5, 3, 5, 0, 4, 5, 0, 5, 5, 3, 5, 4,
+	5, 0, 5, 5, 3, 5, 4, 0, 3, 4, 5, 0, 5, 5, 3, 5,
+	0, 8, 4, 4, 5, 0, 5, 5, 3, 5, 3, 4, 5, 0, 5, 5,
+	3, 5, 0, 4, 0, 3, 8, 4, 4, 5, 0, 5, 5, 3, 5, 0,
+	3, 0, 8, 0, 5, 5, 5, 8, 4, 0, 8, 0, 3, 8, 8, 8,
+	0, 8, 0, 8, 8, 0, 8, 8, 8, 4, 0, 8, 0, 8, 3, 8,
+	8, 4, 5, 4, 2, 5, 3, 5, 3, 4, 5, 4, 4, 7, 2, 3,
+	7, 3, 3, 0, 8, 0, 8, 8, 8, 0, 8, 8, 4, 0, 8, 0,
+	3, 8, 8, 0, 8, 0, 8, 0, 8, 8, 0, 8, 0, 8, 8, 4,
+	0, 8, 0, 8, 8, 3, 8, 4, 5, 4, 2, 5, 3, 5, 0, 3,
+	4, 5, 4, 4, 7, 2, 3, 7, 3, 0, 3, 0, 8, 0, 8, 8,
+	4, 8, 0, 3, 8, 4, 4, 4, 7, 3, 5, 0, 5, 3, 5, 3,
+	0, 8, 8, 4, 0, 8, 8, 0, 3, 8, 8, 4, 0, 8, 0, 8,
+	8, 0, 3, 8, 4, 0, 4, 2, 8, 8, 3, 5, 3, 4, 0, 4,
+	2, 8, 8, 3, 5, 0, 3, 4, 5, 0, 5, 3, 5, 4, 5, 4,
+	7, 3, 5, 4, 0, 3, 3, 4, 5, 4, 7, 3, 5, 0, 3, 8,
+	4, 4, 5, 0, 5, 3, 5, 3, 0, 4, 5, 4, 7, 3, 5, 0,
+	4, 0, 3, 3, 8, 4, 4, 5, 4, 7, 3, 5, 0, 3, 3, 0,
+	8, 0, 5, 5, 5, 0, 8, 4, 0, 8, 0, 3, 8, 8, 8, 0,
+	0, 8, 0, 8, 8, 0, 8, 8, 0, 8, 4, 0, 8, 0, 8, 3,
+	8, 8, 0, 4, 5, 4, 2, 5, 3, 5, 3, 0, 4, 5, 4, 4,
+	7, 2, 3, 5, 3, 3, 0, 8, 0, 8, 8, 8, 0, 8, 0, 8,
+	4, 0, 8, 0, 3, 8, 8, 0, 8, 0, 0, 8, 8, 4, 0, 8,
+	8, 8, 3, 8, 4, 0, 8, 0, 8, 8, 8, 3, 4, 5, 4, 2,
+	5, 3, 5, 0, 3, 0, 8, 4, 4, 5, 4, 2, 5, 3, 5, 3,
+	3, 0, 8, 0, 8, 8, 4, 8, 0, 8, 3, 8, 4, 0, 8, 8,
+	4, 2, 8, 3, 8, 3, 0, 8, 8, 4, 0, 8, 8, 0, 8, 3,
+	8, 4, 0, 8, 0, 8, 8, 0, 8, 3, 4, 0, 4, 0, 8, 3,
+	8, 3, 5, 4, 0, 4, 2, 8, 8, 3, 5, 0, 3, 0, 4, 5,
+	0, 5, 3, 5, 0, 4, 5, 4, 7, 3, 5, 4, 2, 3, 3, 4,
+	5, 4, 7, 3, 5, 0, 3, 0, 8, 4, 4, 5, 0, 5, 3, 5,
+	3, 4, 5, 4, 7, 3, 5, 0, 4, 2, 3, 3, 8, 4, 4, 5,
+	4, 7, 3, 7, 0, 3, 3, 0, 8, 0, 5, 5, 5, 0, 4, 0,
+	3, 4, 5, 4, 4, 0, 7, 3, 3, 5, 0, 3, 0, 8, 8, 4,
+	0, 8, 8, 8, 0, 3, 0, 8, 4, 0, 8, 0, 8, 8, 8, 0,
+	3, 0, 4, 5, 4, 4, 7, 3, 3, 5, 0, 3, 4, 5, 4, 4,
+	7, 2, 3, 5, 3, 0, 3, 0, 8, 0, 8, 8, 4, 8, 8, 0,
+	3, 5, 5, 4, 4, 4, 2, 10, 0, 3, 3, 3, 0, 8, 8, 4,
+	0, 8, 8, 8, 0, 3, 8, 4, 0, 8, 0, 8, 8, 8, 0, 3,
+	4, 5, 4, 4, 7, 3, 3, 5, 0, 3, 0, 4, 5, 4, 4, 7,
+	2, 3, 5, 3, 0, 3, 0, 0, 8, 0, 8, 8, 4, 8, 0, 8,
+	0, 3, 4, 4, 5, 5, 3, 5, 0, 5, 3, 5, 0, 8, 8, 4,
+	0, 8, 8, 0, 8, 0, 3, 4, 4, 5, 5, 3, 5, 0, 5, 3,
+	5, 0, 4, 0, 4, 0, 3, 8, 8, 3, 5, 4, 0, 4, 0, 3,
+	8, 8, 3, 5, 0, 4, 0, 8, 0, 8, 8, 3, 5, 4, 8, 4,
+	0, 8, 0, 3, 8, 3, 5, 4, 0, 8, 0, 8, 8, 3, 5, 0,
+	8, 4, 4, 5, 0, 5, 3, 5, 0, 3, 4, 4, 5, 0, 5, 3,
+	5, 5, 3, 5, 4, 4, 5, 0, 5, 3, 5, 5, 3, 5, 0, 0,
+	4, 0, 8, 0, 3, 0, 8, 8, 8, 4, 0, 5, 5, 4, 2, 5,
+	3, 5, 3, 0, 4, 0, 8, 0, 3, 0, 8, 8, 0, 8, 4, 0,
+	5, 5, 4, 2, 5, 3, 5, 0, 3, 4, 0, 5, 5, 0, 5, 3,
+	5, 4, 0, 5, 5, 4, 7, 3, 5, 0, 3, 0, 4, 0, 8, 0,
+	3, 0, 8, 8, 8, 0, 4, 0, 5, 5, 4, 2, 5, 3, 5, 3,
+	0, 0, 4, 0, 8, 0, 3, 0, 8, 8, 0, 8, 0, 4, 4, 4,
+	10, 3, 10, 3, 3, 8, 8, 8, 4, 0, 5, 5, 0, 5, 3, 5,
+	0, 4, 0, 5, 5, 4, 7, 3, 5, 0, 3, 0, 5, 5, 4, 4,
+	4, 10, 0, 3, 2, 3, 0, 3, 4, 4, 0, 5, 5, 3, 5, 0,
+	5, 3, 5, 0, 8, 8, 4, 8, 4, 0, 8, 8, 0, 3, 3, 4,
+	4, 0, 5, 5, 3, 5, 0, 5, 3, 5, 0, 4, 0, 4, 0, 3,
+	0, 8, 8, 3, 5, 4, 0, 4, 0, 3, 0, 8, 8, 3, 5, 0,
+	4, 0, 8, 8, 8, 3, 5, 4, 0, 8, 8, 0, 8, 3, 5, 4,
+	0, 8, 8, 8, 3, 5, 0, 4, 0, 8, 8, 0, 8, 3, 5, 0,
+	4, 0, 8, 8, 4, 10, 3, 5, 0, 3, 8, 4, 4, 0, 8, 8,
+	3, 5, 0, 3, 4, 5, 5, 3, 5, 4, 8, 8, 0, 8, 8, 3,
+	5, 4, 5, 5, 3, 5, 4, 0, 3, 8, 4, 4, 5, 5, 3, 5,
+	3, 0, 4, 8, 8, 4, 8, 0, 3, 8, 3, 5, 4, 8, 4, 8,
+	8, 0, 3, 8, 3, 5, 4, 5, 5, 3, 5, 0, 4, 8, 8, 0,
+	8, 8, 3, 5, 0, 4, 5, 5, 3, 5, 4, 0, 3, 0, 8, 4,
+	4, 5, 5, 3, 5, 3, 4, 8, 8, 4, 10, 0, 8, 3, 5, 3,
+	8, 4, 4, 8, 8, 0, 8, 3, 5, 3, 4, 5, 5, 3, 5, 0,
+	4, 0, 3, 8, 4, 4, 5, 5, 3, 5, 0, 3, 0, 4, 5, 5,
+	3, 5, 0, 4, 0, 3, 0, 8, 4, 4, 5, 5, 3, 5, 0, 3,
+	4, 8, 8, 4, 10, 0, 8, 3, 5, 0, 3, 8, 4, 4, 8, 8,
+	0, 8, 3, 5, 0, 3, 4, 4, 0, 5, 3, 5, 5, 3, 5, 4,
+	4, 0, 3, 0, 8, 8, 0, 8, 3, 5, 4, 4, 0, 5, 3, 5,
+	5, 3, 5, 0, 4, 4, 0, 3, 0, 8, 8, 0, 8, 3, 5, 0,
+	8, 8, 4, 4, 8, 0, 8, 0, 5, 0, 3, 3, 8, 4, 8, 4,
+	8, 0, 8, 0, 5, 0, 3, 3, 0, 5, 5, 0, 8, 8, 0, 8,
+	8, 8, 0, 8, 8, 8, 0, 8, 8, 0, 8, 8, 0, 8, 0, 8,
+	8, 0, 8, 8, 4, 8, 0, 3, 8, 8, 8, 4, 0, 8, 8, 0,
+	3, 8, 8, 0, 5, 5, 4, 0, 3, 0, 8, 8, 0, 8, 8, 0,
+	8, 0, 8, 8, 8, 0, 8, 0, 8, 8, 4, 0, 5, 5, 3, 0,
+	0, 8, 8, 4, 8, 0, 8, 3, 8, 8, 4, 0, 8, 8, 0, 8,
+	3, 8, 0, 5, 5, 4, 0, 4, 0, 3, 3, 8, 4, 0, 5, 5,
+	4, 2, 3, 0, 3, 0, 8, 8, 4, 8, 8, 0, 3, 8, 8, 4,
+	0, 5, 5, 4, 2, 3, 3, 4, 4, 8, 0, 8, 3, 5, 3, 5,
+	0, 8, 4, 0, 8, 8, 0, 8, 0, 3, 8, 4, 4, 0, 5, 3,
+	5, 3, 5, 4, 0, 4, 2, 8, 8, 0, 8, 3, 5, 3, 4, 4,
+	4, 7, 3, 5, 3, 5, 0, 3, 4, 4, 0, 8, 0, 5, 3, 5,
+	3, 5, 0, 4, 4, 4, 0, 10, 10, 3, 5, 3, 5, 3, 8, 4,
+	8, 4, 0, 8, 8, 0, 3, 3, 8, 0, 5, 5, 0, 0, 8, 8,
+	0, 8, 8, 8, 0, 0, 8, 8, 8, 0, 8, 8, 0, 0, 8, 8,
+	0, 8, 0, 8, 8, 0, 0, 8, 8, 4, 8, 0, 3, 8, 8, 0,
+	8, 4, 0, 8, 8, 0, 3, 8, 8, 0, 0, 5, 5, 4, 0, 3,
+	0, 0, 8, 8, 0, 8, 8, 0, 8, 0, 0, 8, 8, 4, 8, 8,
+	8, 3, 8, 4, 0, 5, 5, 3, 0, 8, 8, 4, 8, 0, 8, 8,
+	3, 8, 4, 0, 8, 8, 0, 8, 8, 3, 0, 5, 5, 4, 0, 4,
+	2, 3, 3, 0, 8, 8, 8, 4, 0, 8, 0, 8, 3, 0, 8, 8,
+	4, 8, 8, 0, 8, 3, 8, 4, 0, 5, 5, 4, 0, 3, 3, 4,
+	4, 8, 0, 8, 3, 5, 3, 5, 8, 4, 8, 4, 0, 5, 5, 3,
+	0, 3, 4, 4, 0, 5, 3, 5, 3, 5, 0, 8, 4, 0, 8, 8,
+	4, 10, 0, 3, 8, 3, 4, 4, 4, 7, 3, 5, 3, 5, 0, 3,
+	0, 4, 4, 0, 8, 0, 5, 3, 5, 3, 5, 8, 8, 4, 4, 0,
+	8, 8, 0, 3, 8, 3, 8, 4, 8, 4, 0, 8, 8, 0, 3, 8,
+	3, 0, 5, 5, 0, 4, 0, 3, 0, 8, 8, 0, 8, 8, 4, 8,
+	0, 3, 0, 5, 5, 4, 4, 2, 3, 0, 3, 8, 4, 0, 5, 5,
+	0, 3, 0, 0, 8, 8, 4, 8, 0, 8, 8, 0, 3, 0, 8, 4,
+	0, 8, 8, 0, 8, 8, 0, 3, 0, 0, 5, 5, 0, 4, 0, 3,
+	0, 0, 8, 8, 8, 4, 0, 8, 8, 0, 3, 0, 8, 8, 4, 8,
+	8, 8, 0, 3, 8, 4, 0, 5, 5, 0, 3, 0, 8, 8, 4, 8,
+	0, 8, 8, 0, 3, 8, 4, 0, 8, 8, 0, 8, 8, 0, 3, 0,
+	5, 5, 4, 0, 4, 2, 3, 0, 3, 8, 4, 0, 8, 8, 4, 10,
+	8, 3, 3, 0, 8, 8, 4, 8, 8, 0, 8, 0, 3, 8, 4, 0,
+	5, 5, 4, 0, 3, 0, 3, 4, 8, 0, 8, 0, 5, 3, 5, 4,
+	8, 0, 8, 0, 5, 3, 5, 0, 4, 0, 4, 0, 8, 3, 8, 8,
+	3, 5, 8, 4, 0, 8, 8, 4, 10, 0, 8, 3, 3, 4, 0, 4,
+	0, 8, 3, 8, 8, 3, 5, 0, 8, 4, 0, 8, 8, 4, 8, 0,
+	8, 3, 3, 4, 4, 5, 0, 5, 5, 3, 5, 3, 5, 4, 4, 5,
+	0, 5, 5, 3, 5, 3, 5, 0, 4, 0, 8, 0, 8, 8, 8, 3,
+	5, 8, 4, 0, 5, 5, 0, 4, 2, 3, 0, 3, 4, 0, 8, 0,
+	8, 8, 0, 8, 3, 5, 8, 4, 0, 5, 5, 0, 4, 2, 3, 3,
+	4, 4, 5, 0, 5, 3, 5, 3, 5, 4, 4, 5, 4, 7, 3, 5,
+	3, 5, 0, 3, 4, 0, 8, 0, 8, 8, 8, 3, 5, 0, 0, 5,
+	5, 5, 4, 4, 2, 8, 0, 3, 3, 4, 0, 8, 0, 8, 8, 0,
+	8, 3, 5, 0, 8, 4, 0, 5, 5, 0, 4, 0, 3, 3, 4, 4,
+	5, 0, 5, 3, 5, 3, 5, 0, 8, 4, 8, 4, 0, 5, 5, 0,
+	3, 0, 3, 0, 5, 5, 5, 4, 4, 10, 0, 3, 0, 3, 8, 4,
+	0, 8, 8, 4, 10, 8, 0, 3, 3, 0, 8, 8, 4, 8, 4, 8,
+	8, 0, 3, 3, 8, 4, 0, 5, 5, 0, 4, 0, 3, 0, 3, 4,
+	4, 0, 8, 8, 3, 5, 3, 5, 4, 4, 0, 8, 8, 3, 5, 3,
+	5, 0, 4, 4, 5, 5, 3, 5, 3, 5, 4, 4, 8, 8, 0, 8,
+	3, 5, 3, 5, 4, 4, 5, 5, 3, 5, 3, 5, 0, 4, 4, 8,
+	8, 0, 8, 3, 5, 3, 5, 0, 4, 4, 5, 5, 3, 5, 3, 5,
+	0, 4, 0, 3, 8, 4, 4, 8, 0, 8, 0, 5, 3, 5, 0, 3,
+	4, 0, 5, 5, 3, 5, 4, 0, 8, 8, 0, 8, 8, 3, 5, 4,
+	0, 5, 5, 3, 5, 4, 0, 3, 8, 4, 4, 0, 5, 5, 3, 5,
+	3, 0, 4, 0, 8, 8, 4, 8, 0, 3, 8, 3, 5, 4, 8, 4,
+	0, 8, 8, 0, 3, 8, 3, 5, 4, 0, 5, 5, 3, 5, 0, 4,
+	0, 8, 8, 0, 8, 8, 3, 5, 0, 4, 0, 5, 5, 3, 5, 4,
+	0, 3, 0, 8, 4, 4, 0, 5, 5, 3, 5, 3, 4, 0, 8, 8,
+	4, 10, 0, 8, 3, 5, 3, 8, 4, 4, 0, 8, 8, 0, 8, 3,
+	5, 3, 4, 0, 5, 5, 3, 5, 0, 4, 0, 3, 8, 4, 4, 0,
+	5, 5, 3, 5, 0, 3, 0, 4, 0, 5, 5, 3, 5, 0, 4, 0,
+	3, 0, 8, 4, 4, 0, 5, 5, 3, 5, 0, 3, 4, 4, 8, 0,
+	8, 0, 5, 3, 5, 3, 5, 4, 4, 8, 0, 8, 0, 5, 3, 5,
+	3, 5, 0, 4, 4, 0, 5, 5, 3, 5, 3, 5, 4, 4, 0, 8,
+	8, 0, 8, 3, 5, 3, 5, 4, 4, 0, 5, 5, 3, 5, 3, 5,
+	0, 4, 4, 0, 8, 8, 0, 8, 3, 5, 3, 5, 0, 4, 4, 4,
+	0, 8, 8, 3, 5, 3, 5, 3, 5, 4, 4, 4, 0, 8, 8, 3,
+	5, 3, 5, 3, 5, 0,
+};
+
+static const unsigned int	g_offsets[] = {
+	0, 0, 1, 1, 3, 4, 5, 6, 8,
+	8, 12, 15, 17, 19, 23, 24, 29, 33,
+	34, 37, 41, 45, 48, 53, 55, 57, 60,
+	61, 65, 67, 70, 73, 77, 77, 82, 87,
+	91, 95, 101, 104, 111, 116, 118, 123, 129,
+	134, 139, 146, 150, 154, 159, 161, 167, 171,
+	176, 181, 187, 188, 194, 199, 204, 209, 215,
+	219, 226, 230, 231, 236, 241, 247, 253, 259,
+	263, 266, 271, 274, 280, 285, 289, 294, 301,
+	305, 312, 318, 321, 327, 333, 338, 345, 350,
+	352, 358, 364, 370, 374, 381, 386, 388, 391,
+	395, 401, 406, 412, 416, 421, 425, 430, 436,
+	441, 444, 449, 454, 460, 467, 472, 476, 482,
+	489, 494, 502, 508, 511, 515, 517, 521, 524,
+	529, 535, 541, 542, 547, 551, 555, 560, 567,
+	569, 575, 580, 583, 589, 596, 601, 607, 613,
+	618, 623, 629, 632, 637, 641, 647, 653, 660,
+	660, 665, 672, 678, 684, 692, 697, 705, 712,
+	716, 723, 731, 738, 745, 754, 760, 766, 773,
+	777, 785, 791, 798, 805, 813, 816, 824, 831,
+	838, 845, 853, 859, 868, 873, 875, 882, 889,
+	897, 905, 913, 919, 924, 931, 936, 944, 951,
+	957, 964, 973, 979, 988, 996, 1001, 1009, 1017,
+	1024, 1033, 1040, 1044, 1052, 1060, 1068, 1074, 1083,
+	1090, 1094, 1099, 1105, 1113, 1120, 1128, 1134, 1141,
+	1146, 1153, 1161, 1168, 1173, 1180, 1187, 1195, 1204,
+	1211, 1217, 1225, 1234, 1241, 1251, 1259, 1264, 1270,
+	1274, 1280, 1285, 1292, 1300, 1308, 1310, 1317, 1323,
+	1329, 1336, 1345, 1349, 1357, 1364, 1369, 1377, 1386,
+	1393, 1401, 1409, 1416, 1423, 1431, 1436, 1443, 1449,
+	1457, 1465, 1474, 1475, 1481, 1488, 1494, 1500, 1509,
+	1514, 1523, 1531, 1536, 1543, 1551, 1559, 1566, 1575,
+	1581, 1587, 1594, 1599, 1607, 1613, 1620, 1627, 1635,
+	1639, 1647, 1654, 1661, 1668, 1676, 1683, 1691, 1695,
+	1696, 1703, 1709, 1717, 1725, 1732, 1738, 1743, 1750,
+	1756, 1764, 1772, 1779, 1786, 1794, 1800, 1809, 1817,
+	1823, 1831, 1839, 1847, 1856, 1863, 1867, 1875, 1882,
+	1889, 1895, 1903, 1910, 1913, 1918, 1924, 1932, 1940,
+	1948, 1955, 1963, 1969, 1976, 1984, 1991, 1997, 2004,
+	2012, 2020, 2028, 2035, 2041, 2049, 2058, 2066, 2075,
+	2083, 2088, 2095, 2100, 2106, 2112, 2119, 2127, 2135,
+	2138, 2145, 2151, 2158, 2166, 2175, 2180, 2188, 2195,
+	2199, 2207, 2215, 2222, 2231, 2240, 2247, 2254, 2262,
+	2268, 2275, 2282, 2290, 2298, 2307, 2311, 2319, 2326,
+	2333, 2340, 2348, 2354, 2363, 2369, 2372, 2379, 2386,
+	2394, 2402, 2410, 2416, 2422, 2430, 2436, 2444, 2451,
+	2458, 2465, 2474, 2479, 2488, 2495, 2503, 2511, 2519,
+	2526, 2535, 2540, 2542, 2549, 2556, 2564, 2572, 2580,
+	2586, 2592, 2600, 2607, 2615, 2623, 2631, 2638, 2647,
+	2654, 2663, 2670, 2676, 2684, 2691, 2699, 2708, 2716,
+	2721, 2729, 2737, 2743, 2748, 2755, 2761, 2763, 2766,
+	2772, 2779, 2786, 2794, 2799, 2805, 2812, 2820, 2829,
+	2836, 2843, 2851, 2859, 2867, 2876, 2883, 2890, 2899,
+	2907, 2913, 2922, 2929, 2934, 2940, 2944, 2950, 2955,
+	2961, 2968, 2976, 2982, 2989, 2996, 3003, 3011, 3020,
+	3027, 3035, 3043, 3049, 3057, 3066, 3073, 3080, 3088,
+	3096, 3102, 3109, 3115, 3123, 3130, 3138, 3145, 3153,
+	3160, 3168, 3176, 3182, 3190, 3198, 3206, 3215, 3223,
+	3228, 3236, 3244, 3251, 3257, 3266, 3273, 3278, 3284,
+	3290, 3298, 3306, 3315, 3321, 3328, 3335, 3344, 3352,
+	3359, 3367, 3375, 3383, 3392, 3400, 3405, 3413, 3421,
+	3429, 3436, 3445, 3452, 3456, 3462, 3469, 3478, 3487,
+	3496, 3503, 3511, 3519, 3528, 3536, 3543, 3551, 3559,
+	3568, 3577, 3586, 3592, 3601, 3609, 3616, 3622, 3630,
+	3637, 3640, 3644, 3651, 3659, 3667, 3676, 3682, 3689,
+	3695, 3701, 3709, 3716, 3720, 3726, 3733, 3740, 3749,
+	3757, 3762, 3769, 3778, 3786, 3796, 3805, 3811, 3818,
+	3821, 3825, 3829, 3834, 3840, 3846, 3851, 3858, 3864,
+	3871, 3877, 3885, 3891, 3899, 3906, 3913, 3920, 3929,
+	3937, 3946, 3954, 3962, 3969, 3977, 3981, 3988, 3993,
+	4000, 4008, 4016, 4020, 4027, 4034, 4042, 4047, 4054,
+	4061, 4069, 4077, 4084, 4090, 4098, 4106, 4114, 4123,
+	4132, 4138, 4145, 4148, 4155, 4160, 4167, 4175, 4183,
+	4188, 4195, 4203, 4211, 4217, 4224, 4232, 4240, 4247,
+	4253, 4260, 4268, 4277, 4286, 4295, 4303, 4309, 4317,
+	4321, 4328, 4334, 4340, 4348, 4356, 4364, 4372, 4381,
+	4389, 4396, 4404, 4413, 4422, 4430, 4437, 4445, 4454,
+	4463, 4470, 4480, 4488, 4494, 4501, 4506, 4513, 4519,
+	4526, 4533, 4541, 4548, 4555, 4564, 4572, 4577, 4584,
+	4592, 4600, 4610, 4619, 4625, 4633, 4643, 4651, 4661,
+	4670, 4677, 4685, 4689, 4694, 4699, 4705, 4712, 4719,
+	4721, 4726, 4731, 4737, 4744, 4751, 4754, 4760, 4766,
+	4771, 4778, 4785, 4791, 4798, 4805, 4811, 4819, 4827,
+	4833, 4841, 4848, 4857, 4866, 4875, 4876, 4882, 4888,
+	4895, 4902, 4910, 4914, 4921, 4928, 4932, 4940, 4948,
+	4955, 4963, 4971, 4978, 4985, 4993, 4998, 5006, 5013,
+	5021, 5029, 5038, 5040, 5047, 5053, 5061, 5069, 5078,
+	5083, 5091, 5097, 5100, 5108, 5116, 5123, 5132, 5140,
+	5147, 5153, 5160, 5166, 5174, 5182, 5189, 5197, 5207,
+	5212, 5220, 5227, 5233, 5242, 5251, 5257, 5265, 5272,
+	5277, 5286, 5295, 5303, 5310, 5319, 5327, 5332, 5338,
+	5345, 5354, 5362, 5371, 5378, 5386, 5392, 5400, 5407,
+	5415, 5421, 5429, 5436, 5445, 5453, 5461, 5468, 5477,
+	5486, 5494, 5503, 5512, 5518, 5525, 5530, 5537, 5543,
+	5551, 5560, 5569, 5572, 5578, 5584, 5591, 5599, 5607,
+	5611, 5618, 5625, 5631, 5639, 5647, 5654, 5662, 5670,
+	5677, 5685, 5694, 5700, 5708, 5715, 5724, 5733, 5743,
+	5743, 5748, 5755, 5763, 5771, 5780, 5787, 5796, 5805,
+	5811, 5820, 5830, 5839, 5848, 5858, 5866, 5874, 5883,
+	5889, 5899, 5907, 5916, 5925, 5935, 5940, 5949, 5958,
+	5967, 5976, 5986, 5994, 6004, 6011, 6015, 6024, 6033,
+	6043, 6053, 6063, 6071, 6078, 6087, 6094, 6104, 6113,
+	6121, 6130, 6141, 6149, 6159, 6169, 6176, 6186, 6196,
+	6205, 6216, 6225, 6231, 6241, 6251, 6261, 6269, 6280,
+	6289, 6295, 6302, 6310, 6320, 6329, 6339, 6347, 6356,
+	6363, 6372, 6382, 6391, 6398, 6407, 6416, 6426, 6437,
+	6446, 6454, 6464, 6475, 6484, 6496, 6506, 6513, 6521,
+	6527, 6535, 6542, 6551, 6561, 6571, 6575, 6584, 6592,
+	6600, 6609, 6620, 6626, 6636, 6645, 6652, 6662, 6673,
+	6682, 6692, 6702, 6711, 6720, 6730, 6737, 6746, 6754,
+	6764, 6774, 6785, 6788, 6796, 6805, 6813, 6821, 6832,
+	6839, 6849, 6859, 6866, 6875, 6885, 6895, 6904, 6915,
+	6923, 6932, 6941, 6948, 6958, 6966, 6975, 6984, 6994,
+	7000, 7010, 7019, 7028, 7037, 7048, 7056, 7065, 7070,
+	7072, 7080, 7087, 7097, 7107, 7116, 7124, 7131, 7140,
+	7148, 7158, 7168, 7177, 7186, 7196, 7204, 7215, 7225,
+	7233, 7243, 7253, 7263, 7274, 7283, 7289, 7299, 7308,
+	7317, 7325, 7335, 7344, 7349, 7356, 7364, 7374, 7384,
+	7394, 7403, 7413, 7421, 7430, 7440, 7449, 7457, 7466,
+	7476, 7486, 7496, 7505, 7513, 7523, 7534, 7544, 7555,
+	7565, 7572, 7581, 7588, 7596, 7604, 7613, 7623, 7633,
+	7638, 7647, 7655, 7664, 7674, 7685, 7692, 7702, 7711,
+	7717, 7727, 7737, 7746, 7757, 7768, 7777, 7786, 7796,
+	7804, 7813, 7822, 7832, 7842, 7853, 7859, 7869, 7878,
+	7887, 7896, 7907, 7915, 7926, 7934, 7939, 7948, 7957,
+	7967, 7977, 7987, 7995, 8003, 8013, 8021, 8031, 8040,
+	8049, 8058, 8069, 8076, 8087, 8096, 8106, 8116, 8127,
+	8136, 8147, 8154, 8158, 8167, 8176, 8186, 8196, 8206,
+	8214, 8222, 8232, 8241, 8251, 8261, 8271, 8280, 8291,
+	8300, 8311, 8320, 8328, 8338, 8347, 8357, 8368, 8378,
+	8385, 8395, 8405, 8413, 8420, 8429, 8437, 8441, 8446,
+	8454, 8463, 8472, 8482, 8489, 8497, 8506, 8516, 8527,
+	8536, 8545, 8555, 8565, 8575, 8586, 8595, 8604, 8615,
+	8625, 8633, 8644, 8653, 8660, 8668, 8674, 8682, 8689,
+	8697, 8706, 8716, 8724, 8733, 8742, 8751, 8761, 8772,
+	8781, 8791, 8801, 8809, 8819, 8830, 8839, 8848, 8858,
+	8868, 8876, 8885, 8893, 8903, 8912, 8922, 8931, 8941,
+	8949, 8958, 8968, 8976, 8986, 8996, 9006, 9017, 9027,
+	9034, 9044, 9054, 9063, 9071, 9082, 9091, 9098, 9106,
+	9114, 9124, 9134, 9145, 9153, 9162, 9171, 9182, 9192,
+	9201, 9211, 9221, 9231, 9242, 9252, 9259, 9269, 9279,
+	9289, 9298, 9309, 9318, 9324, 9332, 9341, 9352, 9363,
+	9374, 9383, 9393, 9403, 9414, 9424, 9433, 9443, 9453,
+	9464, 9475, 9486, 9494, 9505, 9515, 9524, 9532, 9542,
+	9551, 9556, 9562, 9571, 9581, 9591, 9602, 9610, 9619,
+	9627, 9635, 9645, 9654, 9660, 9668, 9677, 9686, 9697,
+	9707, 9714, 9723, 9734, 9744, 9756, 9767, 9775, 9784,
+	9789, 9795, 9801, 9808, 9816, 9824, 9831, 9840, 9848,
+	9857, 9865, 9875, 9883, 9893, 9902, 9911, 9920, 9931,
+	9941, 9952, 9962, 9972, 9981, 9991, 9997, 10006, 10013,
+	10022, 10032, 10042, 10047, 10055, 10064, 10074, 10081, 10090,
+	10099, 10109, 10119, 10128, 10136, 10146, 10156, 10166, 10177,
+	10188, 10196, 10205, 10210, 10219, 10226, 10235, 10245, 10255,
+	10262, 10271, 10281, 10291, 10299, 10308, 10318, 10328, 10337,
+	10345, 10354, 10364, 10375, 10386, 10397, 10407, 10415, 10425,
+	10431, 10440, 10448, 10456, 10466, 10476, 10486, 10496, 10507,
+	10517, 10526, 10536, 10547, 10558, 10568, 10577, 10587, 10598,
+	10609, 10618, 10630, 10640, 10648, 10657, 10664, 10673, 10681,
+	10690, 10699, 10709, 10718, 10727, 10738, 10748, 10755, 10764,
+	10774, 10784, 10796, 10807, 10815, 10825, 10837, 10847, 10860,
+	10871, 10880, 10890, 10896, 10903, 10910, 10918, 10927, 10936,
+	10940, 10947, 10954, 10962, 10971, 10980, 10985, 10993, 11001,
+	11008, 11017, 11026, 11034, 11043, 11052, 11060, 11070, 11080,
+	11088, 11098, 11107, 11118, 11129, 11140, 11142, 11149, 11157,
+	11166, 11175, 11185, 11191, 11200, 11209, 11215, 11225, 11235,
+	11244, 11254, 11264, 11273, 11282, 11292, 11299, 11309, 11318,
+	11328, 11338, 11349, 11353, 11362, 11370, 11380, 11390, 11401,
+	11408, 11418, 11426, 11431, 11441, 11451, 11460, 11471, 11481,
+	11490, 11498, 11507, 11515, 11525, 11535, 11544, 11554, 11566,
+	11573, 11583, 11592, 11600, 11611, 11622, 11630, 11640, 11649,
+	11656, 11667, 11678, 11688, 11697, 11708, 11718, 11725, 11733,
+	11742, 11753, 11763, 11774, 11783, 11793, 11801, 11811, 11820,
+	11830, 11838, 11848, 11857, 11868, 11878, 11888, 11897, 11908,
+	11919, 11929, 11940, 11951, 11959, 11968, 11975, 11984, 11992,
+	12002, 12013, 12024, 12029, 12037, 12045, 12054, 12064, 12074,
+	12080, 12089, 12098, 12106, 12116, 12126, 12135, 12145, 12155,
+	12164, 12174, 12185, 12193, 12203, 12212, 12223, 12234, 12246,
+	12247, 12253, 12261, 12269, 12277, 12287, 12294, 12304, 12313,
+	12319, 12328, 12338, 12347, 12356, 12367, 12376, 12384, 12393,
+	12399, 12409, 12418, 12427, 12436, 12446, 12451, 12461, 12470,
+	12479, 12488, 12499, 12507, 12518, 12526, 12531, 12540, 12549,
+	12559, 12569, 12579, 12587, 12594, 12603, 12610, 12620, 12629,
+	12637, 12646, 12657, 12665, 12676, 12686, 12693, 12703, 12713,
+	12722, 12733, 12742, 12748, 12758, 12768, 12778, 12786, 12797,
+	12806, 12812, 12819, 12827, 12837, 12846, 12856, 12864, 12873,
+	12881, 12890, 12900, 12909, 12916, 12925, 12934, 12944, 12955,
+	12964, 12972, 12982, 12993, 13002, 13014, 13024, 13031, 13039,
+	13045, 13053, 13060, 13069, 13079, 13089, 13094, 13103, 13111,
+	13119, 13128, 13139, 13145, 13155, 13164, 13171, 13181, 13192,
+	13201, 13211, 13221, 13230, 13239, 13249, 13256, 13265, 13273,
+	13283, 13293, 13304, 13308, 13317, 13326, 13335, 13343, 13354,
+	13361, 13371, 13381, 13388, 13397, 13407, 13417, 13426, 13437,
+	13446, 13454, 13463, 13470, 13480, 13488, 13497, 13506, 13516,
+	13523, 13532, 13541, 13551, 13560, 13570, 13577, 13585, 13589,
+	13590, 13597, 13603, 13613, 13623, 13631, 13638, 13645, 13654,
+	13663, 13673, 13682, 13690, 13699, 13708, 13716, 13727, 13737,
+	13746, 13756, 13766, 13775, 13785, 13793, 13799, 13809, 13817,
+	13826, 13834, 13844, 13853, 13858, 13865, 13873, 13883, 13893,
+	13903, 13912, 13923, 13932, 13941, 13951, 13960, 13968, 13977,
+	13987, 13997, 14006, 14014, 14022, 14031, 14042, 14052, 14062,
+	14071, 14078, 14087, 14094, 14102, 14111, 14120, 14130, 14140,
+	14146, 14155, 14163, 14173, 14183, 14194, 14202, 14212, 14221,
+	14228, 14238, 14247, 14256, 14267, 14277, 14286, 14295, 14305,
+	14313, 14322, 14332, 14342, 14353, 14364, 14370, 14380, 14389,
+	14398, 14407, 14418, 14426, 14437, 14446, 14452, 14461, 14470,
+	14480, 14490, 14500, 14508, 14516, 14526, 14534, 14544, 14553,
+	14562, 14571, 14582, 14590, 14600, 14609, 14619, 14629, 14639,
+	14648, 14658, 14665, 14669, 14678, 14686, 14696, 14706, 14715,
+	14723, 14731, 14741, 14751, 14761, 14771, 14780, 14789, 14799,
+	14808, 14819, 14828, 14836, 14846, 14855, 14865, 14876, 14886,
+	14893, 14903, 14913, 14920, 14926, 14934, 14942, 14945, 14950,
+	14958, 14967, 14977, 14987, 14995, 15004, 15013, 15023, 15034,
+	15043, 15052, 15062, 15073, 15083, 15094, 15103, 15112, 15123,
+	15133, 15142, 15153, 15163, 15170, 15179, 15185, 15193, 15201,
+	15209, 15219, 15229, 15237, 15246, 15255, 15265, 15275, 15286,
+	15295, 15305, 15315, 15323, 15333, 15344, 15353, 15363, 15374,
+	15384, 15392, 15401, 15409, 15419, 15429, 15439, 15449, 15460,
+	15469, 15479, 15489, 15497, 15507, 15517, 15527, 15538, 15548,
+	15555, 15565, 15575, 15585, 15593, 15604, 15613, 15620, 15628,
+	15637, 15647, 15657, 15668, 15676, 15685, 15694, 15705, 15715,
+	15724, 15734, 15744, 15754, 15765, 15774, 15781, 15791, 15800,
+	15810, 15819, 15829, 15838, 15844, 15852, 15861, 15872, 15883,
+	15893, 15902, 15913, 15923, 15934, 15944, 15953, 15963, 15973,
+	15984, 15995, 16005, 16013, 16024, 16034, 16043, 16051, 16061,
+	16071, 16076, 16083, 16092, 16103, 16114, 16125, 16134, 16144,
+	16153, 16161, 16171, 16180, 16187, 16195, 16205, 16214, 16225,
+	16235, 16243, 16252, 16263, 16273, 16285, 16296, 16304, 16314,
+	16319, 16325, 16332, 16339, 16347, 16355, 16362, 16371, 16379,
+	16388, 16397, 16407, 16416, 16427, 16436, 16445, 16455, 16466,
+	16476, 16487, 16497, 16507, 16516, 16527, 16534, 16543, 16551,
+	16560, 16570, 16580, 16586, 16595, 16604, 16614, 16621, 16631,
+	16640, 16650, 16660, 16670, 16678, 16688, 16699, 16709, 16720,
+	16731, 16739, 16748, 16754, 16763, 16770, 16779, 16789, 16799,
+	16807, 16816, 16827, 16837, 16845, 16854, 16864, 16874, 16882,
+	16889, 16898, 16907, 16918, 16929, 16939, 16948, 16956, 16966,
+	16973, 16982, 16991, 16999, 17009, 17019, 17029, 17039, 17050,
+	17060, 17069, 17079, 17090, 17101, 17111, 17120, 17130, 17140,
+	17151, 17161, 17173, 17184, 17192, 17202, 17209, 17218, 17227,
+	17236, 17246, 17257, 17267, 17276, 17287, 17297, 17305, 17314,
+	17325, 17335, 17346, 17356, 17365, 17375, 17387, 17398, 17410,
+	17421, 17430, 17441, 17447, 17454, 17462, 17470, 17479, 17488,
+	17493, 17500, 17507, 17515, 17524, 17533, 17539, 17548, 17556,
+	17563, 17572, 17581, 17589, 17599, 17608, 17616, 17626, 17636,
+	17645, 17655, 17665, 17676, 17687, 17698, 17701, 17709, 17717,
+	17726, 17735, 17745, 17751, 17760, 17769, 17776, 17786, 17796,
+	17805, 17815, 17825, 17834, 17843, 17853, 17861, 17871, 17880,
+	17890, 17900, 17911, 17916, 17926, 17934, 17944, 17954, 17965,
+	17973, 17983, 17990, 17994, 18004, 18013, 18022, 18033, 18043,
+	18052, 18060, 18069, 18078, 18088, 18099, 18109, 18120, 18131,
+	18138, 18148, 18157, 18166, 18177, 18188, 18197, 18207, 18216,
+	18223, 18234, 18244, 18254, 18264, 18275, 18285, 18292, 18300,
+	18309, 18320, 18331, 18342, 18352, 18363, 18371, 18381, 18390,
+	18400, 18409, 18419, 18429, 18440, 18450, 18460, 18469, 18480,
+	18491, 18502, 18513, 18524, 18532, 18542, 18550, 18559, 18568,
+	18578, 18589, 18600, 18606, 18614, 18622, 18631, 18641, 18651,
+	18658, 18668, 18677, 18685, 18695, 18705, 18714, 18725, 18735,
+	18744, 18754, 18765, 18774, 18784, 18794, 18805, 18816, 18828,
+	18832, 18841, 18850, 18858, 18867, 18878, 18885, 18895, 18905,
+	18912, 18921, 18931, 18941, 18950, 18961, 18969, 18977, 18986,
+	18993, 19003, 19012, 19021, 19030, 19040, 19046, 19056, 19065,
+	19074, 19083, 19094, 19103, 19113, 19119, 19122, 19131, 19139,
+	19149, 19159, 19168, 19176, 19183, 19192, 19200, 19210, 19220,
+	19229, 19239, 19249, 19257, 19268, 19278, 19286, 19296, 19306,
+	19316, 19327, 19336, 19342, 19352, 19361, 19371, 19380, 19391,
+	19400, 19406, 19414, 19422, 19432, 19442, 19452, 19461, 19471,
+	19480, 19489, 19499, 19508, 19516, 19525, 19535, 19545, 19555,
+	19564, 19572, 19582, 19593, 19603, 19614, 19624, 19631, 19640,
+	19647, 19655, 19663, 19672, 19682, 19692, 19698, 19707, 19715,
+	19724, 19734, 19745, 19752, 19762, 19772, 19779, 19789, 19799,
+	19808, 19819, 19830, 19839, 19848, 19858, 19866, 19875, 19884,
+	19894, 19904, 19915, 19920, 19930, 19939, 19948, 19957, 19968,
+	19975, 19986, 19996, 20004, 20013, 20023, 20033, 20042, 20053,
+	20061, 20070, 20079, 20087, 20097, 20105, 20114, 20123, 20133,
+	20140, 20150, 20159, 20169, 20178, 20189, 20197, 20206, 20211,
+	20213, 20221, 20228, 20238, 20248, 20257, 20265, 20272, 20281,
+	20290, 20300, 20310, 20319, 20329, 20339, 20347, 20358, 20368,
+	20377, 20387, 20397, 20407, 20418, 20427, 20433, 20443, 20452,
+	20462, 20471, 20482, 20491, 20497, 20505, 20513, 20523, 20533,
+	20543, 20552, 20563, 20572, 20581, 20591, 20600, 20608, 20617,
+	20628, 20638, 20648, 20657, 20665, 20675, 20686, 20696, 20707,
+	20717, 20724, 20733, 20740, 20748, 20757, 20766, 20776, 20786,
+	20793, 20802, 20810, 20820, 20830, 20841, 20849, 20859, 20869,
+	20877, 20887, 20897, 20906, 20917, 20928, 20937, 20947, 20957,
+	20965, 20974, 20984, 20994, 21004, 21015, 21022, 21032, 21041,
+	21051, 21061, 21072, 21081, 21091, 21099, 21105, 21115, 21123,
+	21133, 21143, 21152, 21160, 21168, 21178, 21187, 21197, 21207,
+	21216, 21226, 21236, 21244, 21254, 21263, 21273, 21283, 21294,
+	21303, 21313, 21321, 21326, 21336, 21345, 21355, 21365, 21375,
+	21383, 21391, 21401, 21410, 21420, 21430, 21440, 21450, 21461,
+	21470, 21480, 21488, 21495, 21504, 21512, 21521, 21531, 21540,
+	21548, 21558, 21567, 21573, 21578, 21585, 21591, 21593, 21596,
+	21604, 21612, 21621, 21630, 21636, 21643, 21652, 21662, 21672,
+	21681, 21690, 21700, 21710, 21720, 21731, 21740, 21750, 21761,
+	21770, 21777, 21787, 21795, 21801, 21808, 21814, 21822, 21829,
+	21837, 21845, 21854, 21862, 21871, 21881, 21890, 21900, 21910,
+	21919, 21929, 21939, 21948, 21958, 21969, 21978, 21986, 21996,
+	22005, 22012, 22020, 22028, 22038, 22047, 22057, 22065, 22074,
+	22083, 22093, 22103, 22112, 22122, 22132, 22142, 22153, 22163,
+	22170, 22180, 22190, 22200, 22209, 22220, 22229, 22236, 22245,
+	22254, 22265, 22276, 22287, 22296, 22306, 22315, 22326, 22336,
+	22345, 22355, 22365, 22375, 22386, 22396, 22403, 22413, 22423,
+	22433, 22442, 22453, 22462, 22469, 22478, 22487, 22498, 22509,
+	22520, 22529, 22540, 22550, 22561, 22570, 22578, 22588, 22597,
+	22607, 22618, 22628, 22637, 22648, 22658, 22667, 22674, 22684,
+	22692, 22697, 22703, 22712, 22721, 22731, 22741, 22748, 22756,
+	22764, 22772, 22782, 22792, 22799, 22808, 22817, 22826, 22836,
+	22846, 22854, 22863, 22874, 22883, 22894, 22904, 22912, 22921,
+	22925, 22931, 22936, 22942, 22950, 22958, 22965, 22974, 22983,
+	22992, 23002, 23013, 23021, 23031, 23040, 23049, 23059, 23070,
+	23080, 23090, 23101, 23112, 23121, 23131, 23139, 23149, 23158,
+	23168, 23178, 23189, 23197, 23207, 23216, 23226, 23234, 23244,
+	23254, 23264, 23274, 23283, 23292, 23302, 23313, 23324, 23335,
+	23345, 23353, 23363, 23370, 23379, 23387, 23396, 23406, 23416,
+	23425, 23435, 23445, 23455, 23464, 23473, 23483, 23493, 23502,
+	23510, 23519, 23529, 23540, 23551, 23562, 23573, 23581, 23591,
+	23599, 23608, 23617, 23626, 23636, 23646, 23656, 23667, 23677,
+	23686, 23696, 23706, 23717, 23728, 23739, 23749, 23759, 23770,
+	23780, 23788, 23799, 23808, 23815, 23823, 23830, 23839, 23847,
+	23856, 23864, 23873, 23883, 23893, 23905, 23916, 23925, 23935,
+	23946, 23956, 23968, 23979, 23989, 24000, 24011, 24020, 24032,
+	24042, 24050, 24059, 24065, 24073, 24080, 24088, 24098, 24108,
+	24114, 24121, 24129, 24137, 24146, 24155, 24162, 24170, 24178,
+	24186, 24195, 24204, 24213, 24223, 24233, 24242, 24251, 24261,
+	24270, 24281, 24291, 24302, 24312, 24323, 24329, 24337, 24345,
+	24354, 24364, 24374, 24381, 24391, 24400, 24407, 24417, 24427,
+	24436, 24447, 24457, 24466, 24475, 24486, 24495, 24505, 24515,
+	24526, 24536, 24548, 24555, 24564, 24572, 24582, 24593, 24604,
+	24612, 24622, 24630, 24636, 24646, 24656, 24665, 24676, 24686,
+	24695, 24704, 24714, 24723, 24733, 24744, 24755, 24765, 24777,
+	24785, 24795, 24805, 24814, 24825, 24835, 24844, 24854, 24864,
+	24872, 24883, 24894, 24904, 24912, 24922, 24931, 24937, 24944,
+	24953, 24963, 24973, 24984, 24992, 25001, 25009, 25019, 25029,
+	25039, 25049, 25060, 25069, 25080, 25090, 25100, 25110, 25122,
+	25133, 25142, 25154, 25164, 25172, 25181, 25189, 25199, 25208,
+	25218, 25228, 25239, 25246, 25254, 25263, 25272, 25282, 25292,
+	25300, 25309, 25318, 25327, 25337, 25347, 25357, 25367, 25378,
+	25388, 25397, 25407, 25416, 25427, 25437, 25448, 25458, 25469,
+	25476, 25485, 25494, 25503, 25513, 25523, 25531, 25542, 25551,
+	25557, 25566, 25575, 25585, 25595, 25605, 25613, 25621, 25631,
+	25640, 25650, 25659, 25669, 25678, 25689, 25697, 25707, 25716,
+	25726, 25736, 25746, 25755, 25766, 25774, 25779, 25788, 25798,
+	25808, 25818, 25829, 25837, 25845, 25855, 25864, 25874, 25884,
+	25894, 25903, 25914, 25923, 25934, 25943, 25951, 25961, 25970,
+	25980, 25991, 26001, 26008, 26018, 26028, 26037, 26044, 26054,
+	26062, 26067, 26073, 26081, 26090, 26099, 26109, 26116, 26124,
+	26133, 26143, 26154, 26163, 26172, 26182, 26192, 26202, 26213,
+	26222, 26231, 26242, 26252, 26260, 26271, 26280, 26287, 26295,
+	26302, 26311, 26319, 26328, 26337, 26347, 26355, 26364, 26373,
+	26383, 26393, 26404, 26413, 26423, 26433, 26442, 26452, 26463,
+	26472, 26481, 26491, 26501, 26509, 26518, 26526, 26536, 26545,
+	26555, 26564, 26574, 26581, 26591, 26600, 26609, 26619, 26630,
+	26638, 26649, 26658, 26665, 26674, 26683, 26693, 26703, 26713,
+	26721, 26729, 26739, 26748, 26758, 26767, 26777, 26786, 26797,
+	26805, 26816, 26825, 26835, 26845, 26856, 26866, 26877, 26885,
+	26890, 26899, 26908, 26918, 26928, 26938, 26946, 26954, 26964,
+	26973, 26983, 26993, 27003, 27012, 27023, 27032, 27043, 27052,
+	27060, 27070, 27079, 27089, 27100, 27110, 27117, 27127, 27137,
+	27145, 27152, 27161, 27170, 27174, 27180, 27188, 27198, 27208,
+	27218, 27226, 27235, 27244, 27254, 27265, 27274, 27283, 27293,
+	27304, 27314, 27325, 27334, 27343, 27354, 27364, 27373, 27384,
+	27394, 27401, 27410, 27417, 27426, 27435, 27444, 27454, 27465,
+	27473, 27482, 27491, 27501, 27511, 27522, 27531, 27541, 27551,
+	27560, 27570, 27581, 27590, 27600, 27611, 27621, 27630, 27640,
+	27648, 27658, 27668, 27678, 27688, 27699, 27707, 27717, 27726,
+	27736, 27746, 27757, 27766, 27777, 27786, 27793, 27803, 27812,
+	27822, 27832, 27842, 27850, 27859, 27870, 27879, 27889, 27899,
+	27909, 27918, 27929, 27938, 27949, 27958, 27968, 27978, 27989,
+	27999, 28010, 28019, 28025, 28035, 28045, 28055, 28065, 28076,
+	28084, 28093, 28104, 28114, 28124, 28134, 28145, 28154, 28165,
+	28175, 28186, 28195, 28203, 28213, 28222, 28232, 28243, 28253,
+	28261, 28272, 28282, 28289, 28295, 28303, 28310, 28313, 28317,
+	28325, 28334, 28343, 28353, 28360, 28368, 28377, 28388, 28399,
+	28408, 28418, 28429, 28439, 28449, 28460, 28469, 28479, 28490,
+	28500, 28508, 28519, 28528, 28535, 28543, 28550, 28559, 28567,
+	28576, 28585, 28595, 28603, 28612, 28622, 28632, 28642, 28653,
+	28662, 28672, 28682, 28692, 28702, 28713, 28722, 28731, 28741,
+	28751, 28759, 28768, 28776, 28786, 28795, 28805, 28814, 28824,
+	28833, 28843, 28852, 28860, 28870, 28879, 28889, 28900, 28910,
+	28918, 28929, 28939, 28947, 28954, 28964, 28972, 28978, 28985,
+	28993, 29002, 29012, 29022, 29029, 29037, 29047, 29058, 29067,
+	29075, 29086, 29095, 29105, 29116, 29126, 29134, 29145, 29155,
+	29164, 29172, 29182, 29191, 29198, 29206, 29215, 29225, 29236,
+	29247, 29255, 29264, 29274, 29285, 29295, 29304, 29315, 29325,
+	29336, 29347, 29357, 29366, 29377, 29387, 29397, 29406, 29417,
+	29427, 29433, 29440, 29449, 29460, 29470, 29481, 29490, 29500,
+	29507, 29514, 29522, 29530, 29535, 29542, 29550, 29558, 29567,
+	29576, 29582, 29590, 29600, 29609, 29619, 29629, 29638, 29647,
+	29650, 29654, 29658, 29663, 29669, 29675, 29682, 29691, 29699,
+	29708, 29715, 29724, 29732, 29742, 29751, 29760, 29768, 29778,
+	29788, 29799, 29809, 29819, 29829, 29840, 29845, 29853, 29859,
+	29867, 29876, 29885, 29893, 29902, 29912, 29922, 29931, 29941,
+	29950, 29960, 29970, 29980, 29990, 30001, 30011, 30020, 30032,
+	30042, 30050, 30059, 30066, 30076, 30085, 30095, 30104, 30114,
+	30123, 30133, 30144, 30154, 30164, 30174, 30184, 30194, 30204,
+	30214, 30224, 30235, 30246, 30256, 30268, 30279, 30287, 30297,
+	30305, 30315, 30325, 30335, 30345, 30356, 30366, 30377, 30389,
+	30399, 30409, 30420, 30431, 30441, 30452, 30462, 30472, 30483,
+	30494, 30504, 30516, 30527, 30535, 30544, 30552, 30562, 30571,
+	30581, 30591, 30602, 30610, 30618, 30629, 30638, 30644, 30652,
+	30661, 30670, 30681, 30691, 30698, 30707, 30718, 30728, 30740,
+	30751, 30761, 30771, 30776, 30783, 30789, 30797, 30806, 30815,
+	30820, 30827, 30833, 30840, 30849, 30858, 30864, 30872, 30879,
+	30886, 30895, 30904, 30912, 30921, 30929, 30937, 30946, 30955,
+	30962, 30972, 30980, 30990, 31001, 31012, 31019, 31027, 31036,
+	31045, 31055, 31065, 31073, 31082, 31091, 31100, 31110, 31120,
+	31130, 31139, 31150, 31160, 31168, 31177, 31186, 31197, 31207,
+	31218, 31227, 31237, 31245, 31254, 31263, 31273, 31284, 31295,
+	31304, 31314, 31323, 31332, 31342, 31352, 31362, 31372, 31383,
+	31393, 31401, 31411, 31420, 31431, 31442, 31453, 31463, 31474,
+	31483, 31493, 31503, 31513, 31524, 31535, 31545, 31555, 31565,
+	31575, 31586, 31597, 31607, 31617, 31628, 31639, 31646, 31654,
+	31663, 31674, 31684, 31695, 31705, 31716, 31724, 31733, 31742,
+	31752, 31759, 31768, 31777, 31787, 31797, 31807, 31815, 31825,
+	31836, 31847, 31858, 31869, 31878, 31888, 31894, 31902, 31909,
+	31918, 31928, 31938, 31945, 31954, 31962, 31971, 31980, 31991,
+	31999, 32009, 32018, 32027, 32037, 32048, 32058, 32069, 32079,
+	32089, 32100, 32111, 32118, 32128, 32136, 32146, 32157, 32168,
+	32175, 32183, 32193, 32202, 32212, 32222, 32231, 32241, 32251,
+	32259, 32269, 32279, 32288, 32296, 32307, 32316, 32323, 32331,
+	32339, 32349, 32359, 32370, 32378, 32387, 32396, 32406, 32416,
+	32426, 32436, 32446, 32456, 32467, 32477, 32485, 32495, 32505,
+	32515, 32524, 32535, 32544, 32551, 32560, 32569, 32580, 32591,
+	32602, 32611, 32621, 32631, 32642, 32653, 32662, 32672, 32682,
+	32693, 32704, 32715, 32724, 32735, 32745, 32755, 32764, 32775,
+	32785, 32791, 32798, 32807, 32818, 32828, 32839, 32848, 32858,
+	32865, 32873, 32883, 32892, 32898, 32906, 32915, 32924, 32935,
+	32945, 32952, 32961, 32972, 32982, 32994, 33005, 33013, 33022,
+	33027, 33034, 33040, 33048, 33057, 33066, 33072, 33081, 33090,
+	33100, 33108, 33118, 33126, 33137, 33147, 33157, 33166, 33177,
+	33187, 33198, 33209, 33220, 33230, 33241, 33247, 33256, 33263,
+	33272, 33282, 33292, 33300, 33309, 33319, 33328, 33338, 33348,
+	33358, 33369, 33380, 33388, 33398, 33408, 33418, 33426, 33437,
+	33446, 33453, 33461, 33470, 33480, 33490, 33501, 33509, 33518,
+	33528, 33539, 33549, 33558, 33568, 33578, 33588, 33599, 33608,
+	33616, 33626, 33635, 33645, 33654, 33664, 33673, 33680, 33689,
+	33698, 33709, 33720, 33730, 33739, 33750, 33760, 33771, 33782,
+	33791, 33801, 33811, 33822, 33833, 33843, 33852, 33863, 33873,
+	33883, 33892, 33903, 33913, 33919, 33927, 33936, 33947, 33958,
+	33969, 33978, 33989, 33997, 34005, 34015, 34024, 34031, 34039,
+	34049, 34058, 34068, 34078, 34086, 34095, 34106, 34116, 34128,
+	34139, 34147, 34157, 34163, 34170, 34177, 34185, 34194, 34203,
+	34210, 34220, 34229, 34239, 34248, 34258, 34267, 34278, 34287,
+	34296, 34306, 34317, 34327, 34339, 34350, 34361, 34371, 34383,
+	34390, 34399, 34407, 34416, 34426, 34436, 34445, 34455, 34465,
+	34474, 34484, 34494, 34504, 34515, 34525, 34533, 34543, 34553,
+	34563, 34572, 34583, 34592, 34600, 34609, 34618, 34629, 34640,
+	34651, 34660, 34670, 34680, 34691, 34701, 34711, 34721, 34731,
+	34742, 34753, 34763, 34771, 34781, 34791, 34801, 34810, 34821,
+	34830, 34838, 34848, 34857, 34868, 34879, 34890, 34899, 34910,
+	34920, 34931, 34941, 34950, 34960, 34970, 34981, 34993, 35004,
+	35013, 35024, 35034, 35044, 35052, 35063, 35072, 35078, 35085,
+	35094, 35104, 35114, 35125, 35133, 35142, 35151, 35160, 35171,
+	35181, 35189, 35198, 35208, 35218, 35229, 35239, 35248, 35258,
+	35269, 35278, 35290, 35300, 35308, 35317, 35322, 35329, 35335,
+	35342, 35351, 35360, 35368, 35378, 35388, 35398, 35408, 35419,
+	35428, 35439, 35449, 35459, 35469, 35481, 35491, 35501, 35512,
+	35523, 35532, 35542, 35550, 35560, 35569, 35579, 35589, 35600,
+	35609, 35619, 35629, 35638, 35648, 35658, 35668, 35679, 35690,
+	35699, 35710, 35720, 35729, 35737, 35748, 35757, 35764, 35772,
+	35781, 35791, 35801, 35812, 35820, 35829, 35839, 35850, 35860,
+	35869, 35879, 35889, 35900, 35912, 35923, 35932, 35943, 35953,
+	35963, 35972, 35983, 35993, 36001, 36010, 36020, 36031, 36042,
+	36053, 36062, 36072, 36083, 36094, 36105, 36115, 36125, 36135,
+	36146, 36158, 36169, 36179, 36190, 36200, 36211, 36220, 36231,
+	36241, 36248, 36256, 36266, 36277, 36288, 36299, 36308, 36318,
+	36326, 36334, 36343, 36352, 36358, 36366, 36375, 36384, 36394,
+	36404, 36411, 36420, 36431, 36441, 36452, 36463, 36472, 36482,
+	36486, 36491, 36496, 36502, 36509, 36516, 36524, 36534, 36543,
+	36553, 36561, 36571, 36580, 36591, 36601, 36611, 36620, 36631,
+	36642, 36654, 36665, 36676, 36686, 36697, 36703, 36712, 36719,
+	36728, 36738, 36748, 36754, 36762, 36771, 36780, 36786, 36794,
+	36803, 36812, 36822, 36832, 36839, 36848, 36859, 36869, 36880,
+	36891, 36900, 36910, 36914, 36922, 36928, 36936, 36945, 36954,
+	36961, 36969, 36979, 36988, 36995, 37003, 37013, 37022, 37031,
+	37040, 37048, 37057, 37068, 37078, 37089, 37100, 37109, 37119,
+	37124, 37132, 37139, 37146, 37155, 37164, 37174, 37183, 37194,
+	37204, 37212, 37221, 37232, 37242, 37252, 37262, 37271, 37281,
+	37293, 37303, 37315, 37326, 37335, 37345, 37353, 37362, 37371,
+	37379, 37389, 37399, 37409, 37419, 37430, 37441, 37449, 37459,
+	37470, 37481, 37493, 37504, 37513, 37524, 37536, 37547, 37559,
+	37571, 37581, 37592, 37599, 37607, 37615, 37624, 37634, 37644,
+	37647, 37652, 37657, 37663, 37670, 37677, 37681, 37687, 37693,
+	37699, 37706, 37713, 37720, 37728, 37735, 37742, 37750, 37758,
+	37767, 37776, 37785, 37794, 37803, 37812, 37817, 37825, 37832,
+	37840, 37848, 37858, 37865, 37874, 37882, 37890, 37899, 37909,
+	37918, 37928, 37937, 37946, 37956, 37966, 37972, 37982, 37990,
+	38000, 38011, 38022, 38028, 38037, 38045, 38054, 38063, 38073,
+	38081, 38091, 38099, 38107, 38117, 38127, 38136, 38146, 38155,
+	38164, 38174, 38184, 38191, 38201, 38210, 38219, 38230, 38241,
+	38250, 38261, 38271, 38281, 38291, 38302, 38311, 38322, 38331,
+	38340, 38351, 38362, 38372, 38382, 38392, 38402, 38411, 38421,
+	38430, 38441, 38451, 38461, 38471, 38482, 38491, 38502, 38512,
+	38523, 38532, 38543, 38553, 38565, 38576, 38587, 38597, 38609,
+	38620, 38631, 38642, 38653, 38663, 38674, 38682, 38691, 38700,
+	38710, 38721, 38732, 38736, 38744, 38751, 38759, 38769, 38779,
+	38784, 38793, 38801, 38808, 38818, 38828, 38836, 38845, 38854,
+	38862, 38872, 38882, 38891, 38902, 38912, 38923, 38934, 38945,
+	38949, 38956, 38964, 38973, 38980, 38989, 38997, 39007, 39016,
+	39025, 39033, 39043, 39053, 39063, 39073, 39083, 39092, 39102,
+	39107, 39116, 39123, 39132, 39142, 39153, 39160, 39169, 39178,
+	39188, 39196, 39205, 39214, 39224, 39232, 39239, 39248, 39258,
+	39268, 39279, 39289, 39299, 39308, 39319, 39325, 39334, 39342,
+	39350, 39360, 39371, 39381, 39391, 39402, 39412, 39421, 39431,
+	39441, 39452, 39462, 39471, 39481, 39492, 39503, 39512, 39523,
+	39533, 39541, 39550, 39558, 39568, 39577, 39586, 39595, 39605,
+	39613, 39623, 39634, 39645, 39653, 39663, 39673, 39684, 39696,
+	39707, 39716, 39727, 39739, 39749, 39761, 39772, 39781, 39791,
+	39798, 39806, 39814, 39823, 39833, 39843, 39846, 39854, 39861,
+	39869, 39879, 39889, 39894, 39903, 39911, 39918, 39928, 39938,
+	39946, 39955, 39964, 39972, 39982, 39992, 40000, 40010, 40019,
+	40030, 40041, 40052, 40057, 40065, 40074, 40084, 40091, 40101,
+	40110, 40120, 40130, 40140, 40148, 40158, 40169, 40179, 40190,
+	40201, 40210, 40220, 40226, 40235, 40242, 40252, 40262, 40272,
+	40280, 40289, 40299, 40309, 40317, 40326, 40335, 40345, 40352,
+	40358, 40368, 40377, 40387, 40398, 40408, 40417, 40426, 40437,
+	40444, 40453, 40462, 40470, 40480, 40490, 40500, 40510, 40521,
+	40531, 40540, 40550, 40560, 40571, 40581, 40590, 40601, 40611,
+	40621, 40630, 40641, 40652, 40660, 40670, 40678, 40688, 40698,
+	40707, 40717, 40728, 40737, 40747, 40758, 40769, 40778, 40788,
+	40799, 40810, 40821, 40831, 40841, 40852, 40864, 40875, 40887,
+	40898, 40908, 40919, 40926, 40934, 40943, 40952, 40962, 40972,
+	40976, 40984, 40991, 41000, 41010, 41020, 41026, 41035, 41043,
+	41049, 41059, 41069, 41077, 41087, 41097, 41105, 41115, 41125,
+	41134, 41144, 41154, 41165, 41176, 41187, 41195, 41205, 41215,
+	41225, 41233, 41243, 41253, 41263, 41272, 41280, 41289, 41299,
+	41310, 41321, 41332, 41342, 41351, 41362, 41369, 41378, 41386,
+	41395, 41405, 41415, 41424, 41434, 41445, 41455, 41464, 41473,
+	41483, 41493, 41501, 41508, 41518, 41528, 41539, 41550, 41561,
+	41571, 41580, 41591, 41599, 41608, 41617, 41626, 41636, 41646,
+	41656, 41667, 41677, 41686, 41696, 41706, 41717, 41728, 41739,
+	41749, 41759, 41770, 41779, 41787, 41797, 41806, 41813, 41821,
+	41829, 41839, 41848, 41858, 41866, 41875, 41885, 41896, 41908,
+	41919, 41929, 41940, 41951, 41962, 41974, 41985, 41995, 42007,
+	42018, 42027, 42039, 42049, 42057, 42066, 42073, 42082, 42090,
+	42099, 42109, 42120, 42127, 42135, 42143, 42151, 42161, 42171,
+	42179, 42188, 42197, 42204, 42214, 42224, 42233, 42243, 42253,
+	42262, 42271, 42280, 42289, 42300, 42310, 42321, 42331, 42342,
+	42351, 42361, 42372, 42382, 42392, 42402, 42412, 42423, 42434,
+	42444, 42454, 42465, 42475, 42484, 42496, 42506, 42514, 42523,
+	42531, 42541, 42551, 42561, 42570, 42580, 42590, 42601, 42612,
+	42622, 42632, 42642, 42653, 42664, 42675, 42685, 42695, 42706,
+	42717, 42727, 42739, 42750, 42759, 42769, 42778, 42788, 42798,
+	42808, 42818, 42829, 42839, 42850, 42861, 42871, 42881, 42892,
+	42903, 42914, 42926, 42937, 42948, 42959, 42969, 42978, 42989,
+	42999, 43007, 43016, 43025, 43036, 43046, 43057, 43066, 43076,
+	43085, 43094, 43105, 43115, 43122, 43131, 43141, 43151, 43163,
+	43174, 43182, 43192, 43204, 43215, 43227, 43239, 43249, 43260,
+	43266, 43274, 43281, 43290, 43300, 43310, 43316, 43324, 43331,
+	43339, 43348, 43358, 43365, 43374, 43382, 43390, 43400, 43410,
+	43419, 43429, 43438, 43447, 43457, 43467, 43474, 43484, 43492,
+	43502, 43513, 43524, 43531, 43540, 43550, 43560, 43567, 43576,
+	43586, 43596, 43607, 43617, 43625, 43635, 43646, 43657, 43669,
+	43681, 43691, 43702, 43707, 43716, 43723, 43732, 43742, 43752,
+	43760, 43769, 43780, 43790, 43798, 43807, 43818, 43828, 43838,
+	43847, 43856, 43866, 43878, 43889, 43901, 43912, 43922, 43933,
+	43939, 43948, 43956, 43964, 43974, 43984, 43995, 44005, 44017,
+	44028, 44037, 44047, 44058, 44069, 44080, 44090, 44100, 44111,
+	44123, 44133, 44146, 44157, 44166, 44176, 44185, 44195, 44205,
+	44214, 44224, 44235, 44245, 44255, 44267, 44278, 44286, 44296,
+	44307, 44318, 44330, 44342, 44351, 44362, 44374, 44385, 44398,
+	44410, 44420, 44431, 44438, 44447, 44455, 44465, 44476, 44487,
+	44491, 44497, 44503, 44510, 44518, 44526, 44531, 44538, 44545,
+	44552, 44560, 44568, 44576, 44585, 44593, 44601, 44610, 44619,
+	44628, 44638, 44648, 44658, 44668, 44678, 44680, 44686, 44692,
+	44699, 44707, 44715, 44720, 44727, 44734, 44740, 44748, 44756,
+	44764, 44773, 44781, 44789, 44798, 44807, 44815, 44825, 44835,
+	44845, 44855, 44865, 44868, 44875, 44882, 44890, 44899, 44908,
+	44914, 44922, 44929, 44934, 44942, 44950, 44958, 44967, 44975,
+	44983, 44992, 45001, 45010, 45020, 45030, 45040, 45050, 45060,
+	45066, 45075, 45083, 45090, 45100, 45110, 45117, 45126, 45134,
+	45140, 45149, 45158, 45167, 45176, 45185, 45194, 45202, 45210,
+	45220, 45230, 45240, 45250, 45260, 45270, 45279, 45289, 45299,
+	45308, 45317, 45328, 45337, 45347, 45357, 45366, 45376, 45386,
+	45396, 45406, 45416, 45426, 45435, 45444, 45452, 45462, 45471,
+	45482, 45493, 45504, 45510, 45519, 45528, 45538, 45549, 45560,
+	45567, 45577, 45587, 45596, 45607, 45618, 45628, 45639, 45650,
+	45660, 45671, 45683, 45692, 45703, 45713, 45725, 45737, 45749,
+	45750, 45756, 45763, 45771, 45780, 45789, 45795, 45803, 45811,
+	45818, 45827, 45836, 45845, 45855, 45864, 45873, 45882, 45892,
+	45899, 45910, 45919, 45929, 45939, 45950, 45954, 45962, 45970,
+	45979, 45989, 45999, 46006, 46015, 46022, 46026, 46035, 46044,
+	46053, 46063, 46072, 46081, 46089, 46099, 46107, 46118, 46128,
+	46137, 46147, 46158, 46165, 46175, 46184, 46192, 46203, 46214,
+	46222, 46232, 46241, 46248, 46258, 46268, 46278, 46287, 46297,
+	46307, 46314, 46322, 46331, 46342, 46352, 46363, 46372, 46382,
+	46390, 46400, 46410, 46420, 46428, 46438, 46448, 46459, 46470,
+	46480, 46489, 46500, 46511, 46521, 46532, 46543, 46551, 46560,
+	46567, 46576, 46584, 46594, 46605, 46616, 46621, 46630, 46639,
+	46648, 46658, 46669, 46676, 46686, 46696, 46704, 46715, 46726,
+	46736, 46747, 46758, 46768, 46778, 46789, 46797, 46807, 46816,
+	46827, 46838, 46850, 46852, 46859, 46867, 46876, 46885, 46895,
+	46901, 46910, 46919, 46927, 46937, 46947, 46956, 46966, 46976,
+	46985, 46994, 47004, 47012, 47023, 47032, 47042, 47052, 47063,
+	47068, 47077, 47085, 47095, 47105, 47116, 47124, 47133, 47139,
+	47142, 47151, 47159, 47168, 47178, 47187, 47196, 47204, 47214,
+	47223, 47234, 47245, 47255, 47265, 47276, 47283, 47293, 47302,
+	47311, 47322, 47333, 47342, 47352, 47361, 47368, 47378, 47388,
+	47398, 47407, 47417, 47427, 47433, 47440, 47449, 47460, 47471,
+	47482, 47492, 47503, 47512, 47522, 47532, 47542, 47551, 47561,
+	47571, 47582, 47593, 47603, 47612, 47623, 47634, 47645, 47656,
+	47667, 47675, 47685, 47693, 47702, 47711, 47721, 47732, 47743,
+	47749, 47758, 47767, 47777, 47788, 47799, 47807, 47818, 47828,
+	47835, 47846, 47857, 47867, 47879, 47890, 47900, 47910, 47921,
+	47930, 47940, 47950, 47961, 47972, 47984, 47989, 47998, 48006,
+	48016, 48026, 48037, 48044, 48054, 48062, 48068, 48078, 48088,
+	48097, 48108, 48119, 48128, 48137, 48148, 48157, 48168, 48178,
+	48188, 48198, 48210, 48216, 48226, 48234, 48245, 48256, 48267,
+	48275, 48285, 48292, 48297, 48307, 48317, 48326, 48337, 48347,
+	48356, 48365, 48376, 48386, 48397, 48408, 48419, 48429, 48441,
+	48449, 48459, 48469, 48478, 48489, 48499, 48508, 48518, 48528,
+	48536, 48547, 48558, 48567, 48575, 48584, 48593, 48598, 48604,
+	48613, 48623, 48633, 48644, 48652, 48661, 48670, 48681, 48692,
+	48702, 48712, 48723, 48733, 48744, 48755, 48765, 48775, 48787,
+	48798, 48807, 48818, 48828, 48836, 48845, 48852, 48861, 48869,
+	48878, 48888, 48898, 48906, 48915, 48925, 48935, 48946, 48957,
+	48966, 48976, 48986, 48995, 49006, 49017, 49027, 49037, 49048,
+	49059, 49068, 49078, 49087, 49098, 49108, 49119, 49129, 49140,
+	49148, 49157, 49166, 49175, 49186, 49197, 49206, 49216, 49226,
+	49234, 49245, 49256, 49266, 49275, 49286, 49296, 49304, 49313,
+	49322, 49333, 49344, 49356, 49365, 49375, 49383, 49393, 49402,
+	49412, 49423, 49434, 49443, 49453, 49463, 49471, 49482, 49493,
+	49503, 49513, 49524, 49534, 49541, 49550, 49560, 49572, 49584,
+	49596, 49606, 49617, 49626, 49636, 49646, 49656, 49667, 49678,
+	49688, 49698, 49709, 49718, 49729, 49740, 49750, 49759, 49769,
+	49779, 49785, 49792, 49802, 49813, 49824, 49836, 49845, 49855,
+	49864, 49873, 49883, 49893, 49900, 49909, 49919, 49929, 49940,
+	49951, 49959, 49969, 49980, 49991, 50003, 50014, 50023, 50033,
+	50039, 50046, 50053, 50061, 50070, 50079, 50087, 50097, 50106,
+	50116, 50125, 50136, 50145, 50156, 50166, 50176, 50186, 50198,
+	50209, 50221, 50232, 50243, 50253, 50264, 50271, 50281, 50289,
+	50299, 50310, 50321, 50327, 50336, 50344, 50353, 50361, 50371,
+	50379, 50389, 50398, 50407, 50416, 50427, 50437, 50448, 50458,
+	50468, 50477, 50487, 50493, 50503, 50511, 50521, 50532, 50543,
+	50550, 50560, 50569, 50579, 50588, 50598, 50607, 50618, 50627,
+	50636, 50646, 50657, 50667, 50678, 50688, 50698, 50707, 50718,
+	50725, 50735, 50744, 50753, 50764, 50775, 50785, 50796, 50807,
+	50818, 50828, 50839, 50849, 50860, 50870, 50880, 50891, 50903,
+	50914, 50924, 50935, 50946, 50955, 50965, 50973, 50983, 50992,
+	51002, 51012, 51023, 51033, 51043, 51054, 51065, 51073, 51083,
+	51094, 51105, 51117, 51128, 51137, 51148, 51160, 51171, 51183,
+	51195, 51205, 51216, 51223, 51231, 51239, 51248, 51258, 51268,
+	51273, 51281, 51289, 51298, 51308, 51318, 51324, 51333, 51342,
+	51350, 51360, 51370, 51379, 51389, 51399, 51408, 51419, 51430,
+	51439, 51450, 51460, 51472, 51484, 51496, 51499, 51506, 51513,
+	51521, 51530, 51539, 51545, 51553, 51561, 51568, 51577, 51586,
+	51595, 51605, 51614, 51623, 51633, 51643, 51651, 51662, 51672,
+	51683, 51694, 51705, 51709, 51717, 51725, 51734, 51744, 51754,
+	51761, 51770, 51778, 51784, 51793, 51802, 51811, 51821, 51830,
+	51839, 51848, 51858, 51867, 51878, 51889, 51899, 51910, 51921,
+	51928, 51938, 51947, 51955, 51966, 51977, 51985, 51995, 52004,
+	52011, 52021, 52031, 52041, 52051, 52061, 52071, 52079, 52088,
+	52098, 52109, 52120, 52131, 52141, 52152, 52161, 52172, 52182,
+	52192, 52201, 52212, 52222, 52233, 52244, 52254, 52264, 52275,
+	52286, 52297, 52308, 52319, 52328, 52338, 52346, 52356, 52365,
+	52376, 52388, 52400, 52406, 52415, 52424, 52434, 52445, 52456,
+	52463, 52473, 52483, 52492, 52503, 52514, 52524, 52535, 52546,
+	52556, 52567, 52579, 52588, 52599, 52609, 52621, 52633, 52646,
+};
+
+static const int	g_base[] = {0, 0, 0, 2, 8, 32, 152, 872};
+
+/**
+ * @brief Returns the minimal sequence sorting a permutation.
+ *
+ * @param size Number of values, 2 to PS_TABLE_MAX.
+ * @param rank Lehmer rank of the permutation.
+ * @param len Receives the number of operations.
+ * @return Operation codes, one byte each.
+ *
+ * @ingroup optimal
+ */
+const unsigned char	*optimal_table(int size, int rank, int *len)
+{
+	int	index;
+
+	index = g_base[size] + rank;
+	*len = g_offsets[index + 1] - g_offsets[index];
+	return (g_ops + g_offsets[index]);
+}
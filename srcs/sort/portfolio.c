@@ -0,0 +1,201 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   portfolio.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:23:34 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 03:21:43 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file portfolio.c
+ * @brief Races several sorting engines and keeps the shortest result.
+ *
+ * No engine wins on every input shape, so `--engine portfolio` runs each
+ * of them on its own thread, over a private copy of the normalized
+ * stacks. The length of the best optimized log found so far is shared
+ * through an atomic bound: an engine whose log reaches it can no longer
+ * win and stops (see sort_aborted), so the run takes about as long as
+ * the engine that wins. The bound is compared with logs that are not
+ * optimized yet, so a slower engine is dropped a little before its log
+ * could have been shortened.
+ *
+ * The turk and lis engines are left out above PS_TURK_MAX values, where
+ * their insertions cost more time than the race can hide.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup sorting
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Gives a worker its own copy of the stacks and of the targets.
+ *
+ * @param worker Worker to set up.
+ * @param array Normalized input, left untouched.
+ * @param engine Engine the worker runs.
+ * @param best Bound shared by every worker.
+ * @return false if the copy could not be allocated.
+ *
+ * @ingroup sorting
+ * @see init_array
+ */
+static bool	init_worker(t_worker *worker, const t_array *array,
+		t_engine engine, atomic_size_t *best)
+{
+	ft_memset(worker, 0, sizeof(t_worker));
+	worker->array.a = array->a;
+	worker->array.b = array->b;
+	if (!init_array(&worker->array, array->a.capacity))
+		return (false);
+	ft_memcpy(worker->array.arena, array->arena,
+		3 * (size_t)array->a.capacity * sizeof(int));
+	worker->array.engine = engine;
+	worker->array.bound = best;
+	return (true);
+}
+
+/**
+ * @brief Thread body: sorts the copy, then offers its length as bound.
+ *
+ * The bound only ever decreases, so a finished engine publishes its
+ * length unless a rival already did at least as well.
+ *
+ * @param arg The `t_worker` to run.
+ * @return Always NULL.
+ *
+ * @ingroup sorting
+ * @see sort_array
+ * @see oplog_optimize
+ */
+static void	*run_worker(void *arg)
+{
+	t_array	*array;
+	size_t	best;
+
+	array = &((t_worker *)arg)->array;
+	sort_array(array);
+	if (array->aborted)
+		return (NULL);
+	oplog_optimize(&array->log, array->a.size);
+	best = atomic_load(array->bound);
+	while (!array->log.failed && array->log.size < best)
+	{
+		if (atomic_compare_exchange_weak(array->bound, &best,
+				array->log.size))
+			return (NULL);
+	}
+	array->aborted = true;
+	return (NULL);
+}
+
+/**
+ * @brief Starts one worker per engine of the portfolio.
+ *
+ * A worker whose thread cannot be created runs on the calling thread,
+ * and one whose copy cannot be allocated is skipped.
+ *
+ * @param workers Room for PS_PORTFOLIO_SIZE workers.
+ * @param array Normalized input.
+ * @param best Bound shared by every worker.
+ * @return Number of workers set up, to be finished by `finish_workers`.
+ *
+ * @ingroup sorting
+ * @see init_worker
+ * @see run_worker
+ */
+static int	start_workers(t_worker *workers, const t_array *array,
+		atomic_size_t *best)
+{
+	static const t_engine	engines[PS_PORTFOLIO_SIZE] = {
+		ENGINE_RADIX, ENGINE_TURK, ENGINE_LIS};
+	int						count;
+	int						i;
+
+	count = 0;
+	i = 0;
+	while (i < PS_PORTFOLIO_SIZE)
+	{
+		if (((engines[i] != ENGINE_TURK && engines[i] != ENGINE_LIS)
+				|| array->a.size <= PS_TURK_MAX)
+			&& init_worker(&workers[count], array, engines[i], best))
+		{
+			workers[count].running = pthread_create(&workers[count].thread,
+					NULL, run_worker, &workers[count]) == 0;
+			if (!workers[count].running)
+				run_worker(&workers[count]);
+			count++;
+		}
+		i++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Waits for every worker and hands the shortest log to `array`.
+ *
+ * Every worker that did not give up holds a complete sequence. When
+ * none is left, an allocation failed and `array->log` is marked so.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param workers Workers set up by `start_workers`.
+ * @param count Number of workers.
+ *
+ * @ingroup sorting
+ * @see free_array
+ */
+static void	finish_workers(t_array *array, t_worker *workers, int count)
+{
+	t_oplog	*best;
+	int		i;
+
+	best = NULL;
+	i = 0;
+	while (i < count)
+	{
+		if (workers[i].running)
+			pthread_join(workers[i].thread, NULL);
+		if (!workers[i].array.aborted
+			&& (!best || workers[i].array.log.size < best->size))
+			best = &workers[i].array.log;
+		i++;
+	}
+	oplog_free(&array->log);
+	if (best)
+	{
+		array->log = *best;
+		ft_memset(best, 0, sizeof(t_oplog));
+	}
+	else
+		array->log.failed = true;
+	while (count > 0)
+		free_array(&workers[--count].array);
+}
+
+/**
+ * @brief Sorts stack A with every engine of the portfolio at once.
+ *
+ * Stack A itself is left as it was: only the winning log is kept, and
+ * replaying it sorts A.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup sorting
+ * @see start_workers
+ * @see finish_workers
+ */
+void	portfolio_sort(t_array *array)
+{
+	t_worker		workers[PS_PORTFOLIO_SIZE];
+	atomic_size_t	best;
+
+	atomic_init(&best, SIZE_MAX);
+	finish_workers(array, workers, start_workers(workers, array, &best));
+}
@@ -0,0 +1,230 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:43:22 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 12:22:58 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file profile.c
+ * @brief Measures how presorted stack A is, and predicts the best engine.
+ *
+ * Run on the normalized stack before an automatic dispatch, in O(n) for
+ * the offset and the swaps, and constant time for the rest:
+ * - runs: ascending runs of A from top to bottom, from the break count
+ * - offset: position of the smallest value, how far A is rotated
+ * - inversions: pairs out of order among PS_PROFILE_SAMPLE pseudo-random
+ *   pairs of positions around the ring, in per mille
+ * - lis: longest increasing subsequence of PS_PROFILE_SAMPLE values taken
+ *   at regular steps around the ring, scaled up to the whole stack and
+ *   capped by the inversions
+ * - swaps: swapped neighbours left once A is rotated, -1 if rotating and
+ *   swapping neighbours cannot sort A (see count_rotated_swaps), in O(n)
+ *
+ * Each engine's operation count is then predicted from formulas fitted on
+ * measured runs, and the cheapest engine is picked. Only the lis engine
+ * depends on the order of the input: the values outside the subsequence
+ * each cost about two thirds of the square root of n to reinsert.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup sorting
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Finds the subsequence a sampled value extends.
+ *
+ * @param tails Smallest value ending a subsequence of each length.
+ * @param len Longest length found so far.
+ * @param value Sampled value.
+ * @return Index in `tails` where `value` goes.
+ *
+ * @ingroup sorting
+ */
+static int	search_tails(const int *tails, int len, int value)
+{
+	int	low;
+	int	high;
+
+	low = 0;
+	high = len;
+	while (low < high)
+	{
+		if (tails[low + (high - low) / 2] < value)
+			low += (high - low) / 2 + 1;
+		else
+			high = low + (high - low) / 2;
+	}
+	return (low);
+}
+
+/**
+ * @brief Estimates the longest increasing subsequence around the ring.
+ *
+ * Samples `count` values at regular steps from `offset`, and runs a
+ * patience sort over them. A regular stride can land on increasing values
+ * of an unsorted stack, so the length is capped by the inversions: every
+ * pair inside the subsequence is in order, so a subsequence of l values
+ * out of n leaves at most 1 - (l / n)^2 of the pairs inverted.
+ *
+ * @param a Stack A, normalized.
+ * @param offset Position of the smallest value.
+ * @param count Number of values sampled, at most PS_PROFILE_SAMPLE.
+ * @param inversions Sampled pairs out of order, in per mille.
+ * @return Length of the subsequence among the sampled values.
+ *
+ * @ingroup sorting
+ * @see search_tails
+ */
+static int	sample_lis(const t_stack *a, int offset, int count, int inversions)
+{
+	int	tails[PS_PROFILE_SAMPLE];
+	int	value;
+	int	slot;
+	int	len;
+	int	i;
+
+	len = 0;
+	i = 0;
+	while (i < count)
+	{
+		value = stack_get(a, (offset + (long)i * a->size / count) % a->size);
+		slot = search_tails(tails, len, value);
+		tails[slot] = value;
+		len += (slot == len);
+		i++;
+	}
+	while ((long)len * len * 1000 > (long)count * count * (1000 - inversions))
+		len--;
+	return (len);
+}
+
+/**
+ * @brief Counts the inversions among pseudo-random pairs of positions.
+ *
+ * The pairs come from a fixed xorshift sequence, so a given input is
+ * always profiled, and dispatched, the same way. Positions are counted
+ * around the ring from `offset`, the way `sample_lis` reads A, so that a
+ * rotation alone leaves no inversion.
+ *
+ * @param a Stack A, normalized, with at least two values.
+ * @param offset Position of the smallest value.
+ * @return Pairs out of order, in per mille of PS_PROFILE_SAMPLE pairs.
+ *
+ * @ingroup sorting
+ */
+static int	sample_inversions(const t_stack *a, int offset)
+{
+	unsigned int	state;
+	int				first;
+	int				second;
+	int				count;
+	int				i;
+
+	state = 2463534242u;
+	count = 0;
+	i = 0;
+	while (i++ < PS_PROFILE_SAMPLE)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		first = state % a->size;
+		second = (first + 1 + (state >> 16) % (a->size - 1)) % a->size;
+		if ((first < second) == (stack_get(a, (offset + first) % a->size)
+			> stack_get(a, (offset + second) % a->size)))
+			count++;
+	}
+	return (count * 1000 / PS_PROFILE_SAMPLE);
+}
+
+/**
+ * @brief Predicts the operation count of each engine.
+ *
+ * Radix costs about 5/4 n per bit of n - 1, and turk about 9/10 n per
+ * bit on random inputs; turk is only predicted up to PS_TURK_MAX values,
+ * like the automatic dispatch. A rotation alone costs min(offset,
+ * n - offset); with swapped pairs, one sweep of the ring to reach them
+ * is added. The reference radix engine emits what radix does, and loses
+ * ties to it.
+ *
+ * @param profile Profile with its features measured.
+ *
+ * @ingroup sorting
+ */
+static void	predict_costs(t_profile *profile)
+{
+	size_t	n;
+	size_t	bits;
+	size_t	root;
+
+	n = profile->size;
+	bits = 0;
+	while (((n - 1) >> bits) > 0)
+		bits++;
+	root = 0;
+	while ((root + 1) * (root + 1) <= n)
+		root++;
+	profile->cost[ENGINE_RADIX] = bits * n * 5 / 4;
+	profile->cost[ENGINE_RADIX_SIM] = profile->cost[ENGINE_RADIX];
+	profile->cost[ENGINE_TURK] = SIZE_MAX;
+	if (n <= PS_TURK_MAX)
+		profile->cost[ENGINE_TURK] = bits * n * 9 / 10;
+	profile->cost[ENGINE_LIS] = n + (n - profile->lis) * root * 2 / 3;
+	profile->cost[ENGINE_ROTATION] = SIZE_MAX;
+	if (profile->swaps >= 0)
+		profile->cost[ENGINE_ROTATION] = (n - labs((long)n - 2L
+					* profile->offset)) / 2 + (profile->swaps > 0) * n
+			+ profile->swaps;
+}
+
+/**
+ * @brief Profiles stack A and picks the engine predicted to be cheapest.
+ *
+ * A stack the rotation engine can sort goes to it whatever the other
+ * predictions: it never pushes a value to B, so no other engine comes
+ * close, and the lis prediction is too optimistic on such inputs.
+ *
+ * @param a Stack A, normalized, not empty.
+ * @param profile Receives the features, the predictions and the choice.
+ *
+ * @ingroup sorting
+ * @see sample_lis
+ * @see sample_inversions
+ * @see count_rotated_swaps
+ * @see predict_costs
+ */
+void	profile_stack(const t_stack *a, t_profile *profile)
+{
+	t_engine	engine;
+	int			count;
+
+	ft_memset(profile, 0, sizeof(t_profile));
+	profile->size = a->size;
+	profile->runs = a->breaks + 1;
+	while (stack_get(a, profile->offset) != 0)
+		profile->offset++;
+	count = a->size;
+	if (count > PS_PROFILE_SAMPLE)
+		count = PS_PROFILE_SAMPLE;
+	if (a->size > 1)
+		profile->inversions = sample_inversions(a, profile->offset);
+	profile->lis = (long)sample_lis(a, profile->offset, count,
+			profile->inversions) * a->size / count;
+	profile->swaps = count_rotated_swaps(a);
+	predict_costs(profile);
+	profile->engine = ENGINE_ROTATION;
+	engine = ENGINE_AUTO;
+	while (profile->swaps < 0 && ++engine < ENGINE_PORTFOLIO)
+		if (profile->cost[engine] < profile->cost[profile->engine])
+			profile->engine = engine;
+}
@@ -0,0 +1,204 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix_flat.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:29:21 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 09:29:46 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file radix_flat.c
+ * @brief Radix sort that computes its operations without running them.
+ *
+ * Which operation radix sort takes next only depends on the order of the
+ * values, so its passes are replayed on flat arrays instead of the ring
+ * buffers: A top first, B bottom first. Each pass becomes a stable
+ * partition, one sequential sweep, and its operations are appended to the
+ * log as they are found. The stacks are written once, at the end.
+ *
+ * The decisions of a pass are read first, into a bit mask, by the same
+ * vector scans as the simulated engine (see `flat_mask`); the sweeps
+ * then only read the mask.
+ *
+ * The output is the one of the simulated engine, `radix_sort_sim`, kept
+ * as a reference (`--engine radix-sim`).
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup radix
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Tells whether a value of the current split has a 1.
+ *
+ * @param flat Flat stacks, with the mask of the split read.
+ * @param i Index of the value, in storage order.
+ * @return 1 if the value has a 1 at the tested bit, 0 otherwise.
+ *
+ * @ingroup radix
+ */
+static int	flat_bit(const t_flat *flat, int i)
+{
+	return ((flat->mask[i >> 3] >> (i & 7)) & 1);
+}
+
+/**
+ * @brief Finds how far the pass over A runs, logging its operations.
+ *
+ * The simulated pass stops as soon as A is sorted. After `i` values, A
+ * holds the values from `i` on, then the values it kept, so it is sorted
+ * once the values from `i` on are ascending (`from`), the kept ones are
+ * ascending, and the last value is below the first kept one.
+ *
+ * @param flat Flat stacks.
+ * @param bit Bit tested by the pass.
+ * @return Number of values the pass takes from A.
+ *
+ * @ingroup radix
+ * @see flat_sorted_from
+ * @see flat_mask
+ */
+static int	scan_a(t_flat *flat, int bit)
+{
+	static const t_op	ops[2] = {OP_PB, OP_RA};
+	int					from;
+	int					first;
+	int					last;
+	int					i;
+
+	from = flat_sorted_from(flat->a, flat->na);
+	flat_mask(flat, flat->a, flat->na, bit);
+	first = -1;
+	last = -1;
+	i = 0;
+	while (i < flat->na && (i < from
+			|| (first >= 0 && flat->a[flat->na - 1] > first)))
+	{
+		if (flat_bit(flat, i))
+		{
+			if (last > flat->a[i])
+				from = flat->na + 1;
+			if (first < 0)
+				first = flat->a[i];
+			last = flat->a[i];
+		}
+		oplog_append(&flat->array->log, ops[flat_bit(flat, i++)]);
+	}
+	return (i);
+}
+
+/**
+ * @brief Applies the pass over A to the flat stacks.
+ *
+ * The values with a 0 go on top of B, the others after the values left
+ * in A, both in the order they are taken.
+ *
+ * @param flat Flat stacks, with the mask read by `scan_a`.
+ * @param stop Number of values the pass takes, from `scan_a`.
+ *
+ * @ingroup radix
+ * @see flat_bit
+ */
+static void	split_a(t_flat *flat, int stop)
+{
+	int	kept;
+	int	i;
+
+	kept = 0;
+	i = 0;
+	while (i < stop)
+	{
+		flat->tmp[kept] = flat->a[i];
+		flat->b[flat->nb] = flat->a[i];
+		kept += flat_bit(flat, i);
+		flat->nb += !flat_bit(flat, i++);
+	}
+	ft_memmove(flat->a, flat->a + stop, (flat->na - stop) * sizeof(int));
+	ft_memcpy(flat->a + flat->na - stop, flat->tmp, kept * sizeof(int));
+	flat->na += kept - stop;
+}
+
+/**
+ * @brief Runs the pass over B on the flat stacks, logging its operations.
+ *
+ * B is taken from its top: values with a 1 are pushed to A, the others
+ * rotated, so they keep their order. The pushed values end up on A in
+ * the reverse of the order they were taken in, which is their order in
+ * the storage of B.
+ *
+ * @param flat Flat stacks.
+ * @param bit Bit tested by the pass.
+ *
+ * @ingroup radix
+ * @see flat_mask
+ */
+static void	split_b(t_flat *flat, int bit)
+{
+	static const t_op	ops[2] = {OP_RB, OP_PA};
+	int					pushed;
+	int					kept;
+	int					i;
+
+	flat_mask(flat, flat->b, flat->nb, bit);
+	i = flat->nb;
+	while (i-- > 0)
+		oplog_append(&flat->array->log, ops[flat_bit(flat, i)]);
+	pushed = 0;
+	kept = 0;
+	while (++i < flat->nb)
+	{
+		flat->tmp[pushed] = flat->b[i];
+		flat->b[kept] = flat->b[i];
+		pushed += flat_bit(flat, i);
+		kept += !flat_bit(flat, i);
+	}
+	ft_memmove(flat->a + pushed, flat->a, flat->na * sizeof(int));
+	ft_memcpy(flat->a, flat->tmp, pushed * sizeof(int));
+	flat->na += pushed;
+	flat->nb = kept;
+}
+
+/**
+ * @brief Sorts stack A with radix sort, without moving the stacks.
+ *
+ * Runs the same passes as `radix_sort_sim`, and stops between bits in
+ * the same way once a rival engine has done better.
+ *
+ * @param array Pointer to the main stack structure, B empty.
+ *
+ * @ingroup radix
+ * @see flat_init
+ * @see scan_a
+ * @see split_a
+ * @see split_b
+ * @see flat_finish
+ */
+void	radix_sort(t_array *array)
+{
+	t_flat	flat;
+	int		bit_count;
+	int		bit;
+
+	if (!flat_init(&flat, array))
+		return ;
+	bit_count = 0;
+	while ((array->a.size >> (bit_count + 1)) > 0)
+		bit_count++;
+	bit = 0;
+	while (bit <= bit_count && !sort_aborted(array))
+	{
+		split_a(&flat, scan_a(&flat, bit));
+		if (bit + 1 <= bit_count)
+			split_b(&flat, bit + 1);
+		bit++;
+	}
+	flat_finish(&flat);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix_flat_state.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:36:34 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 09:36:59 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file radix_flat_state.c
+ * @brief Setup and teardown of the flat stacks used by `radix_sort`.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup radix
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Finds where the ascending tail of an array starts.
+ *
+ * @param values Values.
+ * @param count Number of values.
+ * @return Smallest index from which the values are ascending.
+ *
+ * @ingroup radix
+ */
+int	flat_sorted_from(const int *values, int count)
+{
+	int	from;
+
+	from = count - 1;
+	while (from > 0 && values[from - 1] < values[from])
+		from--;
+	return (from);
+}
+
+/**
+ * @brief Lays stack A out flat in its own storage.
+ *
+ * The storage of A and B is used as is; only the scratch room of a
+ * partition, and the decision mask behind it, are allocated.
+ *
+ * @param flat Flat stacks to set up.
+ * @param array Pointer to the main stack structure, B empty.
+ * @return false if the allocation failed, recorded in the log.
+ *
+ * @ingroup radix
+ */
+bool	flat_init(t_flat *flat, t_array *array)
+{
+	int	i;
+
+	flat->array = array;
+	flat->tmp = malloc(array->a.size * sizeof(int) + array->a.size / 8 + 1);
+	if (!flat->tmp)
+	{
+		array->log.failed = true;
+		return (false);
+	}
+	i = -1;
+	while (++i < array->a.size)
+		flat->tmp[i] = stack_get(&array->a, i);
+	flat->mask = (unsigned char *)(flat->tmp + array->a.size);
+	flat->a = array->a.data;
+	flat->na = array->a.size;
+	ft_memcpy(flat->a, flat->tmp, flat->na * sizeof(int));
+	array->a.head = 0;
+	flat->b = array->b.data;
+	flat->nb = 0;
+	return (true);
+}
+
+/**
+ * @brief Reads the decisions of a split into `flat->mask`.
+ *
+ * A flat stack is a ring buffer whose head is at 0, so `radix_scan`
+ * reads it as is, PS_SCAN_CHUNK values at a time, with the vector scans
+ * where the processor has them.
+ *
+ * @param flat Flat stacks.
+ * @param values Flat stack the split runs over, in storage order.
+ * @param count Number of values.
+ * @param bit Bit tested by the split.
+ *
+ * @ingroup radix
+ * @see radix_scan
+ */
+void	flat_mask(t_flat *flat, int *values, int count, int bit)
+{
+	t_stack	view;
+	t_scan	scan;
+	int		done;
+
+	done = 0;
+	while (done < count)
+	{
+		view.data = values + done;
+		view.head = 0;
+		view.capacity = count - done;
+		radix_scan(&view, count - done, bit, &scan);
+		ft_memcpy(flat->mask + done / 8, scan.mask, (scan.count + 7) / 8);
+		done += scan.count;
+	}
+}
+
+/**
+ * @brief Pushes B back onto A, and writes the flat stacks back.
+ *
+ * B is pushed from its top, so A ends up with the storage of B, in
+ * order, above the values it holds.
+ *
+ * @param flat Flat stacks, released.
+ *
+ * @ingroup radix
+ * @see stack_count_breaks
+ */
+void	flat_finish(t_flat *flat)
+{
+	int	i;
+
+	i = flat->nb;
+	while (i-- > 0)
+		oplog_append(&flat->array->log, OP_PA);
+	ft_memmove(flat->a + flat->nb, flat->a, flat->na * sizeof(int));
+	ft_memcpy(flat->a, flat->b, flat->nb * sizeof(int));
+	flat->array->a.size = flat->na + flat->nb;
+	flat->array->b.size = 0;
+	stack_count_breaks(&flat->array->a);
+	free(flat->tmp);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:46:03 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 06:14:55 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file radix_scan.c
+ * @brief Reads the bit column of a radix pass before the pass runs.
+ *
+ * A radix pass takes the values from the top of a stack in order, and
+ * what it does with each one only depends on one of its bits. So the
+ * decisions of the next PS_SCAN_CHUNK values can be read up front, from
+ * the ring buffer in place, into a bit mask that the pass then replays.
+ *
+ * On x86-64 the column is read 8 values at a time with AVX2 when the
+ * processor supports it, checked at run time, or 4 at a time with SSE2,
+ * which every x86-64 processor has: shifting the tested bit into the
+ * sign bit lets `movemask` gather the decisions into one byte. Other
+ * processors read it one value at a time.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup radix
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Appends the decisions of a run of values, one at a time.
+ *
+ * @param scan Mask being filled, cleared beforehand.
+ * @param values Values in pass order.
+ * @param count Number of values.
+ *
+ * @ingroup radix
+ */
+void	scan_scalar(t_scan *scan, const int *values, int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		if ((values[i] >> scan->bit) & 1)
+			scan->mask[scan->count >> 3] |= 1 << (scan->count & 7);
+		scan->count++;
+		i++;
+	}
+}
+
+#if PS_SCAN_X86
+
+/**
+ * @brief Appends the decisions of a run of values with the widest scan.
+ *
+ * @param scan Mask being filled, cleared beforehand.
+ * @param values Values in pass order.
+ * @param count Number of values.
+ *
+ * @ingroup radix
+ * @see scan_avx2
+ * @see scan_sse2
+ */
+static void	scan_run(t_scan *scan, const int *values, int count)
+{
+	if (__builtin_cpu_supports("avx2"))
+		scan_avx2(scan, values, count);
+	else
+		scan_sse2(scan, values, count);
+}
+
+#else
+
+/**
+ * @brief Appends the decisions of a run of values with the widest scan.
+ *
+ * @param scan Mask being filled, cleared beforehand.
+ * @param values Values in pass order.
+ * @param count Number of values.
+ *
+ * @ingroup radix
+ * @see scan_scalar
+ */
+static void	scan_run(t_scan *scan, const int *values, int count)
+{
+	scan_scalar(scan, values, count);
+}
+
+#endif
+
+/**
+ * @brief Reads the decisions of the next values of a radix pass.
+ *
+ * The values are read from the top of the stack, in the at most two
+ * runs the ring buffer stores them in. Bit i of the mask is set when
+ * the value at position i has a 1 at `bit`.
+ *
+ * @param stack Stack the pass takes its values from.
+ * @param count Values left in the pass; at most PS_SCAN_CHUNK are read.
+ * @param bit Bit tested by the pass.
+ * @param scan Receives the mask, and the number of values read.
+ *
+ * @ingroup radix
+ * @see scan_run
+ */
+void	radix_scan(const t_stack *stack, int count, int bit, t_scan *scan)
+{
+	int	first;
+
+	if (count > PS_SCAN_CHUNK)
+		count = PS_SCAN_CHUNK;
+	ft_memset(scan->mask, 0, (count + 7) / 8);
+	scan->bit = bit;
+	scan->count = 0;
+	first = stack->capacity - stack->head;
+	if (first > count)
+		first = count;
+	scan_run(scan, stack->data + stack->head, first);
+	scan_run(scan, stack->data, count - first);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix_scan_x86.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:53:16 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 06:22:08 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file radix_scan_x86.c
+ * @brief Vector scans of a radix pass's bit column, for x86-64.
+ *
+ * Shifting the tested bit of each value into its sign bit lets
+ * `movemask` gather the decisions of a whole vector into the mask. AVX2
+ * is only used when `radix_scan` finds it at run time; SSE2 is part of
+ * every x86-64 processor. Built empty on other processors.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup radix
+ */
+#include "push_swap.h"
+#if PS_SCAN_X86
+# include <immintrin.h>
+
+/**
+ * @brief Appends the decisions of a run of values, 8 at a time.
+ *
+ * Values are read one by one up to a byte boundary of the mask, so
+ * every `movemask` fills a whole byte.
+ *
+ * @param scan Mask being filled, cleared beforehand.
+ * @param values Values in pass order.
+ * @param count Number of values.
+ *
+ * @ingroup radix
+ * @see scan_scalar
+ */
+__attribute__((target("avx2")))
+void	scan_avx2(t_scan *scan, const int *values, int count)
+{
+	__m128i	shift;
+	__m256i	column;
+	int		i;
+
+	i = (8 - (scan->count & 7)) & 7;
+	if (i > count)
+		i = count;
+	scan_scalar(scan, values, i);
+	shift = _mm_cvtsi32_si128(31 - scan->bit);
+	while (i + 8 <= count)
+	{
+		column = _mm256_sll_epi32(_mm256_loadu_si256(
+					(const __m256i *)(values + i)), shift);
+		scan->mask[scan->count >> 3] = _mm256_movemask_ps(
+				_mm256_castsi256_ps(column));
+		scan->count += 8;
+		i += 8;
+	}
+	scan_scalar(scan, values + i, count - i);
+}
+
+/**
+ * @brief Appends the decisions of a run of values, 4 at a time.
+ *
+ * @param scan Mask being filled, cleared beforehand.
+ * @param values Values in pass order.
+ * @param count Number of values.
+ *
+ * @ingroup radix
+ * @see scan_scalar
+ */
+void	scan_sse2(t_scan *scan, const int *values, int count)
+{
+	__m128i	shift;
+	__m128i	column;
+	int		i;
+
+	i = (4 - (scan->count & 3)) & 3;
+	if (i > count)
+		i = count;
+	scan_scalar(scan, values, i);
+	shift = _mm_cvtsi32_si128(31 - scan->bit);
+	while (i + 4 <= count)
+	{
+		column = _mm_sll_epi32(_mm_loadu_si128(
+					(const __m128i *)(values + i)), shift);
+		scan->mask[scan->count >> 3] |= _mm_movemask_ps(
+				_mm_castsi128_ps(column)) << (scan->count & 7);
+		scan->count += 4;
+		i += 4;
+	}
+	scan_scalar(scan, values + i, count - i);
+}
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/13 08:21:51 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 08:45:11 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/18 06:51:00 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,6 +19,9 @@
  * The algorithm uses index-based binary sorting by pushing/pulling elements
  * between stacks A and B based on individual bit values.
  *
+ * It runs every operation on the stacks, and serves as the reference
+ * for the simulation-free engine of radix_flat.c.
+ *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
  * @date
@@ -40,7 +43,7 @@
  */
 static void	push_all_from_b_to_a(t_array *array)
 {
-	while (array->b_size != 0)
+	while (array->b.size != 0)
 		pa(array);
 }
 
@@ -48,29 +51,39 @@ static void	push_all_from_b_to_a(t_array *array)
  * @brief Processes elements in stack B for the next bit level.
  *
  * Elements with a 0 in the next bit stay in B (via rotate),
- * and those with a 1 move to A.
+ * and those with a 1 move to A. The bits are read ahead in chunks by
+ * `radix_scan`, then replayed.
  *
  * @param array Pointer to the main stack structure.
  * @param next_bit The bit position to test.
  * @param bit_count Maximum number of bits needed for the sort.
  *
  * @ingroup radix
+ * @see radix_scan
  * @see rb
  * @see pa
  */
 static void	process_array_b_for_next_bit(t_array *array, int next_bit,
 																int bit_count)
 {
-	int	size;
+	t_scan	scan;
+	int		size;
+	int		i;
 
-	size = array->b_size;
+	size = array->b.size;
 	while (size > 0 && next_bit <= bit_count)
 	{
-		if (((array->b[0] >> next_bit) & 1) == 0)
-			rb(array);
-		else
-			pa(array);
-		size--;
+		radix_scan(&array->b, size, next_bit, &scan);
+		i = 0;
+		while (i < scan.count)
+		{
+			if (((scan.mask[i >> 3] >> (i & 7)) & 1) == 0)
+				rb(array);
+			else
+				pa(array);
+			i++;
+		}
+		size -= scan.count;
 	}
 }
 
@@ -78,28 +91,39 @@ static void	process_array_b_for_next_bit(t_array *array, int next_bit,
  * @brief Moves elements from stack A to B based on bit value.
  *
  * Elements with a 0 in the current bit go to B, and those with a 1
- * are rotated within A.
+ * are rotated within A. The bits are read ahead in chunks by
+ * `radix_scan`, then replayed. The pass stops early once A is sorted,
+ * which the stack engine reports in constant time.
  *
  * @param array Pointer to the main stack structure.
  * @param bit The bit position to test.
  *
  * @ingroup radix
+ * @see radix_scan
  * @see pb
  * @see ra
- * @see ft_is_array_sorted
+ * @see stack_is_sorted
  */
 static void	move_elements_from_a_based_on_bit(t_array *array, int bit)
 {
-	int	size;
+	t_scan	scan;
+	int		size;
+	int		i;
 
-	size = array->a_size;
-	while (size > 0 && !ft_is_array_sorted(array->a, array->a_size))
+	size = array->a.size;
+	while (size > 0 && !stack_is_sorted(&array->a))
 	{
-		if (((array->a[0] >> bit) & 1) == 0)
-			pb(array);
-		else
-			ra(array);
-		size--;
+		radix_scan(&array->a, size, bit, &scan);
+		i = 0;
+		while (i < scan.count && !stack_is_sorted(&array->a))
+		{
+			if (((scan.mask[i >> 3] >> (i & 7)) & 1) == 0)
+				pb(array);
+			else
+				ra(array);
+			i++;
+		}
+		size -= scan.count;
 	}
 }
 
@@ -130,34 +154,38 @@ static int	calculate_bit_count(int size)
 /**
  * @brief Sorts the stack using radix sort and stack operations.
  *
+ * Reference for `radix_sort`, which emits the same operations without
+ * running them on the stacks; selected with `--engine radix-sim`.
+ *
  * This function:
- * - Assigns index-based values to elements
  * - Loops through each bit position to distribute elements
  * - Collects them back into A, sorted
  *
+ * Stack A already holds index-based values, assigned by `assign_indices`.
+ * In a portfolio run it stops between bits once a rival engine has done
+ * better.
+ *
  * @param array Pointer to the main stack structure.
  *
  * @ingroup radix
  * @see assign_indices
- * @see give_values_back
  * @see move_elements_from_a_based_on_bit
  * @see process_array_b_for_next_bit
  * @see push_all_from_b_to_a
+ * @see sort_aborted
  */
-void	radix_sort(t_array *array)
+void	radix_sort_sim(t_array *array)
 {
 	int	bit;
 	int	bit_count;
 
-	assign_indices(array);
-	bit_count = calculate_bit_count(array->a_size);
+	bit_count = calculate_bit_count(array->a.size);
 	bit = 0;
-	while (bit <= bit_count)
+	while (bit <= bit_count && !sort_aborted(array))
 	{
 		move_elements_from_a_based_on_bit(array, bit);
 		process_array_b_for_next_bit(array, bit + 1, bit_count);
 		bit++;
 	}
 	push_all_from_b_to_a(array);
-	give_values_back(array);
 }
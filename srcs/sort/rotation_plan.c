@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rotation_plan.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:39:40 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 11:39:40 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file rotation_plan.c
+ * @brief Plans the rotations that visit every swapped pair of a rotated
+ *        stack.
+ *
+ * The swapped pairs and the min sit at known positions around the ring.
+ * Walking a ring to visit points never needs more than one turn, so the
+ * plan is one or two legs of rotations: either straight to the farthest
+ * pair, or out to a pair and back past the top to the pair next to it,
+ * in either direction. Every such route is costed in one linear pass,
+ * the rotations that then bring the min to the top included.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup turk
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Tells whether the values at `pos` and below are swapped.
+ *
+ * @param a Stack A, normalized, holding every value.
+ * @param pos Position of the upper value, around the ring.
+ * @return true if the upper value follows the lower one.
+ *
+ * @ingroup turk
+ */
+bool	rotation_swapped_at(const t_stack *a, int pos)
+{
+	return (stack_get(a, pos % a->size)
+		== (stack_get(a, (pos + 1) % a->size) + 1) % a->size);
+}
+
+/**
+ * @brief Rotations needed to turn a ring by `offset`, the shorter way.
+ *
+ * @param offset Signed offset, in either direction.
+ * @param size Size of the ring.
+ * @return Number of rotations, at most `size / 2`.
+ *
+ * @ingroup turk
+ */
+static int	ring_distance(int offset, int size)
+{
+	offset = ((offset % size) + size) % size;
+	if (offset > size / 2)
+		return (size - offset);
+	return (offset);
+}
+
+/**
+ * @brief Keeps a route of two legs if it beats the best one so far.
+ *
+ * @param best Cost and legs of the best route, updated.
+ * @param first First leg, positive for `ra`, negative for `rra`.
+ * @param second Second leg, in the opposite direction or empty.
+ * @param ring Position of the min and size of the stack.
+ *
+ * @ingroup turk
+ * @see ring_distance
+ */
+static void	try_route(int best[3], int first, int second, const int ring[2])
+{
+	int	cost;
+
+	cost = ring_distance(ring[0] - first - second, ring[1]);
+	cost += first * ((first > 0) - (first < 0));
+	cost += second * ((second > 0) - (second < 0));
+	if (cost < best[0])
+	{
+		best[0] = cost;
+		best[1] = first;
+		best[2] = second;
+	}
+}
+
+/**
+ * @brief Plans the cheapest route through every swapped pair of A.
+ *
+ * A pair at the top needs no rotation. For each other pair, in order,
+ * the routes turning between it and the previous one are tried both
+ * ways; the route running straight to the last pair closes the list.
+ * The min sits where the top value says, give or take the pair it may
+ * belong to.
+ *
+ * @param a Stack A, normalized, sorted up to a rotation and swaps.
+ * @param legs Receives the two legs of the route, positive for `ra`,
+ *             negative for `rra`.
+ *
+ * @ingroup turk
+ * @see rotation_swapped_at
+ * @see try_route
+ */
+void	plan_rotation_sweep(const t_stack *a, int legs[2])
+{
+	int	best[3];
+	int	ring[2];
+	int	prev;
+	int	pos;
+
+	ring[0] = (a->size - stack_get(a, 0)) % a->size;
+	ring[1] = a->size;
+	best[0] = INT_MAX;
+	prev = 0;
+	pos = 0;
+	while (++pos < a->size)
+	{
+		if (rotation_swapped_at(a, pos))
+		{
+			try_route(best, prev, pos - a->size - prev, ring);
+			try_route(best, pos - a->size, a->size - pos + prev, ring);
+			prev = pos;
+		}
+	}
+	try_route(best, prev, 0, ring);
+	legs[0] = best[1];
+	legs[1] = best[2];
+}
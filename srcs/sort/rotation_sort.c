@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rotation_sort.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:48:19 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 11:46:53 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file rotation_sort.c
+ * @brief Engine for inputs that are sorted up to a rotation and a few swaps.
+ *
+ * A sorted list rotated by k only needs min(k, n - k) rotations. When a
+ * few pairs of neighbours are also swapped, each pair is fixed with `sa`
+ * once a rotation brings it to the top, sweeping the stack in the one
+ * direction that reaches every pair and then the min soonest.
+ * Recognizing these inputs takes one linear pass over stack A; any other
+ * input is handed over to the lis engine.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup turk
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Rank of a value of A, counted from the value at `start`.
+ *
+ * @param a Stack A, normalized, holding every value.
+ * @param start Position of the value ranked 0.
+ * @param i Distance from `start` towards the bottom, around the ring.
+ * @return Rank of the value, from 0 to `a->size - 1`.
+ *
+ * @ingroup turk
+ */
+static int	rank_at(const t_stack *a, int start, int i)
+{
+	return ((stack_get(a, (start + i) % a->size) - stack_get(a, start)
+			+ a->size) % a->size);
+}
+
+/**
+ * @brief Counts the swapped neighbours of a rotated sorted stack.
+ *
+ * The walk starts on a value following its upper neighbour, so it never
+ * starts inside a swapped pair. From there, every value must hold its
+ * rank, or be the first of two swapped neighbours.
+ *
+ * @param a Stack A, normalized, holding every value.
+ * @return Number of swapped pairs, or -1 if A is not sorted up to a
+ *         rotation and such swaps.
+ *
+ * @ingroup turk
+ * @see rank_at
+ */
+int	count_rotated_swaps(const t_stack *a)
+{
+	int	start;
+	int	swaps;
+	int	i;
+
+	start = 0;
+	while (start < a->size && rank_at(a, start, a->size - 1) != a->size - 1)
+		start++;
+	swaps = 0;
+	i = 0;
+	while (start < a->size && i < a->size)
+	{
+		if (rank_at(a, start, i) == i)
+			i++;
+		else if (i + 1 < a->size && rank_at(a, start, i) == i + 1
+			&& rank_at(a, start, i + 1) == i)
+		{
+			swaps++;
+			i += 2;
+		}
+		else
+			return (-1);
+	}
+	if (start == a->size)
+		return (-1);
+	return (swaps);
+}
+
+/**
+ * @brief Sorts a rotated stack by fixing its swapped pairs on the way.
+ *
+ * The route is planned once, so the whole sort is linear: each pair is
+ * fixed with `sa` as a rotation brings it to the top. Inputs that
+ * `count_rotated_swaps` rejects go to `lis_sort`, which keeps their
+ * sorted part in A as well.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup turk
+ * @see plan_rotation_sweep
+ * @see rotate_min_to_top
+ */
+void	rotation_sort(t_array *array)
+{
+	int	legs[2];
+	int	i;
+
+	if (count_rotated_swaps(&array->a) < 0)
+	{
+		lis_sort(array);
+		return ;
+	}
+	plan_rotation_sweep(&array->a, legs);
+	i = 0;
+	while (i < 2)
+	{
+		if (rotation_swapped_at(&array->a, 0))
+			sa(array);
+		if (legs[i] > 0)
+			ra(array);
+		else if (legs[i] < 0)
+			rra(array);
+		legs[i] -= (legs[i] > 0) - (legs[i] < 0);
+		i += (legs[i] == 0);
+	}
+	if (rotation_swapped_at(&array->a, 0))
+		sa(array);
+	rotate_min_to_top(array);
+}
@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/12 14:45:10 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 08:48:52 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/18 07:12:39 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,10 +18,14 @@
  * strategy based on the size of stack A.
  *
  * For:
- * - 2 elements: simple swap
- * - 3 elements: hardcoded mini-sort
- * - 4–5 elements: optimized small-sort logic
- * - 6+ elements: radix sort
+ * - up to 7 elements: precomputed minimal sequence
+ * - 8 elements: exhaustive search for a minimal sequence
+ * - 9+ elements: the engine predicted cheapest from how presorted the
+ *   input is (see profile.c), among rotation, lis, turk (up to
+ *   PS_TURK_MAX) and radix sort
+ *
+ * The engine for 9+ elements can be forced with `--engine`, and
+ * `--engine portfolio` races several of them (see portfolio.c).
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -32,32 +36,103 @@
  */
 #include "push_swap.h"
 
+/**
+ * @brief Tells whether the running engine should give up.
+ *
+ * An engine gives up once its log is at least as long as the best one
+ * a rival has produced, or once an allocation failed. Engines call it
+ * between passes, where stopping early leaves nothing to clean up.
+ *
+ * @param array Pointer to the main stack structure.
+ * @return true if the engine should stop, setting `array->aborted`.
+ *
+ * @ingroup sorting
+ * @see portfolio_sort
+ */
+bool	sort_aborted(t_array *array)
+{
+	if (array->log.failed || (array->bound && array->log.size
+			>= atomic_load_explicit(array->bound, memory_order_relaxed)))
+		array->aborted = true;
+	return (array->aborted);
+}
+
+/**
+ * @brief Resolves the engine used above PS_OPTIMAL_MAX values.
+ *
+ * @param array Pointer to the main stack structure.
+ * @return The engine forced with `--engine`, or the one `profile_stack`
+ *         predicts to be cheapest.
+ *
+ * @ingroup sorting
+ * @see profile_stack
+ */
+static t_engine	pick_engine(t_array *array)
+{
+	t_profile	profile;
+
+	if (array->engine != ENGINE_AUTO || array->a.size <= PS_OPTIMAL_MAX)
+		return (array->engine);
+	profile_stack(&array->a, &profile);
+	return (profile.engine);
+}
+
 /**
  * @brief Sorts stack A using the most efficient strategy based on size.
  *
  * Chooses from different sorting algorithms depending on the number of
  * elements in stack A:
- * - 2 → `sort_two`
- * - 3 → `sort_three`
- * - 4–5 → `sort_four_and_five`
- * - 6+ → `radix_sort`
+ * - 2 to PS_TABLE_MAX → `table_sort`
+ * - up to PS_OPTIMAL_MAX → `optimal_sort`
+ * - larger → the engine `profile_stack` predicts to emit the fewest
+ *   operations: `rotation_sort` on rotated inputs with a few swapped
+ *   neighbours, `lis_sort` on other presorted inputs, otherwise
+ *   `turk_sort` up to PS_TURK_MAX and `radix_sort` above
+ *
+ * Above PS_OPTIMAL_MAX, an engine requested with `--engine` takes
+ * precedence over the prediction, and `portfolio_sort` keeps the
+ * shortest result of several engines.
+ *
+ * Stack A holds normalized indices at this point; the original values
+ * are put back once the strategy is done.
  *
  * @param array Pointer to the main stack structure.
  *
  * @ingroup sorting
- * @see sort_two
- * @see sort_three
- * @see sort_four_and_five
+ * @see table_sort
+ * @see optimal_sort
+ * @see pick_engine
+ * @see portfolio_sort
+ * @see turk_sort
+ * @see ternary_sort
+ * @see lis_sort
+ * @see rotation_sort
  * @see radix_sort
+ * @see radix_sort_sim
+ * @see give_values_back
  */
 void	sort_array(t_array *array)
 {
-	if (array->a_size == 2)
-		sort_two(array);
-	else if (array->a_size == 3)
-		sort_three(array);
-	else if (array->a_size <= 5)
-		sort_four_and_five(array);
+	t_engine	engine;
+
+	engine = pick_engine(array);
+	if (array->a.size <= PS_TABLE_MAX)
+		table_sort(array);
+	else if (array->a.size <= PS_OPTIMAL_MAX)
+		optimal_sort(array);
+	else if (engine == ENGINE_PORTFOLIO)
+		portfolio_sort(array);
+	else if (engine == ENGINE_TERNARY)
+		ternary_sort(array);
+	else if (engine == ENGINE_LIS)
+		lis_sort(array);
+	else if (engine == ENGINE_ROTATION)
+		rotation_sort(array);
+	else if (engine == ENGINE_RADIX_SIM)
+		radix_sort_sim(array);
+	else if (engine == ENGINE_TURK)
+		turk_sort(array);
 	else
 		radix_sort(array);
+	give_values_back(array);
 }
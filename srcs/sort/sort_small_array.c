@@ -6,17 +6,17 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/12 16:29:51 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 08:41:24 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/17 16:32:13 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 /**
  * @file sort_small_array.c
- * @brief Implements sorting logic for small stack sizes (≤ 5 elements).
+ * @brief Implements sorting helpers for small stacks.
  *
- * Contains logic to efficiently sort stacks of 2, 3, 4, or 5 elements
- * using a minimal number of operations. This is used instead of radix
- * sort for small input sizes to reduce operation count.
+ * Contains the hardcoded 3-element sort and the rotation of the minimum
+ * to the top, both used by the turk engine. Whole inputs of up to
+ * PS_OPTIMAL_MAX elements are handled by `optimal_sort` instead.
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -27,21 +27,6 @@
  */
 #include "push_swap.h"
 
-/**
- * @brief Sorts two elements in stack A.
- *
- * Performs a single swap if necessary.
- *
- * @param array Pointer to the main stack structure.
- *
- * @ingroup sorting
- * @see sa
- */
-void	sort_two(t_array *array)
-{
-	sa(array);
-}
-
 /**
  * @brief Sorts three elements in stack A.
  *
@@ -57,23 +42,23 @@ void	sort_two(t_array *array)
  */
 void	sort_three(t_array *array)
 {
-	if (array->a[0] > array->a[1] && array->a[1] < array->a[2]
-		&& array->a[0] < array->a[2])
+	int	a[3];
+
+	a[0] = stack_get(&array->a, 0);
+	a[1] = stack_get(&array->a, 1);
+	a[2] = stack_get(&array->a, 2);
+	if (a[0] > a[1] && a[1] < a[2] && a[0] < a[2])
 		sa(array);
-	else if (array->a[0] > array->a[1] && array->a[1] > array->a[2]
-		&& array->a[0] > array->a[2])
+	else if (a[0] > a[1] && a[1] > a[2] && a[0] > a[2])
 	{
 		sa(array);
 		rra(array);
 	}
-	else if (array->a[0] > array->a[1] && array->a[1] < array->a[2]
-		&& array->a[0] > array->a[2])
+	else if (a[0] > a[1] && a[1] < a[2] && a[0] > a[2])
 		ra(array);
-	else if (array->a[0] < array->a[1] && array->a[1] > array->a[2]
-		&& array->a[0] > array->a[2])
+	else if (a[0] < a[1] && a[1] > a[2] && a[0] > a[2])
 		rra(array);
-	else if (array->a[0] < array->a[1] && array->a[1] > array->a[2]
-		&& array->a[0] < array->a[2])
+	else if (a[0] < a[1] && a[1] > a[2] && a[0] < a[2])
 	{
 		sa(array);
 		ra(array);
@@ -81,31 +66,30 @@ void	sort_three(t_array *array)
 }
 
 /**
- * @brief Finds the index of the smallest value in an array.
+ * @brief Finds the index of the smallest value in a stack.
  *
- * @param array Pointer to the array.
- * @param size Number of elements in the array.
- * @return Index of the smallest value, or -1 if array is empty.
+ * @param stack Pointer to the stack.
+ * @return Index of the smallest value, or -1 if the stack is empty.
  *
  * @ingroup sorting
  * @see rotate_min_to_top
  */
-static int	find_min_index(int *array, int size)
+static int	find_min_index(const t_stack *stack)
 {
 	int	min;
 	int	min_index;
 	int	i;
 
-	if (size <= 0)
+	if (stack->size <= 0)
 		return (-1);
-	min = array[0];
+	min = stack_get(stack, 0);
 	min_index = 0;
 	i = 1;
-	while (i < size)
+	while (i < stack->size)
 	{
-		if (array[i] < min)
+		if (stack_get(stack, i) < min)
 		{
-			min = array[i];
+			min = stack_get(stack, i);
 			min_index = i;
 		}
 		i++;
@@ -126,12 +110,12 @@ static int	find_min_index(int *array, int size)
  * @see ra
  * @see rra
  */
-static void	rotate_min_to_top(t_array *array)
+void	rotate_min_to_top(t_array *array)
 {
 	int	min_index;
 
-	min_index = find_min_index(array->a, array->a_size);
-	if (min_index <= array->a_size / 2)
+	min_index = find_min_index(&array->a);
+	if (min_index <= array->a.size / 2)
 	{
 		while (min_index > 0)
 		{
@@ -141,40 +125,10 @@ static void	rotate_min_to_top(t_array *array)
 	}
 	else
 	{
-		while (min_index < array->a_size)
+		while (min_index < array->a.size)
 		{
 			rra(array);
 			min_index++;
 		}
 	}
 }
-
-/**
- * @brief Sorts 4 or 5 elements in stack A using optimized logic.
- *
- * Pushes the smallest elements to stack B, sorts the remaining
- * 3 elements, and restores the pushed elements.
- *
- * @param array Pointer to the main stack structure.
- *
- * @ingroup sorting
- * @see sort_three
- * @see rotate_min_to_top
- * @see pb
- * @see pa
- */
-void	sort_four_and_five(t_array *array)
-{
-	int	push_count;
-
-	push_count = array->a_size - 3;
-	while (push_count > 0)
-	{
-		rotate_min_to_top(array);
-		pb(array);
-		push_count--;
-	}
-	sort_three(array);
-	while (array->b_size > 0)
-		pa(array);
-}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   table_sort.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:15:31 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 17:15:31 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file table_sort.c
+ * @brief Answers small inputs from the precomputed sequence tables.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup optimal
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Sorts up to PS_TABLE_MAX values with a precomputed sequence.
+ *
+ * The permutation in stack A is ranked, its minimal sequence is copied
+ * into the operation log in one block, and stack A is set to the sorted
+ * indices that sequence would produce.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup optimal
+ * @see optimal_table
+ * @see oplog_extend
+ */
+void	table_sort(t_array *array)
+{
+	const unsigned char	*ops;
+	t_state				state;
+	int					len;
+	int					i;
+
+	state.size = array->a.size;
+	state.a_size = array->a.size;
+	i = 0;
+	while (i < state.size)
+	{
+		state.v[i] = stack_get(&array->a, i);
+		i++;
+	}
+	ops = optimal_table(state.size, encode_state(&state) / (state.size + 1),
+			&len);
+	oplog_extend(&array->log, ops, len);
+	i = 0;
+	while (i < state.size)
+	{
+		stack_set(&array->a, i, i);
+		i++;
+	}
+}
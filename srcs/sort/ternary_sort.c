@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ternary_sort.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:09:33 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 02:09:33 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file ternary_sort.c
+ * @brief Radix sort in base 3, using three buckets per pass.
+ *
+ * Each pass reads stack A from the top and sorts it stably on one
+ * ternary digit of the indices:
+ * - digit 2 stays in A, rotated to its bottom
+ * - digit 1 goes to the top of B
+ * - digit 0 goes to the bottom of B
+ *
+ * The two buckets of B are then pushed back on top of the first one,
+ * so A holds the digits 0, 1 then 2, each in its previous order.
+ *
+ * A pass covers log2(3) bits, so the number of passes drops by about
+ * 37%, but the bottom bucket of B costs four operations per element
+ * against one or two for the others. On random inputs the engine emits
+ * 20% to 50% more operations than `radix_sort`, even once the peephole
+ * pass has fused the `rb` of that bucket with a following `ra`. It is
+ * therefore left out of `--engine`, the automatic dispatch and the
+ * portfolio, and only runs when a library caller asks for
+ * ENGINE_TERNARY.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ *
+ * @ingroup radix
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Splits stack A into the three buckets of one ternary digit.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param power Weight of the digit, a power of 3.
+ * @return Number of values sent to the top of B.
+ *
+ * @ingroup radix
+ */
+static int	distribute(t_array *array, long power)
+{
+	int	size;
+	int	digit;
+	int	ones;
+
+	ones = 0;
+	size = array->a.size;
+	while (size-- > 0)
+	{
+		digit = stack_get(&array->a, 0) / power % 3;
+		if (digit == 2)
+			ra(array);
+		else
+			pb(array);
+		if (digit == 0)
+			rb(array);
+		ones += (digit == 1);
+	}
+	return (ones);
+}
+
+/**
+ * @brief Pushes both buckets of B back on top of stack A.
+ *
+ * The top bucket holds its values in reverse, and the bottom bucket is
+ * read from the end, so both land in A in their original order.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param ones Number of values in the top bucket of B.
+ *
+ * @ingroup radix
+ */
+static void	gather(t_array *array, int ones)
+{
+	while (ones-- > 0)
+		pa(array);
+	while (array->b.size > 0)
+	{
+		rrb(array);
+		pa(array);
+	}
+}
+
+/**
+ * @brief Sorts stack A with a base-3 radix sort.
+ *
+ * Stack A holds normalized indices. Passes stop as soon as A is sorted,
+ * and, in a portfolio run, once a rival engine has done better.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup radix
+ * @see distribute
+ * @see gather
+ * @see sort_aborted
+ */
+void	ternary_sort(t_array *array)
+{
+	long	power;
+
+	power = 1;
+	while (power < array->a.size && !stack_is_sorted(&array->a)
+		&& !sort_aborted(array))
+	{
+		gather(array, distribute(array, power));
+		power *= 3;
+	}
+}
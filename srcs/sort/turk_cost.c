@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   turk_cost.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:58:24 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 14:58:24 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file turk_cost.c
+ * @brief Cost evaluation for the turk sorting engine.
+ *
+ * While elements are reinserted, stack A is always sorted up to a
+ * rotation. The target slot of a value is therefore found by binary
+ * search, and the cheapest element of B is searched outwards from the
+ * top and bottom of B, stopping as soon as no farther element can win.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup turk
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Finds the position of the smallest value in a rotated sorted stack.
+ *
+ * @param a Stack sorted in ascending order up to a rotation.
+ * @return Index of its smallest element.
+ *
+ * @ingroup turk
+ */
+static int	find_min_position(const t_stack *a)
+{
+	int	low;
+	int	high;
+	int	mid;
+
+	low = 0;
+	high = a->size - 1;
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if (stack_get(a, mid) > stack_get(a, high))
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return (low);
+}
+
+/**
+ * @brief Finds where a value must be inserted into a rotated sorted stack.
+ *
+ * The target is the smallest element greater than `value`; once it is
+ * on top of A, pushing `value` keeps A sorted up to a rotation. If no
+ * element is greater, the target is the smallest element.
+ *
+ * @param a Stack sorted in ascending order up to a rotation.
+ * @param value Value about to be pushed onto A.
+ * @return Index of the element that must be on top before pushing.
+ *
+ * @ingroup turk
+ * @see find_min_position
+ */
+int	find_target_position(const t_stack *a, int value)
+{
+	int	min;
+	int	low;
+	int	high;
+	int	mid;
+
+	min = find_min_position(a);
+	low = 0;
+	high = a->size;
+	while (low < high)
+	{
+		mid = low + (high - low) / 2;
+		if (stack_get(a, (min + mid) % a->size) < value)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return ((min + low) % a->size);
+}
+
+/**
+ * @brief Counts the operations needed for a pair of signed rotations.
+ *
+ * Rotations in the same direction run together as `rr` or `rrr`, so
+ * only the longer one counts; opposite directions add up.
+ *
+ * @param a Signed rotations of stack A.
+ * @param b Signed rotations of stack B.
+ * @return Number of operations.
+ *
+ * @ingroup turk
+ */
+static int	move_cost(int a, int b)
+{
+	if (a < 0 && b < 0)
+	{
+		a = -a;
+		b = -b;
+	}
+	if (a >= 0 && b >= 0)
+	{
+		if (a > b)
+			return (a);
+		return (b);
+	}
+	if (a < 0)
+		return (b - a);
+	return (a - b);
+}
+
+/**
+ * @brief Computes the cheapest way to bring a B element and its target up.
+ *
+ * Each stack can be rotated up or down, giving four combinations to
+ * compare with `move_cost`.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param index Position of the candidate element in stack B.
+ * @return The cheapest combination of rotations.
+ *
+ * @ingroup turk
+ * @see find_target_position
+ * @see move_cost
+ */
+static t_move	move_for(t_array *array, int index)
+{
+	t_move	move;
+	int		rot_a[2];
+	int		rot_b[2];
+	int		cost;
+	int		i;
+
+	rot_a[0] = find_target_position(&array->a, stack_get(&array->b, index));
+	rot_a[1] = rot_a[0] - array->a.size;
+	rot_b[0] = index;
+	rot_b[1] = index - array->b.size;
+	move.cost = INT_MAX;
+	i = 0;
+	while (i < 4)
+	{
+		cost = move_cost(rot_a[i / 2], rot_b[i % 2]);
+		if (cost < move.cost)
+		{
+			move.a = rot_a[i / 2];
+			move.b = rot_b[i % 2];
+			move.cost = cost;
+		}
+		i++;
+	}
+	return (move);
+}
+
+/**
+ * @brief Finds the element of B that is cheapest to insert into A.
+ *
+ * Candidates are visited by increasing distance from the ends of B. An
+ * element `d` steps away costs at least `d` operations, so the search
+ * stops once `d` reaches the best cost found so far.
+ *
+ * @param array Pointer to the main stack structure.
+ * @return Rotations of the cheapest move.
+ *
+ * @ingroup turk
+ * @see move_for
+ */
+t_move	cheapest_move(t_array *array)
+{
+	t_move	best;
+	t_move	move;
+	int		d;
+
+	best = move_for(array, 0);
+	d = 1;
+	while (d < best.cost && d <= array->b.size / 2)
+	{
+		move = move_for(array, d);
+		if (move.cost < best.cost)
+			best = move;
+		move = move_for(array, array->b.size - d);
+		if (move.cost < best.cost)
+			best = move;
+		d++;
+	}
+	return (best);
+}
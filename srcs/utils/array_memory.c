@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_memory.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:15:06 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 14:25:39 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file array_memory.c
+ * @brief Allocation and release of the storage behind `t_array`.
+ *
+ * Stacks A and B and the sorted copy of the input are sized to the actual
+ * number of values and share a single allocation, so small inputs only
+ * touch a few bytes and large inputs have no fixed ceiling.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup utils
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Allocates the stacks and the sorted copy for `size` values.
+ *
+ * One arena of `3 * size` integers is split into the storage of stack A,
+ * stack B and `sorted_values`. Each stack can hold every value at once.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param size Number of input values.
+ * @return true on success, false if the allocation failed.
+ *
+ * @ingroup utils
+ * @see free_array
+ */
+bool	init_array(t_array *array, int size)
+{
+	array->arena = malloc(3 * (size_t)size * sizeof(int));
+	if (!array->arena)
+		return (false);
+	array->a.data = array->arena;
+	array->a.capacity = size;
+	array->b.data = array->arena + size;
+	array->b.capacity = size;
+	array->sorted_values = array->arena + 2 * (size_t)size;
+	return (true);
+}
+
+/**
+ * @brief Fits the stacks to the number of values actually read.
+ *
+ * The parsers allocate for the most values their input could hold and
+ * learn the real count while converting. Only stack A has been written
+ * by then: it stays at the start of the arena, and stack B and
+ * `sorted_values` move right after it, so the unused tail of the arena
+ * is never touched.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param size Number of values in stack A.
+ *
+ * @ingroup utils
+ * @see init_array
+ */
+void	fit_array(t_array *array, int size)
+{
+	array->a.capacity = size;
+	array->b.data = array->arena + size;
+	array->b.capacity = size;
+	array->sorted_values = array->arena + 2 * (size_t)size;
+}
+
+/**
+ * @brief Releases the arena and the operation log of the structure.
+ *
+ * @param array Pointer to the main stack structure.
+ *
+ * @ingroup utils
+ * @see init_array
+ * @see oplog_free
+ */
+void	free_array(t_array *array)
+{
+	free(array->arena);
+	array->arena = NULL;
+	array->a.data = NULL;
+	array->b.data = NULL;
+	array->sorted_values = NULL;
+	oplog_free(&array->log);
+}
+
+/**
+ * @brief Prepares an array for another instance of `size` values.
+ *
+ * The arena and the log buffer of the previous instance are kept when
+ * they are large enough, so a batch worker only allocates when it meets
+ * a larger instance than any before. Both stacks and the log are left
+ * empty.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param size Number of values of the next instance.
+ * @return true on success, false if the allocation failed.
+ *
+ * @ingroup utils
+ * @see init_array
+ */
+bool	reserve_array(t_array *array, int size)
+{
+	if (size > array->a.capacity)
+	{
+		free(array->arena);
+		array->arena = NULL;
+		array->a.capacity = 0;
+		if (!init_array(array, size))
+			return (false);
+	}
+	array->a.head = 0;
+	array->a.size = 0;
+	array->a.breaks = 0;
+	array->b.head = 0;
+	array->b.size = 0;
+	array->b.breaks = 0;
+	array->log.size = 0;
+	array->log.failed = false;
+	array->aborted = false;
+	return (true);
+}
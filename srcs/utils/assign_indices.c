@@ -6,7 +6,7 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/13 10:47:44 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 08:47:36 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/18 15:30:36 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,11 +15,12 @@
  * @brief Assigns normalized indices to stack A values for radix sort.
  *
  * This file includes functions to:
+ * - Detect duplicate values with one sweep over the sorted input
  * - Normalize values of stack A by assigning their sorted index
- * - Store original values for restoration after sorting
+ * - Restore original values after sorting
  *
- * Used primarily in radix sort to simplify bitwise sorting based on positive
- * index rather than raw value.
+ * Run once while parsing, so every sorting strategy works on positive
+ * indices rather than raw values and the input is sorted only once.
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -31,88 +32,145 @@
 #include "push_swap.h"
 
 /**
- * @brief Assigns a sorted index to each value in stack A.
+ * @brief Counts the digits of every key, and turns the counts into offsets.
  *
- * For each value in A, it looks up its sorted position in the copy and
- * replaces the original value with its index.
+ * @param a Stack A.
+ * @param offsets Receives, for each 11-bit digit of the keys, where the first
+ *                key holding each value of that digit goes.
  *
- * @param array Pointer to the main stack structure.
- * @param copy Sorted copy of stack A values.
+ * @ingroup radix
+ */
+static void	count_digits(const t_stack *a, int offsets[3][2048])
+{
+	unsigned int	key;
+	int				total;
+	int				digit;
+	int				i;
+
+	ft_memset(offsets, 0, 3 * 2048 * sizeof(int));
+	i = -1;
+	while (++i < a->size)
+	{
+		key = (unsigned int)stack_get(a, i) ^ 0x80000000u;
+		digit = -1;
+		while (++digit < 3)
+			offsets[digit][(key >> (digit * 11)) & 0x7FF]++;
+	}
+	i = -1;
+	while (++i < 3 * 2048)
+	{
+		if (i % 2048 == 0)
+			total = 0;
+		key = offsets[i / 2048][i % 2048];
+		offsets[i / 2048][i % 2048] = total;
+		total += key;
+	}
+}
+
+/**
+ * @brief Sorts the slots of A on one 11-bit digit of their values, stably.
+ *
+ * The first pass reads the slots in stack order; the others read the
+ * order left by the previous pass.
+ *
+ * @param a Stack A.
+ * @param order Slots in their current order, then the slots reordered.
+ * @param offsets Offsets of each value of the digit, consumed.
+ * @param shift Position of the digit in the key.
  *
  * @ingroup radix
- * @see assign_indices
  */
-static void	assign_index(t_array *array, int *copy)
+static void	sort_pass(const t_stack *a, int *order[2], int *offsets, int shift)
 {
-	int	i;
-	int	j;
+	unsigned int	key;
+	int				slot;
+	int				i;
 
 	i = 0;
-	while (i < array->a_size)
+	while (i < a->size)
 	{
-		j = 0;
-		while (j < array->a_size)
-		{
-			if (array->a[i] == copy[j])
-			{
-				array->a[i] = j;
-				break ;
-			}
-			j++;
-		}
+		if (shift == 0)
+			slot = (a->head + i) % a->capacity;
+		else
+			slot = order[0][i];
+		key = (unsigned int)a->data[slot] ^ 0x80000000u;
+		order[1][offsets[(key >> shift) & 0x7FF]++] = slot;
 		i++;
 	}
 }
 
-
 /**
- * @brief Stores sorted values from stack A into a backup array.
+ * @brief Copies the values in sorted order, and checks for duplicates.
  *
- * This allows restoring the original values after radix sort.
+ * Duplicates sit next to each other once the values are sorted, so
+ * comparing each value with the previous one is enough.
  *
  * @param array Pointer to the main stack structure.
- * @param copy Sorted copy of stack A values.
+ * @param order Slots of A from the smallest value to the largest.
+ * @return false if two values are equal.
  *
  * @ingroup radix
- * @see assign_indices
- * @see give_values_back
  */
-static void	store_values(t_array *array, int *copy)
+static bool	store_sorted(t_array *array, const int *order)
 {
 	int	i;
 
 	i = 0;
-	while (i < array->a_size)
+	while (i < array->a.size)
 	{
-		array->sorted_values[i] = copy[i];
+		array->sorted_values[i] = array->a.data[order[i]];
+		if (i > 0 && array->sorted_values[i - 1] == array->sorted_values[i])
+			return (false);
 		i++;
 	}
+	return (true);
 }
 
 /**
- * @brief Prepares stack A for radix sort by assigning index-based values.
+ * @brief Validates and normalizes stack A in a single sort-then-scan stage.
  *
- * - Copies stack A
- * - Sorts the copy
- * - Replaces each element in A with its index in the sorted copy
- * - Stores the sorted version for later restoration
+ * - Sorts the slots of A by value with an LSD radix sort, 11 bits per
+ *   pass, on the value with its sign bit flipped so that negative values
+ *   come first; B and `sorted_values` hold the slots between passes
+ * - Copies the values in sorted order into `sorted_values`, stopping if
+ *   two adjacent values are equal
+ * - Writes its rank into each slot of A
  *
- * @param array Pointer to the main stack structure.
+ * The sort takes no comparison and no extra memory, and each value is
+ * ranked without a search.
+ *
+ * @param array Pointer to the main stack structure, B empty.
+ * @return false if the input holds duplicates, A is then left unchanged.
  *
  * @ingroup radix
- * @see assign_index
- * @see store_values
- * @see ft_qsort
- * @see int_cmp
+ * @see count_digits
+ * @see sort_pass
+ * @see store_sorted
  */
-void	assign_indices(t_array *array)
+bool	assign_indices(t_array *array)
 {
-	int	array_a_copy[PS_SIZE_MAX];
+	int	offsets[3][2048];
+	int	*order[2];
+	int	*swap;
+	int	i;
 
-	ft_memmove(array_a_copy, array->a, array->a_size * sizeof(int));
-	ft_qsort(array_a_copy, array->a_size, sizeof(int), int_cmp);
-	assign_index(array, array_a_copy);
-	store_values(array, array_a_copy);
+	count_digits(&array->a, offsets);
+	order[0] = array->sorted_values;
+	order[1] = array->b.data;
+	i = -1;
+	while (++i < 3)
+	{
+		sort_pass(&array->a, order, offsets[i], i * 11);
+		swap = order[0];
+		order[0] = order[1];
+		order[1] = swap;
+	}
+	if (!store_sorted(array, order[0]))
+		return (false);
+	i = -1;
+	while (++i < array->a.size)
+		array->a.data[order[0][i]] = i;
+	return (true);
 }
 
 /**
@@ -124,16 +182,16 @@ void	assign_indices(t_array *array)
  * @param array Pointer to the main stack structure.
  *
  * @ingroup radix
- * @see store_values
+ * @see assign_indices
  */
 void	give_values_back(t_array *array)
 {
 	int	i;
 
 	i = 0;
-	while (i < array->a_size)
+	while (i < array->a.size)
 	{
-		array->a[i] = array->sorted_values[i];
+		stack_set(&array->a, i, array->sorted_values[i]);
 		i++;
 	}
 }
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_buffer.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:45:49 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 07:55:57 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file output_buffer.c
+ * @brief Buffered writer used to emit operations to standard output.
+ *
+ * Operations are appended to a single static buffer of PS_BUFFER_SIZE
+ * bytes instead of being written one by one. The buffer is written to
+ * standard output whenever a string or character would not fit, and
+ * flushed explicitly with `buffer_flush` once the solution is printed
+ * and on the error paths.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup utils
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Returns the program-wide output buffer.
+ *
+ * The buffer lives in static storage so that it can be reached from the
+ * operations as well as from the exit paths without threading it through
+ * every call.
+ *
+ * @return Pointer to the output buffer.
+ *
+ * @ingroup utils
+ */
+static t_buffer	*get_buffer(void)
+{
+	static t_buffer	buffer;
+
+	return (&buffer);
+}
+
+/**
+ * @brief Writes the pending content of the buffer to standard output.
+ *
+ * Retries on partial writes and gives up silently if `write` fails, as
+ * there is nowhere left to report the error.
+ *
+ * @ingroup utils
+ */
+void	buffer_flush(void)
+{
+	t_buffer	*buffer;
+	size_t		written;
+	ssize_t		ret;
+
+	buffer = get_buffer();
+	written = 0;
+	while (written < buffer->len)
+	{
+		ret = write(STDOUT_FILENO, buffer->data + written,
+				buffer->len - written);
+		if (ret <= 0)
+			break ;
+		written += ret;
+	}
+	buffer->len = 0;
+}
+
+/**
+ * @brief Appends a string to the output buffer.
+ *
+ * The buffer is flushed whenever it fills up, so strings of any length
+ * can be written.
+ *
+ * @param str Null-terminated string to append.
+ *
+ * @ingroup utils
+ * @see buffer_flush
+ */
+void	buffer_putstr(const char *str)
+{
+	t_buffer	*buffer;
+
+	buffer = get_buffer();
+	while (*str)
+	{
+		if (buffer->len == PS_BUFFER_SIZE)
+			buffer_flush();
+		buffer->data[buffer->len++] = *str++;
+	}
+}
+
+/**
+ * @brief Appends a single byte to the output buffer.
+ *
+ * Unlike `buffer_putstr`, any byte value can be written, which binary
+ * output needs.
+ *
+ * @param c Byte to append.
+ *
+ * @ingroup utils
+ * @see buffer_flush
+ */
+void	buffer_putchar(char c)
+{
+	t_buffer	*buffer;
+
+	buffer = get_buffer();
+	if (buffer->len == PS_BUFFER_SIZE)
+		buffer_flush();
+	buffer->data[buffer->len++] = c;
+}
@@ -6,15 +6,16 @@
 /*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/12/11 13:36:37 by nlouis            #+#    #+#             */
-/*   Updated: 2025/03/28 08:51:48 by nlouis           ###   ########.fr       */
+/*   Updated: 2026/10/18 17:33:17 by nlouis           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 /**
  * @file push_swap_utils.c
- * @brief Utility functions for error handling in push_swap.
+ * @brief Utility functions for error handling and number output.
  *
- * Provides simple helpers like error printing and controlled exits.
+ * Provides simple helpers like error printing and controlled exits, and
+ * the decimal formatting shared by every count printed.
  *
  * @author
  * Nicolas Louis (nicolas.lovis@hotmail.fr)
@@ -28,13 +29,46 @@
 /**
  * @brief Prints an error message and exits the program.
  *
- * Prints "Error" to standard error and terminates the program
- * with a failure exit status.
+ * Flushes any buffered operations, prints "Error" to standard error and
+ * terminates the program with a failure exit status.
  *
  * @ingroup utils
+ * @see buffer_flush
  */
 void	perror_and_exit(void)
 {
+	buffer_flush();
 	ft_putstr_fd("Error\n", 2);
 	exit(EXIT_FAILURE);
 }
+
+/**
+ * @brief Writes a number in decimal, as a string.
+ *
+ * Leaves the choice of the output to the caller: the operation buffer
+ * for `--batch` counts, standard error for `--explain`.
+ *
+ * @param value Number to write.
+ * @param str Destination, at least PS_SIZE_DIGITS characters.
+ *
+ * @ingroup utils
+ */
+void	format_size(size_t value, char *str)
+{
+	size_t	rest;
+	int		len;
+
+	len = 1;
+	rest = value;
+	while (rest >= 10)
+	{
+		rest /= 10;
+		len++;
+	}
+	str[len] = '\0';
+	while (len-- > 0)
+	{
+		str[len] = '0' + value % 10;
+		value /= 10;
+	}
+}
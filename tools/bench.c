@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:35:19 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 13:06:16 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench.c
+ * @brief Runs push_swap on generated inputs and records the results.
+ *
+ * Each run goes through `run_engine`. The report has one line per run
+ * with tab-separated columns, preceded by a `#` header line.
+ *
+ * Usage: `bench_bin PUSH_SWAP REPORT`
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#include "bench.h"
+
+/**
+ * @brief Tells whether a run is left out of the benchmark.
+ *
+ * Inputs of up to BENCH_SMALL values ignore `--engine`, so they only run
+ * as `auto`. The engines that insert the values one by one (turk, and
+ * lis and rotation, which reinsert the same way) take quadratic time on
+ * random and sawtooth inputs above BENCH_INSERTION_MAX values, where
+ * neither the automatic dispatch nor the portfolio runs them, so they
+ * are only timed there on reversed and nearly sorted inputs.
+ *
+ * @param engine Engine name.
+ * @param kind Shape of the input.
+ * @param size Number of values.
+ * @return true if the run is skipped.
+ */
+static bool	skips_engine(const char *engine, t_kind kind, int size)
+{
+	if (size <= BENCH_SMALL)
+		return (strcmp(engine, "auto") != 0);
+	if (size <= BENCH_INSERTION_MAX || kind == KIND_REVERSED
+		|| kind == KIND_NEARLY_SORTED)
+		return (false);
+	return (strcmp(engine, "turk") == 0 || strcmp(engine, "lis") == 0
+		|| strcmp(engine, "rotation") == 0);
+}
+
+/**
+ * @brief Benchmarks every engine on one input and reports the results.
+ *
+ * @param bench Harness state.
+ * @param kind Shape of the input.
+ * @param size Number of values.
+ * @return 0 on success, -1 on failure.
+ *
+ * @see skips_engine
+ * @see run_engine
+ */
+static int	bench_case(t_bench *bench, t_kind kind, int size)
+{
+	static const char	*engines[] = {"auto", "radix", "turk", "lis",
+		"rotation", "radix-sim", "portfolio", NULL};
+	t_result			result;
+	bool				skip;
+	int					i;
+
+	generate_input(bench->values, size, kind);
+	if (write_input(bench->path, bench->values, size) < 0)
+		return (-1);
+	i = -1;
+	while (engines[++i])
+	{
+		skip = skips_engine(engines[i], kind, size);
+		if (!skip && run_engine(bench, engines[i], &result) < 0)
+			return (-1);
+		if (!skip)
+			fprintf(bench->report, "%s\t%d\t%s\t%ld\t%ld\t%.1f\t%ld\t%d\n",
+				kind_name(kind), size, engines[i], result.ops, result.wall_ns,
+				(double)result.wall_ns / (result.ops + (result.ops == 0)),
+				result.max_rss_kb, WEXITSTATUS(result.status));
+	}
+	fflush(bench->report);
+	return (0);
+}
+
+/**
+ * @brief Checks the arguments, opens the report and writes its header.
+ *
+ * @param bench Harness state.
+ * @param argc Argument count.
+ * @param argv Path of push_swap, then path of the report.
+ * @return 0 on success, -1 on failure.
+ */
+static int	open_report(t_bench *bench, int argc, char **argv)
+{
+	if (argc != 3)
+	{
+		fprintf(stderr, "usage: %s PUSH_SWAP REPORT\n", argv[0]);
+		return (-1);
+	}
+	bench->program = argv[1];
+	bench->report = fopen(argv[2], "w");
+	if (!bench->report)
+		return (-1);
+	fprintf(bench->report, "# kind\tsize\tengine\tops\twall_ns\tns_per_op"
+		"\tmax_rss_kb\tstatus\n");
+	snprintf(bench->path, sizeof(bench->path), "/tmp/ps_bench_%d",
+		(int)getpid());
+	return (0);
+}
+
+/**
+ * @brief Runs every input kind and size, writing the report.
+ *
+ * @param argc Argument count.
+ * @param argv Path of push_swap, then path of the report.
+ * @return 0 on success, 1 on failure.
+ *
+ * @see open_report
+ * @see bench_case
+ */
+int	main(int argc, char **argv)
+{
+	static const int	sizes[] = {3, 5, 100, 500, 10000, 100000, 0};
+	static t_bench		bench;
+	int					status;
+	int					kind;
+	int					i;
+
+	status = open_report(&bench, argc, argv);
+	kind = 0;
+	while (status == 0 && kind < BENCH_KINDS)
+	{
+		i = 0;
+		while (status == 0 && sizes[i])
+			status = bench_case(&bench, kind, sizes[i++]);
+		kind++;
+	}
+	unlink(bench.path);
+	if (!bench.report || fclose(bench.report) != 0 || status != 0)
+		return (1);
+	return (0);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:20:53 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 15:08:57 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench.h
+ * @brief Benchmark harness for the push_swap engines.
+ *
+ * Generates seeded inputs of several shapes and sizes, runs push_swap on
+ * each with every engine, and writes one line per run to a report meant
+ * to be diffed between commits. Run it through `make bench`.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#ifndef BENCH_H
+# define BENCH_H
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <stdbool.h>
+# include <stdint.h>
+# include <string.h>
+# include <time.h>
+# include <unistd.h>
+# include <sys/resource.h>
+# include <sys/wait.h>
+
+/**
+ * @brief Number of input shapes, see t_kind.
+ */
+# define BENCH_KINDS	4
+
+/**
+ * @brief Largest input size, used to size the value buffer.
+ */
+# define BENCH_MAX_SIZE	100000
+
+/**
+ * @brief Largest random or sawtooth input given to the insertion engines.
+ */
+# define BENCH_INSERTION_MAX	10000
+
+/**
+ * @brief Inputs up to this size ignore `--engine`, so only `auto` runs.
+ */
+# define BENCH_SMALL	8
+
+/**
+ * @enum e_kind
+ * @brief Shapes of the generated inputs.
+ */
+typedef enum e_kind
+{
+	KIND_RANDOM,
+	KIND_REVERSED,
+	KIND_NEARLY_SORTED,
+	KIND_SAWTOOTH
+}	t_kind;
+
+/**
+ * @struct s_result
+ * @brief Measurements of one push_swap run.
+ */
+typedef struct s_result
+{
+	long	ops;						/**< Operations emitted */
+	long	wall_ns;					/**< Wall time from fork to exit */
+	long	max_rss_kb;					/**< Peak resident set size */
+	int		status;						/**< Exit status of push_swap */
+}	t_result;
+
+/**
+ * @struct s_bench
+ * @brief Harness state shared by every run.
+ */
+typedef struct s_bench
+{
+	const char	*program;				/**< Path of push_swap */
+	FILE		*report;				/**< Report being written */
+	char		path[32];				/**< Temporary input file */
+	int			values[BENCH_MAX_SIZE];	/**< Generated input */
+}	t_bench;
+
+const char	*kind_name(t_kind kind);
+void		generate_input(int *values, int size, t_kind kind);
+int			write_input(const char *path, const int *values, int size);
+int			run_engine(t_bench *bench, const char *engine, t_result *result);
+
+#endif
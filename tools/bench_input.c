@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_input.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:28:06 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 15:16:10 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_input.c
+ * @brief Seeded input generators of the benchmark harness.
+ *
+ * Every input is a permutation shaped by its kind. The generator is
+ * seeded from the kind and the size only, so each commit is measured on
+ * exactly the same inputs.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#include "bench.h"
+
+/**
+ * @brief Returns the next number of a xorshift64 generator.
+ *
+ * @param state Generator state, never zero.
+ * @return Pseudo-random 64-bit number.
+ */
+static uint64_t	next_random(uint64_t *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return (*state);
+}
+
+/**
+ * @brief Returns the name of an input kind, as written in the report.
+ *
+ * @param kind Input kind.
+ * @return Name of the kind.
+ */
+const char	*kind_name(t_kind kind)
+{
+	static const char	*names[BENCH_KINDS] = {"random", "reversed",
+		"nearly_sorted", "sawtooth"};
+
+	return (names[kind]);
+}
+
+/**
+ * @brief Applies random swaps to a sorted sequence.
+ *
+ * Random inputs get a cyclic shuffle (Sattolo's variant of Fisher-Yates),
+ * which moves every value, so they are never left sorted. Nearly sorted
+ * ones get short-distance swaps at least four positions apart, about one
+ * value in twenty; the swaps never overlap, so none of them can undo
+ * another.
+ *
+ * @param values Sorted values to shuffle.
+ * @param size Number of values.
+ * @param kind KIND_RANDOM or KIND_NEARLY_SORTED.
+ * @param state Generator state.
+ */
+static void	shuffle(int *values, int size, t_kind kind, uint64_t *state)
+{
+	int	i;
+	int	j;
+	int	tmp;
+
+	i = size - 1;
+	if (kind == KIND_NEARLY_SORTED)
+		i = 1;
+	while (i > 0 && i < size)
+	{
+		j = next_random(state) % i;
+		if (kind == KIND_NEARLY_SORTED)
+			j = i - 1 - next_random(state) % 3 * (i > 2);
+		tmp = values[i];
+		values[i] = values[j];
+		values[j] = tmp;
+		if (kind == KIND_NEARLY_SORTED)
+			i += 4 + next_random(state) % 33;
+		else
+			i--;
+	}
+}
+
+/**
+ * @brief Fills `values` with an input of the given kind.
+ *
+ * Values are spread around zero so that negative numbers are parsed as
+ * well. Sawtooth inputs are sqrt(size) interleaved ascending runs, and
+ * at least two, so that no kind is ever sorted from 3 values up.
+ *
+ * @param values Destination, at least `size` entries.
+ * @param size Number of values.
+ * @param kind Shape of the input.
+ */
+void	generate_input(int *values, int size, t_kind kind)
+{
+	uint64_t	state;
+	int			teeth;
+	int			i;
+
+	state = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)kind << 32 | size);
+	teeth = 2;
+	while ((teeth + 1) * (teeth + 1) <= size)
+		teeth++;
+	i = 0;
+	while (i < size)
+	{
+		values[i] = i * 2 - size;
+		if (kind == KIND_REVERSED)
+			values[i] = size - i * 2;
+		else if (kind == KIND_SAWTOOTH)
+			values[i] = (i % teeth) * size + i / teeth - size;
+		i++;
+	}
+	if (kind == KIND_RANDOM || kind == KIND_NEARLY_SORTED)
+		shuffle(values, size, kind, &state);
+}
+
+/**
+ * @brief Writes an input as one value per line.
+ *
+ * @param path Destination file.
+ * @param values Values to write.
+ * @param size Number of values.
+ * @return 0 on success, -1 on failure.
+ */
+int	write_input(const char *path, const int *values, int size)
+{
+	FILE	*file;
+	int		i;
+
+	file = fopen(path, "w");
+	if (!file)
+		return (-1);
+	i = 0;
+	while (i < size)
+		fprintf(file, "%d\n", values[i++]);
+	return (fclose(file));
+}
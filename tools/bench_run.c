@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:36:40 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 21:36:40 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file bench_run.c
+ * @brief Runs push_swap in a child process and measures the run.
+ *
+ * push_swap runs with `--binary --file`, so the operations reach the
+ * harness through a pipe at about one byte per run, and the peak RSS
+ * comes from wait4().
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#include "bench.h"
+
+/**
+ * @brief Counts the operations of a binary stream read from a pipe.
+ *
+ * @param fd Read end of the pipe, closed on return.
+ * @return Number of operations.
+ */
+static long	count_ops(int fd)
+{
+	unsigned char	block[65536];
+	ssize_t			bytes;
+	ssize_t			i;
+	long			skip;
+	long			ops;
+
+	skip = 4;
+	ops = 0;
+	bytes = read(fd, block, sizeof(block));
+	while (bytes > 0)
+	{
+		i = 0;
+		while (i < bytes)
+		{
+			if (skip > 0)
+				skip--;
+			else
+				ops += (block[i] & 0x0F) + 1;
+			i++;
+		}
+		bytes = read(fd, block, sizeof(block));
+	}
+	close(fd);
+	return (ops);
+}
+
+/**
+ * @brief Runs push_swap once with the given engine on the input file.
+ *
+ * @param bench Harness state.
+ * @param engine Engine name passed to `--engine`.
+ * @param result Receives the measurements.
+ * @return 0 on success, -1 if the process could not be started.
+ */
+int	run_engine(t_bench *bench, const char *engine, t_result *result)
+{
+	struct timespec	times[2];
+	struct rusage	usage;
+	int				fds[2];
+	pid_t			pid;
+
+	if (pipe(fds) < 0)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &times[0]);
+	pid = fork();
+	if (pid == 0)
+	{
+		dup2(fds[1], STDOUT_FILENO);
+		execl(bench->program, bench->program, "--engine", engine,
+			"--binary", "--file", bench->path, (char *) NULL);
+		_exit(127);
+	}
+	close(fds[1]);
+	result->ops = count_ops(fds[0]);
+	if (pid < 0 || wait4(pid, &result->status, 0, &usage) < 0)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &times[1]);
+	result->wall_ns = (times[1].tv_sec - times[0].tv_sec) * 1000000000L
+		+ times[1].tv_nsec - times[0].tv_nsec;
+	result->max_rss_kb = usage.ru_maxrss;
+	return (0);
+}
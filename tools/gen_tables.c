@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_tables.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:53:52 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 16:53:52 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file gen_tables.c
+ * @brief Computes a minimal operation sequence for every small permutation.
+ *
+ * For each size, a single breadth-first search from the sorted state
+ * reaches every state of both stacks. It walks the graph backwards with
+ * inverse operations, so the tree it builds gives, from any state, a
+ * shortest sequence of forward operations that sorts it.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#include "gen_tables.h"
+
+/**
+ * @brief Queues every unseen state that reaches `code` in one operation.
+ *
+ * @param gen Generator state.
+ * @param code Encoded state being expanded.
+ * @param tail Pointer to the end of the queue.
+ */
+static void	expand_state(t_gen *gen, int code, int *tail)
+{
+	static const int	inverse[OP_COUNT] = {OP_SA, OP_SB, OP_SS, OP_PB,
+		OP_PA, OP_RRA, OP_RRB, OP_RRR, OP_RA, OP_RB, OP_RR};
+	t_state				state;
+	t_state				next;
+	int					next_code;
+	int					op;
+
+	state.size = gen->size;
+	decode_state(&state, code);
+	op = 0;
+	while (op < OP_COUNT)
+	{
+		next = state;
+		if (apply_state_op(&next, op))
+		{
+			next_code = encode_state(&next);
+			if (gen->parent[next_code] == -1)
+			{
+				gen->parent[next_code] = code;
+				gen->via[next_code] = inverse[op];
+				gen->queue[(*tail)++] = next_code;
+			}
+		}
+		op++;
+	}
+}
+
+/**
+ * @brief Searches the whole state graph of the current size.
+ *
+ * @param gen Generator state.
+ * @param states Number of states, (size + 1)!.
+ * @return 0 on success, 1 if an allocation failed.
+ */
+static int	search_size(t_gen *gen, int states)
+{
+	int	head;
+	int	tail;
+
+	gen->parent = malloc(states * sizeof(int));
+	gen->via = malloc(states);
+	gen->queue = malloc(states * sizeof(int));
+	if (!gen->parent || !gen->via || !gen->queue)
+		return (1);
+	ft_memset(gen->parent, -1, states * sizeof(int));
+	gen->parent[gen->size] = gen->size;
+	gen->queue[0] = gen->size;
+	head = 0;
+	tail = 1;
+	while (head < tail)
+		expand_state(gen, gen->queue[head++], &tail);
+	return (0);
+}
+
+/**
+ * @brief Prints the sequence of every permutation of the current size.
+ *
+ * Permutations are visited in rank order, with every value in stack A.
+ *
+ * @param gen Generator state.
+ * @param permutations Number of permutations, size!.
+ */
+static void	emit_size(t_gen *gen, int permutations)
+{
+	int	rank;
+	int	code;
+
+	gen->base[gen->size] = gen->count;
+	rank = 0;
+	while (rank < permutations)
+	{
+		gen->offsets[gen->count++] = gen->total;
+		code = rank * (gen->size + 1) + gen->size;
+		while (code != gen->size)
+		{
+			print_value(gen->via[code], gen->total++, GEN_OPS_PER_LINE);
+			code = gen->parent[code];
+		}
+		rank++;
+	}
+}
+
+/**
+ * @brief Releases the search arrays of the current size.
+ *
+ * @param gen Generator state.
+ */
+static void	free_size(t_gen *gen)
+{
+	free(gen->parent);
+	free(gen->via);
+	free(gen->queue);
+}
+
+/**
+ * @brief Writes the table source file to the standard output.
+ *
+ * @return 0 on success, 1 if an allocation failed.
+ */
+int	main(void)
+{
+	static t_gen	gen;
+	int				permutations;
+
+	print_preamble();
+	permutations = 1;
+	gen.size = 2;
+	while (gen.size <= PS_TABLE_MAX)
+	{
+		permutations *= gen.size;
+		if (search_size(&gen, permutations * (gen.size + 1)))
+		{
+			free_size(&gen);
+			return (1);
+		}
+		emit_size(&gen, permutations);
+		free_size(&gen);
+		gen.size++;
+	}
+	gen.offsets[gen.count] = gen.total;
+	print_offsets(&gen);
+	print_lookup();
+	return (0);
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_tables.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:46:39 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 16:46:39 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file gen_tables.h
+ * @brief Generator of the precomputed small-input tables.
+ *
+ * Builds `srcs/sort/optimal_tables.c`, which stores a minimal operation
+ * sequence for every permutation of 2 to PS_TABLE_MAX values. Run it
+ * through `make tables` after changing the state encoding or the
+ * operation codes.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#ifndef GEN_TABLES_H
+# define GEN_TABLES_H
+
+# include <stdio.h>
+# include "push_swap.h"
+
+/**
+ * @brief Number of permutations stored across all table sizes, 2! to 7!.
+ */
+# define GEN_PERMUTATIONS	5912
+
+/**
+ * @brief Number of operations printed per line of the generated file.
+ */
+# define GEN_OPS_PER_LINE	16
+
+/**
+ * @brief Number of offsets printed per line of the generated file.
+ */
+# define GEN_OFFSETS_PER_LINE	9
+
+/**
+ * @struct s_gen
+ * @brief Generator state: the search tree of one size and the output.
+ *
+ * The breadth-first search starts from the sorted state, so following
+ * `parent` from any state walks a shortest path towards it, and `via`
+ * holds the operation taking each step.
+ */
+typedef struct s_gen
+{
+	int				size;					/**< Number of values */
+	int				*parent;				/**< Next state to the goal */
+	unsigned char	*via;					/**< Operation to `parent` */
+	int				*queue;					/**< Breadth-first frontier */
+	unsigned int	offsets[GEN_PERMUTATIONS + 1];	/**< Start of each row */
+	int				count;					/**< Permutations emitted */
+	int				base[PS_TABLE_MAX + 1];	/**< First row of each size */
+	unsigned int	total;					/**< Operations emitted */
+}	t_gen;
+
+void	print_preamble(void);
+void	print_value(unsigned int value, unsigned int index, int per_line);
+void	print_offsets(const t_gen *gen);
+void	print_lookup(void);
+
+#endif
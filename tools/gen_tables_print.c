@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gen_tables_print.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:08:18 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 17:08:18 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file gen_tables_print.c
+ * @brief Output helpers of the table generator.
+ *
+ * The generated file follows the same layout rules as the hand-written
+ * sources: fixed header, tab indentation and lines under 80 columns.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#include "gen_tables.h"
+
+/**
+ * @brief Prints the 42 header of the generated file.
+ *
+ * The dates are fixed so that regenerating unchanged tables leaves the
+ * file untouched.
+ */
+static void	print_header(void)
+{
+	printf("%s", "/* ****************************************"
+		"********************************** */\n"
+		"/*                                                    "
+		"                        */\n"
+		"/*                                                    "
+		"    :::      ::::::::   */\n"
+		"/*   optimal_tables.c                                 "
+		"  :+:      :+:    :+:   */\n"
+		"/*                                                    "
+		"+:+ +:+         +:+     */\n"
+		"/*   By: nlouis <nlouis@student.hive.fi>            +#"
+		"+  +:+       +#+        */\n"
+		"/*                                                +#+#"
+		"+#+#+#+   +#+           */\n"
+		"/*   Created: 2026/10/17 17:01:05 by nlouis          "
+		"  #+#    #+#             */\n"
+		"/*   Updated: 2026/10/17 17:01:05 by nlouis          "
+		" ###   ########.fr       */\n"
+		"/*                                                    "
+		"                        */\n"
+		"/* ****************************************"
+		"********************************** */\n\n");
+}
+
+/**
+ * @brief Prints the file header, up to the opening of the operation array.
+ */
+void	print_preamble(void)
+{
+	print_header();
+	printf("%s", "/**\n * @file optimal_tables.c\n"
+		" * @brief Minimal operation sequences for 2 to PS_TABLE_MAX values.\n"
+		" *\n * Generated by tools/gen_tables.c through `make tables`, "
+		"do not edit.\n *\n * @ingroup optimal\n */\n"
+		"#include \"push_swap.h\"\n\n"
+		"static const unsigned char\tg_ops[] = {");
+}
+
+/**
+ * @brief Prints one array element, wrapping lines every few values.
+ *
+ * @param value Element to print.
+ * @param index Position of the element in its array.
+ * @param per_line Number of elements per line.
+ */
+void	print_value(unsigned int value, unsigned int index, int per_line)
+{
+	if (index % per_line == 0)
+		printf("\n\t");
+	else
+		printf(" ");
+	printf("%u,", value);
+}
+
+/**
+ * @brief Closes the operation array and prints the row indexing arrays.
+ *
+ * @param gen Generator state, after every size has been emitted.
+ */
+void	print_offsets(const t_gen *gen)
+{
+	int	i;
+
+	printf("\n};\n\nstatic const unsigned int\tg_offsets[] = {");
+	i = 0;
+	while (i <= gen->count)
+	{
+		print_value(gen->offsets[i], i, GEN_OFFSETS_PER_LINE);
+		i++;
+	}
+	printf("\n};\n\nstatic const int\tg_base[] = {");
+	i = 0;
+	while (i <= PS_TABLE_MAX)
+	{
+		printf("%d", gen->base[i]);
+		if (i++ < PS_TABLE_MAX)
+			printf(", ");
+	}
+	printf("};\n");
+}
+
+/**
+ * @brief Prints the lookup function exported by the generated file.
+ *
+ */
+void	print_lookup(void)
+{
+	printf("%s", "\n/**\n * @brief Returns the minimal sequence sorting a "
+		"permutation.\n *\n * @param size Number of values, 2 to "
+		"PS_TABLE_MAX.\n * @param rank Lehmer rank of the permutation.\n"
+		" * @param len Receives the number of operations.\n"
+		" * @return Operation codes, one byte each.\n *\n"
+		" * @ingroup optimal\n */\n"
+		"const unsigned char\t*optimal_table(int size, int rank, int *len)\n"
+		"{\n\tint\tindex;\n\n"
+		"\tindex = g_base[size] + rank;\n"
+		"\t*len = g_offsets[index + 1] - g_offsets[index];\n"
+		"\treturn (g_ops + g_offsets[index]);\n}\n");
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   norm_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:05:12 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 13:49:34 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file norm_bench.c
+ * @brief Times the normalization of large random inputs, on its own.
+ *
+ * Links the solver and calls `assign_indices` directly on seeded random
+ * permutations, so parsing, process start-up and the engines are left
+ * out. Each size keeps its fastest of 5 runs. The report has one
+ * tab-separated line per size, after a `#` header line.
+ *
+ * Usage: `norm_bench REPORT`, run through `make normbench`.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ */
+#include "push_swap.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * @brief Fills stack A with a seeded random permutation.
+ *
+ * Values are spread around zero so that negative numbers are normalized
+ * as well, then shuffled with a xorshift64 generator.
+ *
+ * @param a Stack A, with room for `size` values.
+ * @param size Number of values.
+ */
+static void	fill_random(t_stack *a, int size)
+{
+	uint64_t	state;
+	int			i;
+	int			j;
+	int			tmp;
+
+	state = 0x9E3779B97F4A7C15ULL ^ (uint64_t)size;
+	i = -1;
+	while (++i < size)
+		a->data[i] = i * 2 - size;
+	while (--i > 0)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		j = state % (i + 1);
+		tmp = a->data[i];
+		a->data[i] = a->data[j];
+		a->data[j] = tmp;
+	}
+	a->head = 0;
+	a->size = size;
+}
+
+/**
+ * @brief Normalizes a fresh random input once and times it.
+ *
+ * @param array Pointer to the main stack structure.
+ * @param size Number of values.
+ * @return Time spent in `assign_indices`, in nanoseconds.
+ *
+ * @see fill_random
+ */
+static long	time_normalize(t_array *array, int size)
+{
+	struct timespec	times[2];
+
+	fill_random(&array->a, size);
+	clock_gettime(CLOCK_MONOTONIC, &times[0]);
+	assign_indices(array);
+	clock_gettime(CLOCK_MONOTONIC, &times[1]);
+	return ((times[1].tv_sec - times[0].tv_sec) * 1000000000L
+		+ times[1].tv_nsec - times[0].tv_nsec);
+}
+
+/**
+ * @brief Reports the fastest of 5 normalizations of `size` values.
+ *
+ * @param report Report being written.
+ * @param size Number of values.
+ * @return 0 on success, -1 if the stacks could not be allocated.
+ *
+ * @see time_normalize
+ */
+static int	bench_size(FILE *report, int size)
+{
+	t_array	array;
+	long	best;
+	long	ns;
+	int		run;
+
+	ft_memset(&array, 0, sizeof(t_array));
+	if (!init_array(&array, size))
+		return (-1);
+	best = 0;
+	run = 0;
+	while (run++ < 5)
+	{
+		ns = time_normalize(&array, size);
+		if (best == 0 || ns < best)
+			best = ns;
+	}
+	free_array(&array);
+	fprintf(report, "%d\t%ld\t%.1f\n", size, best, (double)best / size);
+	return (0);
+}
+
+/**
+ * @brief Times the normalization of every size and writes the report.
+ *
+ * @param argc Argument count.
+ * @param argv Path of the report.
+ * @return 0 on success, 1 on failure.
+ *
+ * @see bench_size
+ */
+int	main(int argc, char **argv)
+{
+	static const int	sizes[] = {100000, 1000000, 0};
+	FILE				*report;
+	int					status;
+	int					i;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s REPORT\n", argv[0]);
+		return (1);
+	}
+	report = fopen(argv[1], "w");
+	if (!report)
+		return (1);
+	fprintf(report, "# size\twall_ns\tns_per_value\n");
+	status = 0;
+	i = 0;
+	while (status == 0 && sizes[i])
+		status = bench_size(report, sizes[i++]);
+	if (fclose(report) != 0 || status != 0)
+		return (1);
+	return (0);
+}
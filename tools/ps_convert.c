@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ps_convert.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:54:17 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/17 23:09:08 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file ps_convert.c
+ * @brief Converts operation streams between the text and binary formats.
+ *
+ * Reads a stream from standard input and writes it in the other format:
+ * text becomes binary and binary becomes text. Built by `make convert`.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/17
+ *
+ * @ingroup oplog
+ */
+#include "push_swap.h"
+
+/**
+ * @brief Main function of the converter.
+ *
+ * @return EXIT_SUCCESS once the stream is converted. Invalid streams
+ *         print Error and exit with a failure status.
+ *
+ * @ingroup oplog
+ * @see oplog_decode
+ * @see oplog_print
+ * @see oplog_print_binary
+ */
+int	main(void)
+{
+	static char	block[PS_READ_BLOCK];
+	t_decoder	decoder;
+	t_oplog		log;
+	ssize_t		bytes;
+
+	ft_memset(&decoder, 0, sizeof(t_decoder));
+	ft_memset(&log, 0, sizeof(t_oplog));
+	bytes = read(STDIN_FILENO, block, PS_READ_BLOCK);
+	while (bytes > 0)
+	{
+		if (!oplog_decode(&log, &decoder, block, bytes))
+			perror_and_exit();
+		bytes = read(STDIN_FILENO, block, PS_READ_BLOCK);
+	}
+	if (bytes < 0 || !oplog_decode_end(&decoder) || log.failed)
+		perror_and_exit();
+	if (decoder.format == FORMAT_BINARY)
+		oplog_print(&log);
+	else
+		oplog_print_binary(&log);
+	buffer_flush();
+	oplog_free(&log);
+	return (EXIT_SUCCESS);
+}
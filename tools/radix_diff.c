@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   radix_diff.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nlouis <nlouis@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:08:07 by nlouis            #+#    #+#             */
+/*   Updated: 2026/10/18 09:08:07 by nlouis           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file radix_diff.c
+ * @brief Checks that the radix engine emits what its reference emits.
+ *
+ * `--engine radix` computes its passes on flat arrays, while
+ * `--engine radix-sim` runs every operation on the stacks; both must
+ * print the same operations. The inputs are the seeded shapes of the
+ * benchmark harness, at sizes around the scan chunk boundaries. Built
+ * and run by `make difftest`.
+ *
+ * @author
+ * Nicolas Louis (nicolas.lovis@hotmail.fr)
+ * @date
+ * Created: 2026/10/18
+ */
+#include "bench.h"
+#include "push_swap.h"
+
+/**
+ * @brief Solves one input with both engines and compares the results.
+ *
+ * @param values Input values.
+ * @param size Number of values.
+ * @return 0 if both engines printed the same operations, -1 otherwise.
+ */
+static int	diff_case(const int *values, int size)
+{
+	t_oplog		logs[2];
+	t_status	status[2];
+	int			result;
+
+	status[0] = ps_solve_engine(values, size, ENGINE_RADIX, &logs[0]);
+	status[1] = ps_solve_engine(values, size, ENGINE_RADIX_SIM, &logs[1]);
+	result = -(status[0] != PS_OK || status[1] != PS_OK
+			|| logs[0].size != logs[1].size);
+	if (result == 0 && logs[0].size > 0)
+		result = -(memcmp(logs[0].ops, logs[1].ops, logs[0].size) != 0);
+	oplog_free(&logs[0]);
+	oplog_free(&logs[1]);
+	return (result);
+}
+
+/**
+ * @brief Compares both engines on every input kind and size.
+ *
+ * @return 0 if every input matched, 1 otherwise.
+ */
+int	main(void)
+{
+	static const int	sizes[] = {9, 100, 4095, 4096, 4097, 8193, 100000, 0};
+	static int			values[BENCH_MAX_SIZE];
+	int					failed;
+	int					kind;
+	int					i;
+
+	failed = 0;
+	kind = -1;
+	while (++kind < BENCH_KINDS)
+	{
+		i = -1;
+		while (sizes[++i])
+		{
+			generate_input(values, sizes[i], kind);
+			if (diff_case(values, sizes[i]) != 0)
+			{
+				fprintf(stderr, "radix differs from radix-sim: %s %d\n",
+					kind_name(kind), sizes[i]);
+				failed++;
+			}
+		}
+	}
+	printf("radix_diff: %d of %d inputs differ\n", failed, BENCH_KINDS * i);
+	return (failed != 0);
+}